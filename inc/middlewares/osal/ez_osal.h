@@ -78,6 +78,7 @@ extern "C" {
 #define EZ_OSAL_DEFINE_SEMAPHORE_HANDLE(NAME, MAX_COUNT, RESOURCE) \
     ezOsal_SemaphoreHandle_t NAME = { \
         .max_count = MAX_COUNT, \
+        .initial_count = 0U, \
         .static_resource = RESOURCE, \
         .handle = NULL \
     }
@@ -130,6 +131,7 @@ typedef struct
 typedef struct
 {
     uint32_t max_count;
+    uint32_t initial_count; /**< Count at creation, at most max_count */
     void *static_resource;
     void *handle;
 }ezOsal_SemaphoreHandle_t;
@@ -0,0 +1,263 @@
+/*****************************************************************************
+* Filename:         ez_blocking_queue.h
+* Author:           Hai Nguyen
+* Original Date:    16.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   ez_blocking_queue.h
+ *  @author Hai Nguyen
+ *  @date   16.10.2026
+ *  @brief  Public API of the blocking queue component
+ *
+ *  @details Thread-safe ezQueue whose push waits for space and whose pop
+ *  waits for data, built on the semaphores and events of the OSAL.
+ */
+
+#ifndef _EZ_BLOCKING_QUEUE_H
+#define _EZ_BLOCKING_QUEUE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*****************************************************************************
+* Includes
+*****************************************************************************/
+#if (EZ_BUILD_WITH_CMAKE == 0U)
+#include "ez_target_config.h"
+#endif
+
+#if (EZ_BLOCKING_QUEUE == 1)
+#include <stdint.h>
+#include "ez_utilities_common.h"
+#include "ez_queue.h"
+#include "ez_osal.h"
+
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+#define EZ_BLOCKING_QUEUE_NO_WAIT       0x00U       /**< Return at once if the queue is full or empty */
+#define EZ_BLOCKING_QUEUE_WAIT_FOREVER  0xFFFFFFFFU /**< Wait until the queue has space or data */
+
+#define EZ_BLOCKING_QUEUE_DATA_AVAIL    0x01U       /**< Event set when an element is pushed */
+#define EZ_BLOCKING_QUEUE_SPACE_AVAIL   0x02U       /**< Event set when an element is popped */
+
+
+/*****************************************************************************
+* Component Typedefs
+*****************************************************************************/
+
+/** @brief Queue shared between tasks, see ezBlockingQueue_Create
+ */
+typedef struct
+{
+    ezQueue queue;                  /**< Elements, only accessed while holding lock */
+    uint32_t capacity;              /**< Maximum number of elements, 0 if only the buffer limits it */
+    ezOsal_SemaphoreHandle_t *lock; /**< Semaphore with a max count of 1 protecting queue */
+    ezOsal_EventHandle_t *event;    /**< Event group of the DATA_AVAIL and SPACE_AVAIL events */
+}ezBlockingQueue;
+
+
+/*****************************************************************************
+* Component Variable Definitions
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Function Prototypes
+*****************************************************************************/
+
+/*****************************************************************************
+* Function: ezBlockingQueue_Create
+*//**
+* @brief Create a blocking queue
+*
+* @details Creates the semaphore and the event group through the OSAL and the
+* queue in the buffer. The handles are defined by the user with
+* EZ_OSAL_DEFINE_SEMAPHORE_HANDLE (max count 1) and
+* EZ_OSAL_DEFINE_EVENT_HANDLE, so they can carry the static resources of the
+* RTOS. The lock is created with an initial count of 1. The event group must
+* not be shared with other components.
+*
+* @param[in]    bq: blocking queue to be created
+* @param[in]    buff: memory of the elements
+* @param[in]    buff_size: size of buff, at most EZ_STATIC_ALLOC_MAX_SIZE
+* @param[in]    capacity: maximum number of elements, 0 if only the buffer
+*                         limits it
+* @param[in]    lock: semaphore handle
+* @param[in]    event: event handle
+* @return       ezSUCCESS, ezSTATUS_ARG_INVALID or ezFAIL
+*
+* @pre OSAL is initialized
+* @post None
+*
+* \b Example
+* @code
+* EZ_OSAL_DEFINE_SEMAPHORE_HANDLE(rx_lock, 1, NULL);
+* EZ_OSAL_DEFINE_EVENT_HANDLE(rx_event, NULL);
+* static uint8_t rx_buff[512];
+* static ezBlockingQueue rx_queue;
+*
+* ezSTATUS status = ezBlockingQueue_Create(&rx_queue, rx_buff, sizeof(rx_buff),
+*                                          8, &rx_lock, &rx_event);
+* @endcode
+*
+* @see ezBlockingQueue_Delete
+*
+*****************************************************************************/
+ezSTATUS ezBlockingQueue_Create(ezBlockingQueue *bq,
+                                uint8_t *buff,
+                                uint32_t buff_size,
+                                uint32_t capacity,
+                                ezOsal_SemaphoreHandle_t *lock,
+                                ezOsal_EventHandle_t *event);
+
+
+/*****************************************************************************
+* Function: ezBlockingQueue_Delete
+*//**
+* @brief Delete the semaphore and the event group of a blocking queue
+*
+* @details No task may wait on the queue anymore. The buffer is not touched.
+*
+* @param[in]    bq: blocking queue
+* @return       ezSUCCESS or ezSTATUS_ARG_INVALID
+*
+* @pre bq is created
+* @post None
+*
+* \b Example
+* @code
+* (void)ezBlockingQueue_Delete(&rx_queue);
+* @endcode
+*
+* @see ezBlockingQueue_Create
+*
+*****************************************************************************/
+ezSTATUS ezBlockingQueue_Delete(ezBlockingQueue *bq);
+
+
+/*****************************************************************************
+* Function: ezBlockingQueue_PushTimeout
+*//**
+* @brief Copy an element to the back of the queue, wait for space if needed
+*
+* @details If the queue holds capacity elements or the buffer has no block
+* large enough, the caller sleeps until a pop makes space or the timeout
+* elapses. An element which does not fit into the empty queue fails at once.
+*
+* @param[in]    bq: blocking queue
+* @param[in]    data: data of the element
+* @param[in]    data_size: size of the data
+* @param[in]    timeout_ticks: ticks to wait, EZ_BLOCKING_QUEUE_NO_WAIT or
+*                              EZ_BLOCKING_QUEUE_WAIT_FOREVER
+* @return       ezSUCCESS, ezSTATUS_TIMEOUT if there was no space in time,
+*               ezSTATUS_ARG_INVALID or ezFAIL
+*
+* @pre bq is created
+* @post None
+*
+* \b Example
+* @code
+* if(ezBlockingQueue_PushTimeout(&rx_queue, frame, frame_len, 10) == ezSTATUS_TIMEOUT)
+* {
+*     dropped_frames++;
+* }
+* @endcode
+*
+* @see ezBlockingQueue_PopTimeout
+*
+*****************************************************************************/
+ezSTATUS ezBlockingQueue_PushTimeout(ezBlockingQueue *bq,
+                                     void *data,
+                                     uint32_t data_size,
+                                     uint32_t timeout_ticks);
+
+
+/*****************************************************************************
+* Function: ezBlockingQueue_PopTimeout
+*//**
+* @brief Copy the front element out of the queue and remove it, wait for data
+* if needed
+*
+* @details If the queue is empty, the caller sleeps until a push or the
+* timeout. If the element is larger than the buffer of the caller, it stays
+* in the queue and *data_size returns its size.
+*
+* @param[in]    bq: blocking queue
+* @param[out]   data: buffer receiving the data
+* @param[in,out] data_size: size of data, returns the size of the element
+* @param[in]    timeout_ticks: ticks to wait, EZ_BLOCKING_QUEUE_NO_WAIT or
+*                              EZ_BLOCKING_QUEUE_WAIT_FOREVER
+* @return       ezSUCCESS, ezSTATUS_TIMEOUT if the queue stayed empty,
+*               ezSTATUS_ARG_INVALID if data is too small, or ezFAIL
+*
+* @pre bq is created
+* @post None
+*
+* \b Example
+* @code
+* uint8_t frame[64];
+* uint32_t frame_len = sizeof(frame);
+*
+* while(ezBlockingQueue_PopTimeout(&rx_queue, frame, &frame_len,
+*                                  EZ_BLOCKING_QUEUE_WAIT_FOREVER) == ezSUCCESS)
+* {
+*     HandleFrame(frame, frame_len);
+*     frame_len = sizeof(frame);
+* }
+* @endcode
+*
+* @see ezBlockingQueue_PushTimeout
+*
+*****************************************************************************/
+ezSTATUS ezBlockingQueue_PopTimeout(ezBlockingQueue *bq,
+                                    void *data,
+                                    uint32_t *data_size,
+                                    uint32_t timeout_ticks);
+
+
+/*****************************************************************************
+* Function: ezBlockingQueue_GetNumOfElement
+*//**
+* @brief Return the number of elements in the queue
+*
+* @details Reads the count while holding the lock. The value may change as
+* soon as it is returned, use it for monitoring, not to decide whether a pop
+* will block.
+*
+* @param[in]    bq: blocking queue
+* @return       Number of elements, 0 if the lock cannot be taken
+*
+* @pre bq is created
+* @post None
+*
+* \b Example
+* @code
+* uint32_t depth = ezBlockingQueue_GetNumOfElement(&rx_queue);
+* @endcode
+*
+*****************************************************************************/
+uint32_t ezBlockingQueue_GetNumOfElement(ezBlockingQueue *bq);
+
+
+#endif /* EZ_BLOCKING_QUEUE == 1 */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _EZ_BLOCKING_QUEUE_H */
+
+
+/* End of file */
@@ -275,21 +275,25 @@ uint16_t ezEventBus_GetNumOfListeners(ezEventBus_t *event_bus);
 *//**
 * @brief This function send an event to the bus
 *
-* @details
+* @details The event code and a copy of the data are stored as one element of
+* the event queue. An event without data is sent with event_data NULL and
+* event_data_size 0, its listeners receive NULL and 0.
 *
 * @param[in]    event_bus: Pointer to the event bus
 * @param[in]    event_code: Event code. Defined by users
-* @param[in]    param1: Companion paramneter 1, set to NULL if unused
-* @param[in]    param1: Companion paramneter 2, set to NULL if unused
-* @return       None
+* @param[in]    event_data: Data of the event, may be NULL if event_data_size
+*               is 0
+* @param[in]    event_data_size: Size of the data in bytes
+* @return       true if the event is queued, false if the queue is full or
+*               invalid arguments
 *
-* @pre  subject must be created. event_code, param1, and param2 are defined by
+* @pre  subject must be created. event_code and event_data are defined by
 *       the user
 * @post None
 *
 * \b Example
 * @code
-* evntNoti_NotifyEnvent(&subject, ENUM_ERROR_CODE, NULL, NULL);
+* ezEventBus_SendEvent(&subject, ENUM_ERROR_CODE, NULL, 0);
 * @endcode
 *
 * @see ezEventNotifier_CreateSubject
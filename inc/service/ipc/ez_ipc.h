@@ -89,7 +89,9 @@ void ezIpc_InitModule(void);
 *//** 
 * @brief Get a free instance from the Ipc pool and init it according to the parameters
 *
-* @details
+* @details Every instance manages its buffer with its own
+* CONFIG_NUM_OF_IPC_MEM_BLOCK block descriptors, which limits the number of
+* messages and free gaps in the buffer.
 *
 * @param[in]    *ipc_buffer: pointer to the providing buffer for the instance
 * @param[in]    buffer_size: size of the buffer in byte
@@ -109,7 +111,7 @@ void ezIpc_InitModule(void);
 *
 *****************************************************************************/
 ezmMailBox ezIpc_GetInstance(uint8_t* ipc_buffer,
-                             uint16_t buffer_size,
+                             uint32_t buffer_size,
                              ezmIpc_MessageCallback fnCallback);
 
 
@@ -194,7 +196,7 @@ bool ezIpc_SendMessage(ezmMailBox send_to, void *message);
 * @see TBD
 *
 *****************************************************************************/
-void *ezIpc_ReceiveMessage(ezmMailBox receive_from, uint16_t *message_size);
+void *ezIpc_ReceiveMessage(ezmMailBox receive_from, uint32_t *message_size);
 
 
 /*****************************************************************************
@@ -0,0 +1,292 @@
+/*****************************************************************************
+* Filename:         ez_arena.h
+* Author:           Hai Nguyen
+* Original Date:    16.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+
+/** @file   ez_arena.h
+ *  @author Hai Nguyen
+ *  @date   16.10.2026
+ *  @brief  Public API of the arena (bump) allocator
+ *
+ *  @details Hands out memory from a caller-supplied buffer by moving an
+ *  offset forward. Single allocations are never freed, the whole arena is
+ *  reset or rewound to a mark instead. Suited to scratch memory of one
+ *  message or one frame, which is released at once when the work is done.
+ */
+
+#ifndef _EZ_ARENA_H
+#define _EZ_ARENA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*****************************************************************************
+* Includes
+*****************************************************************************/
+#if (EZ_BUILD_WITH_CMAKE == 0U)
+#include "ez_target_config.h"
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#if (EZ_ARENA == 1U)
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+#ifndef CONFIG_EZ_ARENA_ALIGNMENT
+/** @brief Alignment of the memory returned by ezArena_Alloc, power of two */
+#define CONFIG_EZ_ARENA_ALIGNMENT   sizeof(void *)
+#endif
+
+
+/*****************************************************************************
+* Component Typedefs
+*****************************************************************************/
+/** @brief Data structure of an arena
+ */
+typedef struct
+{
+    uint8_t *buff;
+    /**< memory handed out by the arena*/
+    uint32_t buff_size;
+    /**< size of buff in bytes*/
+    uint32_t offset;
+    /**< offset of the first unused byte*/
+    uint32_t peak;
+    /**< highest offset since init*/
+}ezArena;
+
+/** @brief Position of an arena, returned by ezArena_GetMark */
+typedef uint32_t ezArenaMark;
+
+
+/*****************************************************************************
+* Component Variable Definitions
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Function Prototypes
+*****************************************************************************/
+
+/*****************************************************************************
+* Function : ezArena_Init
+*//**
+* @brief Initialize the arena over a caller-supplied buffer
+*
+* @details The arena is not thread-safe, use one arena per task.
+*
+* @param[in]    arena: pointer to the arena
+* @param[in]    buff: storage of the arena
+* @param[in]    buff_size: size of buff in bytes
+* @return       true if success, else false
+*
+* @pre None
+* @post The arena is empty
+*
+* \b Example
+* @code
+* static uint8_t scratch[512];
+* ezArena arena;
+* ezArena_Init(&arena, scratch, sizeof(scratch));
+* @endcode
+*
+*****************************************************************************/
+bool ezArena_Init(ezArena *arena, void *buff, uint32_t buff_size);
+
+
+/*****************************************************************************
+* Function : ezArena_Alloc
+*//**
+* @brief Take size bytes from the arena
+*
+* @details The memory is aligned to CONFIG_EZ_ARENA_ALIGNMENT and its content
+* is undefined. It stays valid until the arena is reset or rewound to a mark
+* taken before this allocation.
+*
+* @param[in]    arena: pointer to the arena
+* @param[in]    size: number of bytes
+* @return       pointer to the memory, NULL if size is 0 or the arena is full
+*
+* @pre arena is initialized
+* @post None
+*
+* \b Example
+* @code
+* char *name = (char *)ezArena_Alloc(&arena, name_len + 1U);
+* @endcode
+*
+* @see ezArena_AllocAligned, ezArena_Rewind, ezArena_Reset
+*
+*****************************************************************************/
+void *ezArena_Alloc(ezArena *arena, uint32_t size);
+
+
+/*****************************************************************************
+* Function : ezArena_AllocAligned
+*//**
+* @brief Take size bytes at an address which is a multiple of alignment
+*
+* @details
+*
+* @param[in]    arena: pointer to the arena
+* @param[in]    size: number of bytes
+* @param[in]    alignment: power of two
+* @return       pointer to the memory, NULL if size is 0, alignment is not a
+*               power of two or the arena is full
+*
+* @pre arena is initialized
+* @post None
+*
+* \b Example
+* @code
+* uint8_t *dma_buff = (uint8_t *)ezArena_AllocAligned(&arena, 128, 32);
+* @endcode
+*
+* @see ezArena_Alloc
+*
+*****************************************************************************/
+void *ezArena_AllocAligned(ezArena *arena, uint32_t size, uint32_t alignment);
+
+
+/*****************************************************************************
+* Function : ezArena_GetMark
+*//**
+* @brief Return the current position of the arena
+*
+* @details
+*
+* @param[in]    arena: pointer to the arena
+* @return       mark to pass to ezArena_Rewind
+*
+* @pre arena is initialized
+* @post None
+*
+* \b Example
+* @code
+* ezArenaMark mark = ezArena_GetMark(&arena);
+* ParseCommand(&arena, cmd);
+* ezArena_Rewind(&arena, mark);
+* @endcode
+*
+* @see ezArena_Rewind
+*
+*****************************************************************************/
+ezArenaMark ezArena_GetMark(ezArena *arena);
+
+
+/*****************************************************************************
+* Function : ezArena_Rewind
+*//**
+* @brief Release every allocation made after the mark was taken
+*
+* @details Marks can be nested, rewinding to an outer mark also releases the
+* allocations of the inner ones.
+*
+* @param[in]    arena: pointer to the arena
+* @param[in]    mark: mark returned by ezArena_GetMark
+* @return       true if success, false if the mark is ahead of the current
+*               position, i.e. it was already rewound past
+*
+* @pre arena is initialized
+* @post None
+*
+* \b Example
+* @code
+* ezArena_Rewind(&arena, mark);
+* @endcode
+*
+* @see ezArena_GetMark, ezArena_Reset
+*
+*****************************************************************************/
+bool ezArena_Rewind(ezArena *arena, ezArenaMark mark);
+
+
+/*****************************************************************************
+* Function : ezArena_Reset
+*//**
+* @brief Release every allocation of the arena
+*
+* @details
+*
+* @param[in]    arena: pointer to the arena
+* @return       None
+*
+* @pre arena is initialized
+* @post The arena is empty, the peak is kept
+*
+* \b Example
+* @code
+* ezArena_Reset(&arena);
+* @endcode
+*
+*****************************************************************************/
+void ezArena_Reset(ezArena *arena);
+
+
+/*****************************************************************************
+* Function : ezArena_GetFreeSize
+*//**
+* @brief Return the number of bytes left in the arena
+*
+* @details An allocation may get less because of its alignment.
+*
+* @param[in]    arena: pointer to the arena
+* @return       number of free bytes
+*
+* @pre arena is initialized
+* @post None
+*
+* \b Example
+* @code
+* uint32_t free_size = ezArena_GetFreeSize(&arena);
+* @endcode
+*
+*****************************************************************************/
+uint32_t ezArena_GetFreeSize(ezArena *arena);
+
+
+/*****************************************************************************
+* Function : ezArena_GetPeak
+*//**
+* @brief Return the highest number of bytes used since init
+*
+* @details Helps sizing the buffer of the arena.
+*
+* @param[in]    arena: pointer to the arena
+* @return       peak usage in bytes, alignment padding included
+*
+* @pre arena is initialized
+* @post None
+*
+* \b Example
+* @code
+* uint32_t peak = ezArena_GetPeak(&arena);
+* @endcode
+*
+*****************************************************************************/
+uint32_t ezArena_GetPeak(ezArena *arena);
+
+#endif /* EZ_ARENA == 1U */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _EZ_ARENA_H */
+
+/* End of file */
@@ -0,0 +1,64 @@
+/*****************************************************************************
+* Filename:         ez_atomic.h
+* Author:           Hai Nguyen
+* Original Date:    16.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   ez_atomic.h
+ *  @author Hai Nguyen
+ *  @date   16.10.2026
+ *  @brief  Thin wrapper around the compiler atomic builtins
+ *
+ *  @details The lock-free components of the framework access plain integer
+ *  fields through these macros, so that their public structures stay usable
+ *  from both C and C++ without depending on <stdatomic.h>.
+ */
+
+#ifndef _EZ_ATOMIC_H
+#define _EZ_ATOMIC_H
+
+/*****************************************************************************
+* Includes
+*****************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+#if defined(__GNUC__) || defined(__clang__)
+
+/** @brief Load a value without ordering constraints */
+#define EZ_ATOMIC_LOAD_RELAXED(ptr)         __atomic_load_n((ptr), __ATOMIC_RELAXED)
+
+/** @brief Load a value, later accesses cannot be reordered before it */
+#define EZ_ATOMIC_LOAD_ACQUIRE(ptr)         __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+
+/** @brief Store a value without ordering constraints */
+#define EZ_ATOMIC_STORE_RELAXED(ptr, val)   __atomic_store_n((ptr), (val), __ATOMIC_RELAXED)
+
+/** @brief Store a value, earlier accesses cannot be reordered after it */
+#define EZ_ATOMIC_STORE_RELEASE(ptr, val)   __atomic_store_n((ptr), (val), __ATOMIC_RELEASE)
+
+/** @brief Add to a value and return the previous value */
+#define EZ_ATOMIC_FETCH_ADD(ptr, val)       __atomic_fetch_add((ptr), (val), __ATOMIC_ACQ_REL)
+
+/** @brief Compare and swap, *expected is updated with the current value on failure */
+#define EZ_ATOMIC_CAS_WEAK(ptr, expected, desired) \
+    __atomic_compare_exchange_n((ptr), (expected), (desired), true, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+
+#else
+#error "ez_atomic.h requires a compiler supporting the __atomic builtins"
+#endif
+
+#endif /* _EZ_ATOMIC_H */
+
+/* End of file */
@@ -91,6 +91,10 @@ extern "C" {
 #define EZ_TASK_WORKER_LOGGING_LEVEL    LVL_ERROR
 #endif /* EZ_TASK_WORKER_LOGGING_LEVEL */
 
+#ifndef EZ_BLOCKING_QUEUE_LOGGING_LEVEL
+#define EZ_BLOCKING_QUEUE_LOGGING_LEVEL LVL_ERROR
+#endif /* EZ_BLOCKING_QUEUE_LOGGING_LEVEL */
+
 #ifndef EZ_SERVICE_LOGGING_LEVEL
 #define EZ_SERVICE_LOGGING_LEVEL        LVL_ERROR
 #endif /* EZ_SERVICE_LOGGING_LEVEL */
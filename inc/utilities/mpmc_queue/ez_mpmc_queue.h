@@ -0,0 +1,233 @@
+/*****************************************************************************
+* Filename:         ez_mpmc_queue.h
+* Author:           Hai Nguyen
+* Original Date:    16.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+
+/** @file   ez_mpmc_queue.h
+ *  @author Hai Nguyen
+ *  @date   16.10.2026
+ *  @brief  Public API of the multi-producer/multi-consumer queue
+ *
+ *  @details Bounded lock-free queue of fixed-size elements. Each slot
+ *  carries a sequence number telling whether it is free for the producer
+ *  owning position pos (sequence == pos) or filled for the consumer owning
+ *  it (sequence == pos + 1). Producers and consumers claim positions with a
+ *  compare-and-swap, so any number of tasks can enqueue and dequeue
+ *  concurrently without a lock.
+ */
+
+#ifndef _EZ_MPMC_QUEUE_H
+#define _EZ_MPMC_QUEUE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*****************************************************************************
+* Includes
+*****************************************************************************/
+#if (EZ_BUILD_WITH_CMAKE == 0U)
+#include "ez_target_config.h"
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#if (EZ_MPMC_QUEUE == 1U)
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+#ifndef CONFIG_EZ_MPMC_QUEUE_CACHE_LINE_SIZE
+/** @brief Producer and consumer positions are placed this many bytes apart
+ *  to avoid false sharing. Set to 4 to disable the padding.
+ */
+#define CONFIG_EZ_MPMC_QUEUE_CACHE_LINE_SIZE    64U
+#endif
+
+/** @brief Size of one slot: sequence number plus element, 4-byte aligned */
+#define EZ_MPMC_QUEUE_SLOT_SIZE(elem_size) \
+    (sizeof(uint32_t) + ((((uint32_t)(elem_size)) + 3U) & ~3U))
+
+/** @brief Number of uint32_t needed for the buffer of a queue. Declaring the
+ *  buffer as uint32_t array guarantees the required alignment.
+ *
+ *  \b Example
+ *  @code
+ *  static uint32_t buff[EZ_MPMC_QUEUE_BUFFER_WORDS(sizeof(Job), 16)];
+ *  @endcode
+ */
+#define EZ_MPMC_QUEUE_BUFFER_WORDS(elem_size, num_of_slots) \
+    ((EZ_MPMC_QUEUE_SLOT_SIZE(elem_size) / sizeof(uint32_t)) * (num_of_slots))
+
+
+/*****************************************************************************
+* Component Typedefs
+*****************************************************************************/
+/** @brief Data structure of a multi-producer/multi-consumer queue
+ */
+typedef struct
+{
+    uint8_t *buff;
+    /**< slot storage*/
+    uint32_t slot_size;
+    /**< distance between two slots in bytes*/
+    uint32_t elem_size;
+    /**< size of one element*/
+    uint32_t mask;
+    /**< number of slots - 1*/
+#if (CONFIG_EZ_MPMC_QUEUE_CACHE_LINE_SIZE > 4U)
+    uint8_t pad0[CONFIG_EZ_MPMC_QUEUE_CACHE_LINE_SIZE];
+    /**< keep enqueue_pos off the cache line of the read-only fields*/
+#endif
+    uint32_t enqueue_pos;
+    /**< next position to be claimed by a producer*/
+#if (CONFIG_EZ_MPMC_QUEUE_CACHE_LINE_SIZE > 4U)
+    uint8_t pad1[CONFIG_EZ_MPMC_QUEUE_CACHE_LINE_SIZE - sizeof(uint32_t)];
+    /**< keep the positions on separate cache lines*/
+#endif
+    uint32_t dequeue_pos;
+    /**< next position to be claimed by a consumer*/
+}ezMpmcQueue;
+
+
+/*****************************************************************************
+* Component Variable Definitions
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Function Prototypes
+*****************************************************************************/
+
+/*****************************************************************************
+* Function : ezMpmcQueue_Init
+*//**
+* @brief Initialize the queue over a caller-supplied buffer
+*
+* @details Must be called before any producer or consumer starts.
+*
+* @param[in]    queue: pointer to the queue
+* @param[in]    buff: slot storage, 4-byte aligned, at least
+*               EZ_MPMC_QUEUE_BUFFER_WORDS(elem_size, num_of_slots) words
+* @param[in]    buff_size: size of buff in bytes
+* @param[in]    elem_size: size of one element in bytes
+* @param[in]    num_of_slots: capacity of the queue, must be a power of two
+* @return       true if success, else false
+*
+* @pre None
+* @post None
+*
+* \b Example
+* @code
+* static uint32_t buff[EZ_MPMC_QUEUE_BUFFER_WORDS(sizeof(Job), 16)];
+* ezMpmcQueue queue;
+* ezMpmcQueue_Init(&queue, buff, sizeof(buff), sizeof(Job), 16);
+* @endcode
+*
+*****************************************************************************/
+bool ezMpmcQueue_Init(ezMpmcQueue *queue,
+                      void *buff,
+                      uint32_t buff_size,
+                      uint32_t elem_size,
+                      uint32_t num_of_slots);
+
+
+/*****************************************************************************
+* Function : ezMpmcQueue_Enqueue
+*//**
+* @brief Copy one element into the queue. Safe to call from any number of
+* producers concurrently.
+*
+* @details Does not block.
+*
+* @param[in]    queue: pointer to the queue
+* @param[in]    elem: element of elem_size bytes
+* @return       true if success, false if the queue is full
+*
+* @pre queue is initialized
+* @post None
+*
+* \b Example
+* @code
+* Job job = {...};
+* ezMpmcQueue_Enqueue(&queue, &job);
+* @endcode
+*
+* @see ezMpmcQueue_Dequeue
+*
+*****************************************************************************/
+bool ezMpmcQueue_Enqueue(ezMpmcQueue *queue, const void *elem);
+
+
+/*****************************************************************************
+* Function : ezMpmcQueue_Dequeue
+*//**
+* @brief Copy the oldest element out of the queue. Safe to call from any
+* number of consumers concurrently.
+*
+* @details Does not block.
+*
+* @param[in]    queue: pointer to the queue
+* @param[out]   elem: buffer of elem_size bytes
+* @return       true if success, false if the queue is empty
+*
+* @pre queue is initialized
+* @post None
+*
+* \b Example
+* @code
+* Job job;
+* if(ezMpmcQueue_Dequeue(&queue, &job))
+* {
+*     run(&job);
+* }
+* @endcode
+*
+* @see ezMpmcQueue_Enqueue
+*
+*****************************************************************************/
+bool ezMpmcQueue_Dequeue(ezMpmcQueue *queue, void *elem);
+
+
+/*****************************************************************************
+* Function : ezMpmcQueue_GetNumOfElements
+*//**
+* @brief Return the approximate number of queued elements
+*
+* @details Exact only when no producer or consumer is active.
+*
+* @param[in]    queue: pointer to the queue
+* @return       number of elements
+*
+* @pre queue is initialized
+* @post None
+*
+* \b Example
+* @code
+* uint32_t count = ezMpmcQueue_GetNumOfElements(&queue);
+* @endcode
+*
+*****************************************************************************/
+uint32_t ezMpmcQueue_GetNumOfElements(ezMpmcQueue *queue);
+
+#endif /* EZ_MPMC_QUEUE == 1U */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _EZ_MPMC_QUEUE_H */
+
+/* End of file */
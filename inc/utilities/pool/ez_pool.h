@@ -0,0 +1,250 @@
+/*****************************************************************************
+* Filename:         ez_pool.h
+* Author:           Hai Nguyen
+* Original Date:    16.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+
+/** @file   ez_pool.h
+ *  @author Hai Nguyen
+ *  @date   16.10.2026
+ *  @brief  Public API of the fixed-size object pool
+ *
+ *  @details Hands out objects of one size from a static array. In the
+ *  default mode a bitmap tracks the allocated objects: allocation takes the
+ *  lowest free object found with count-trailing-zeros, and free checks the
+ *  address. In lock-free mode the free objects form an intrusive stack that
+ *  any number of tasks can pop and push concurrently.
+ */
+
+#ifndef _EZ_POOL_H
+#define _EZ_POOL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*****************************************************************************
+* Includes
+*****************************************************************************/
+#if (EZ_BUILD_WITH_CMAKE == 0U)
+#include "ez_target_config.h"
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#if (EZ_POOL == 1U)
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+#ifndef CONFIG_EZ_POOL_ALIGNMENT
+/** @brief Alignment of the objects in the pool, a power of two and at least
+ *  4. The default suits any object type, including pointers, uint64_t and
+ *  double
+ */
+#ifdef __cplusplus
+#define CONFIG_EZ_POOL_ALIGNMENT    ((uint32_t)alignof(max_align_t))
+#else
+#define CONFIG_EZ_POOL_ALIGNMENT    ((uint32_t)_Alignof(max_align_t))
+#endif
+#endif
+
+/** @brief Round a size up to CONFIG_EZ_POOL_ALIGNMENT */
+#define EZ_POOL_ALIGN_UP(size) \
+    ((((uint32_t)(size)) + CONFIG_EZ_POOL_ALIGNMENT - 1U) & ~(CONFIG_EZ_POOL_ALIGNMENT - 1U))
+
+/** @brief Size of one object in the pool, rounded up to the alignment */
+#define EZ_POOL_OBJ_SIZE(obj_size)  EZ_POOL_ALIGN_UP(obj_size)
+
+/** @brief Size of the bitmap in bytes, rounded up to the alignment so that
+ *  the first object is aligned
+ */
+#define EZ_POOL_BITMAP_SIZE(num_of_objs) \
+    EZ_POOL_ALIGN_UP(((((uint32_t)(num_of_objs)) + 31U) / 32U) * sizeof(uint32_t))
+
+/** @brief Number of uint32_t needed for the buffer of a pool: the bitmap
+ *  followed by the objects, plus room to align the start of a 4-byte aligned
+ *  buffer to CONFIG_EZ_POOL_ALIGNMENT. Declaring the buffer as uint32_t array
+ *  is therefore enough.
+ *
+ *  \b Example
+ *  @code
+ *  static uint32_t buff[EZ_POOL_BUFFER_WORDS(sizeof(Header), 32)];
+ *  @endcode
+ */
+#define EZ_POOL_BUFFER_WORDS(obj_size, num_of_objs) \
+    (((CONFIG_EZ_POOL_ALIGNMENT - sizeof(uint32_t)) \
+      + EZ_POOL_BITMAP_SIZE(num_of_objs) \
+      + ((uint32_t)EZ_POOL_OBJ_SIZE(obj_size) * (num_of_objs))) / sizeof(uint32_t))
+
+/** @brief Maximum number of objects in lock-free mode */
+#define EZ_POOL_LOCK_FREE_MAX_OBJS  0xFFFFU
+
+
+/*****************************************************************************
+* Component Typedefs
+*****************************************************************************/
+/** @brief Data structure of a fixed-size object pool
+ */
+typedef struct
+{
+    uint8_t *objs;
+    /**< object storage*/
+    uint32_t *bitmap;
+    /**< bit set if the object is allocated, bitmap mode only*/
+    uint32_t obj_size;
+    /**< distance between two objects in bytes*/
+    uint32_t num_of_objs;
+    /**< number of objects in the pool*/
+    uint32_t num_of_free;
+    /**< number of free objects*/
+    uint32_t search_word;
+    /**< first bitmap word which may have a free object, bitmap mode only*/
+    uint32_t free_top;
+    /**< tag << 16 | index + 1 of the top free object, lock-free mode only*/
+    bool lock_free;
+    /**< true: intrusive lock-free stack instead of bitmap*/
+}ezPool;
+
+
+/*****************************************************************************
+* Component Variable Definitions
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Function Prototypes
+*****************************************************************************/
+
+/*****************************************************************************
+* Function : ezPool_Init
+*//**
+* @brief Initialize the pool over a caller-supplied buffer
+*
+* @details In bitmap mode the pool is not thread-safe, objects are handed out
+* lowest address first and freeing an invalid or free object is detected. In
+* lock-free mode ezPool_Alloc and ezPool_Free can be called from any number of
+* tasks concurrently, but a double free is not detected.
+*
+* @param[in]    pool: pointer to the pool
+* @param[in]    buff: storage, 4-byte aligned, at least
+*               EZ_POOL_BUFFER_WORDS(obj_size, num_of_objs) words. The pool
+*               aligns its objects to CONFIG_EZ_POOL_ALIGNMENT inside it
+* @param[in]    buff_size: size of buff in bytes
+* @param[in]    obj_size: size of one object in bytes
+* @param[in]    num_of_objs: number of objects, at most
+*               EZ_POOL_LOCK_FREE_MAX_OBJS in lock-free mode
+* @param[in]    lock_free: true to select the lock-free mode
+* @return       true if success, else false
+*
+* @pre None
+* @post None
+*
+* \b Example
+* @code
+* static uint32_t buff[EZ_POOL_BUFFER_WORDS(sizeof(Header), 32)];
+* ezPool pool;
+* ezPool_Init(&pool, buff, sizeof(buff), sizeof(Header), 32, false);
+* @endcode
+*
+*****************************************************************************/
+bool ezPool_Init(ezPool *pool,
+                 void *buff,
+                 uint32_t buff_size,
+                 uint32_t obj_size,
+                 uint32_t num_of_objs,
+                 bool lock_free);
+
+
+/*****************************************************************************
+* Function : ezPool_Alloc
+*//**
+* @brief Take one object from the pool
+*
+* @details The content of the object is undefined.
+*
+* @param[in]    pool: pointer to the pool
+* @return       pointer to the object, NULL if the pool is empty
+*
+* @pre pool is initialized
+* @post None
+*
+* \b Example
+* @code
+* Header *header = (Header *)ezPool_Alloc(&pool);
+* @endcode
+*
+* @see ezPool_Free
+*
+*****************************************************************************/
+void *ezPool_Alloc(ezPool *pool);
+
+
+/*****************************************************************************
+* Function : ezPool_Free
+*//**
+* @brief Return an object to the pool
+*
+* @details
+*
+* @param[in]    pool: pointer to the pool
+* @param[in]    obj: object returned by ezPool_Alloc
+* @return       true if success, false if obj does not belong to the pool or
+*               is not allocated (bitmap mode)
+*
+* @pre pool is initialized
+* @post None
+*
+* \b Example
+* @code
+* ezPool_Free(&pool, header);
+* @endcode
+*
+* @see ezPool_Alloc
+*
+*****************************************************************************/
+bool ezPool_Free(ezPool *pool, void *obj);
+
+
+/*****************************************************************************
+* Function : ezPool_GetNumOfFree
+*//**
+* @brief Return the number of free objects
+*
+* @details Approximate while other tasks use a lock-free pool.
+*
+* @param[in]    pool: pointer to the pool
+* @return       number of free objects
+*
+* @pre pool is initialized
+* @post None
+*
+* \b Example
+* @code
+* uint32_t count = ezPool_GetNumOfFree(&pool);
+* @endcode
+*
+*****************************************************************************/
+uint32_t ezPool_GetNumOfFree(ezPool *pool);
+
+#endif /* EZ_POOL == 1U */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _EZ_POOL_H */
+
+/* End of file */
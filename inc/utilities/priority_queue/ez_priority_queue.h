@@ -0,0 +1,324 @@
+/*****************************************************************************
+* Filename:         ez_priority_queue.h
+* Author:           Hai Nguyen
+* Original Date:    16.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+
+/** @file   ez_priority_queue.h
+ *  @author Hai Nguyen
+ *  @date   16.10.2026
+ *  @brief  Public API of the priority queue
+ *
+ *  @details Binary min-heap of fixed-size elements over a caller-supplied
+ *  buffer. The element with the lowest priority value is popped first,
+ *  elements of equal priority in the order they were pushed. Push and pop
+ *  take O(log n), the data of an element is never moved.
+ */
+
+#ifndef _EZ_PRIORITY_QUEUE_H
+#define _EZ_PRIORITY_QUEUE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*****************************************************************************
+* Includes
+*****************************************************************************/
+#if (EZ_BUILD_WITH_CMAKE == 0U)
+#include "ez_target_config.h"
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#if (EZ_PRIORITY_QUEUE == 1U)
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+#ifndef CONFIG_EZ_PRIORITY_QUEUE_ALIGNMENT
+/** @brief Alignment of the data of an element, a power of two and at least
+ *  4. The default suits any element type, including pointers, uint64_t and
+ *  double
+ */
+#ifdef __cplusplus
+#define CONFIG_EZ_PRIORITY_QUEUE_ALIGNMENT  ((uint32_t)alignof(max_align_t))
+#else
+#define CONFIG_EZ_PRIORITY_QUEUE_ALIGNMENT  ((uint32_t)_Alignof(max_align_t))
+#endif
+#endif
+
+/** @brief Round a size up to CONFIG_EZ_PRIORITY_QUEUE_ALIGNMENT */
+#define EZ_PRIORITY_QUEUE_ALIGN_UP(size) \
+    ((((uint32_t)(size)) + CONFIG_EZ_PRIORITY_QUEUE_ALIGNMENT - 1U) \
+     & ~(CONFIG_EZ_PRIORITY_QUEUE_ALIGNMENT - 1U))
+
+/** @brief Number of uint32_t of one element: priority, sequence number and
+ *  position in the heap, followed by the data, each rounded up to the
+ *  alignment
+ */
+#define EZ_PRIORITY_QUEUE_SLOT_WORDS(elem_size) \
+    ((EZ_PRIORITY_QUEUE_ALIGN_UP(3U * sizeof(uint32_t)) \
+      + EZ_PRIORITY_QUEUE_ALIGN_UP(elem_size)) / sizeof(uint32_t))
+
+/** @brief Size of the heap in bytes, rounded up to the alignment so that the
+ *  first element is aligned
+ */
+#define EZ_PRIORITY_QUEUE_HEAP_SIZE(capacity) \
+    EZ_PRIORITY_QUEUE_ALIGN_UP((uint32_t)(capacity) * sizeof(uint32_t))
+
+/** @brief Number of uint32_t needed for the buffer of a priority queue: the
+ *  heap followed by the elements, plus room to align the start of a 4-byte
+ *  aligned buffer to CONFIG_EZ_PRIORITY_QUEUE_ALIGNMENT. Declaring the
+ *  buffer as uint32_t array guarantees the required alignment.
+ *
+ *  \b Example
+ *  @code
+ *  static uint32_t buff[EZ_PRIORITY_QUEUE_BUFFER_WORDS(sizeof(Job), 16)];
+ *  @endcode
+ */
+#define EZ_PRIORITY_QUEUE_BUFFER_WORDS(elem_size, capacity) \
+    (((CONFIG_EZ_PRIORITY_QUEUE_ALIGNMENT - sizeof(uint32_t)) \
+      + EZ_PRIORITY_QUEUE_HEAP_SIZE(capacity)) / sizeof(uint32_t) \
+     + ((uint32_t)(capacity) * EZ_PRIORITY_QUEUE_SLOT_WORDS(elem_size)))
+
+
+/*****************************************************************************
+* Component Typedefs
+*****************************************************************************/
+/** @brief Data structure of a priority queue
+ */
+typedef struct
+{
+    uint32_t *heap;
+    /**< slot indices, [0, count) form the heap, [count, capacity) are free*/
+    uint32_t *slots;
+    /**< element storage, aligned to CONFIG_EZ_PRIORITY_QUEUE_ALIGNMENT*/
+    uint32_t slot_words;
+    /**< distance between two slots in uint32_t*/
+    uint32_t elem_size;
+    /**< size of the data of an element in bytes*/
+    uint32_t capacity;
+    /**< maximum number of elements*/
+    uint32_t count;
+    /**< number of elements in the queue*/
+    uint32_t next_seq;
+    /**< sequence number of the next pushed element*/
+}ezPriorityQueue;
+
+/** @brief Reference to an element in the queue, returned by
+ *  ezPriorityQueue_Push and used by ezPriorityQueue_DecreaseKey
+ */
+typedef uint32_t ezPriorityQueueHandle;
+
+
+/*****************************************************************************
+* Component Variable Definitions
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Function Prototypes
+*****************************************************************************/
+
+/*****************************************************************************
+* Function : ezPriorityQueue_Init
+*//**
+* @brief Initialize the priority queue over a caller-supplied buffer
+*
+* @details The priority queue is not thread-safe.
+*
+* @param[in]    pq: pointer to the priority queue
+* @param[in]    buff: storage, 4-byte aligned, at least
+*               EZ_PRIORITY_QUEUE_BUFFER_WORDS(elem_size, capacity) words.
+*               The queue aligns the start itself
+* @param[in]    buff_size: size of buff in bytes
+* @param[in]    elem_size: size of one element in bytes
+* @param[in]    capacity: maximum number of elements
+* @return       true if success, else false
+*
+* @pre None
+* @post The priority queue is empty
+*
+* \b Example
+* @code
+* static uint32_t buff[EZ_PRIORITY_QUEUE_BUFFER_WORDS(sizeof(Job), 16)];
+* ezPriorityQueue jobs;
+* ezPriorityQueue_Init(&jobs, buff, sizeof(buff), sizeof(Job), 16);
+* @endcode
+*
+*****************************************************************************/
+bool ezPriorityQueue_Init(ezPriorityQueue *pq,
+                          void *buff,
+                          uint32_t buff_size,
+                          uint32_t elem_size,
+                          uint32_t capacity);
+
+
+/*****************************************************************************
+* Function : ezPriorityQueue_Push
+*//**
+* @brief Copy an element into the queue
+*
+* @details Lower priority values are popped first. Elements with the same
+* priority are popped in the order they were pushed.
+*
+* @param[in]    pq: pointer to the priority queue
+* @param[in]    elem: data of the element, elem_size bytes
+* @param[in]    priority: priority of the element, 0 is the most urgent
+* @param[out]   handle: returns the handle of the element, may be NULL
+* @return       true if success, false if the queue is full or invalid
+*               arguments
+*
+* @pre pq is initialized
+* @post None
+*
+* \b Example
+* @code
+* Job job = { ... };
+* ezPriorityQueueHandle handle;
+* ezPriorityQueue_Push(&jobs, &job, 10, &handle);
+* @endcode
+*
+* @see ezPriorityQueue_Pop, ezPriorityQueue_DecreaseKey
+*
+*****************************************************************************/
+bool ezPriorityQueue_Push(ezPriorityQueue *pq,
+                          const void *elem,
+                          uint32_t priority,
+                          ezPriorityQueueHandle *handle);
+
+
+/*****************************************************************************
+* Function : ezPriorityQueue_Pop
+*//**
+* @brief Copy the most urgent element out of the queue and remove it
+*
+* @details
+*
+* @param[in]    pq: pointer to the priority queue
+* @param[out]   elem: receives the data, elem_size bytes
+* @param[out]   priority: returns the priority of the element, may be NULL
+* @return       true if success, false if the queue is empty or invalid
+*               arguments
+*
+* @pre pq is initialized
+* @post The handle of the element is invalid
+*
+* \b Example
+* @code
+* Job job;
+* while(ezPriorityQueue_Pop(&jobs, &job, NULL))
+* {
+*     RunJob(&job);
+* }
+* @endcode
+*
+* @see ezPriorityQueue_Push
+*
+*****************************************************************************/
+bool ezPriorityQueue_Pop(ezPriorityQueue *pq, void *elem, uint32_t *priority);
+
+
+/*****************************************************************************
+* Function : ezPriorityQueue_Peek
+*//**
+* @brief Return the most urgent element without removing it
+*
+* @details The pointer is valid until the element is popped.
+*
+* @param[in]    pq: pointer to the priority queue
+* @param[out]   priority: returns the priority of the element, may be NULL
+* @return       pointer to the data, NULL if the queue is empty
+*
+* @pre pq is initialized
+* @post None
+*
+* \b Example
+* @code
+* uint32_t priority;
+* if(ezPriorityQueue_Peek(&jobs, &priority) != NULL && priority == 0U)
+* {
+*     ...
+* }
+* @endcode
+*
+*****************************************************************************/
+void *ezPriorityQueue_Peek(ezPriorityQueue *pq, uint32_t *priority);
+
+
+/*****************************************************************************
+* Function : ezPriorityQueue_DecreaseKey
+*//**
+* @brief Make an element in the queue more urgent
+*
+* @details The element keeps its place among the elements of the new priority
+* which were pushed after it. A handle becomes invalid when its element is
+* popped. Once its slot is reused by a later push, the stale handle refers to
+* the new element, so handles must not be kept after the pop.
+*
+* @param[in]    pq: pointer to the priority queue
+* @param[in]    handle: handle returned by ezPriorityQueue_Push
+* @param[in]    priority: new priority, at most the current priority
+* @return       true if success, false if the handle is invalid or priority
+*               is higher than the current priority
+*
+* @pre pq is initialized
+* @post None
+*
+* \b Example
+* @code
+* ezPriorityQueue_DecreaseKey(&jobs, handle, 0);
+* @endcode
+*
+* @see ezPriorityQueue_Push
+*
+*****************************************************************************/
+bool ezPriorityQueue_DecreaseKey(ezPriorityQueue *pq,
+                                 ezPriorityQueueHandle handle,
+                                 uint32_t priority);
+
+
+/*****************************************************************************
+* Function : ezPriorityQueue_GetNumOfElement
+*//**
+* @brief Return the number of elements in the queue
+*
+* @details
+*
+* @param[in]    pq: pointer to the priority queue
+* @return       number of elements, 0 if pq is NULL
+*
+* @pre pq is initialized
+* @post None
+*
+* \b Example
+* @code
+* uint32_t pending = ezPriorityQueue_GetNumOfElement(&jobs);
+* @endcode
+*
+*****************************************************************************/
+uint32_t ezPriorityQueue_GetNumOfElement(ezPriorityQueue *pq);
+
+
+#endif /* EZ_PRIORITY_QUEUE == 1U */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _EZ_PRIORITY_QUEUE_H */
+
+/* End of file */
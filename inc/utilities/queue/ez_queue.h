@@ -36,6 +36,7 @@ extern "C" {
 
 #if (EZ_QUEUE == 1U)
 #include <stdint.h>
+#include <stdbool.h>
 #include "ez_utilities_common.h"
 #include "ez_linked_list.h"
 #include "ez_static_alloc.h"
@@ -44,7 +45,15 @@ extern "C" {
 /*****************************************************************************
 * Module Preprocessor Macros
 *****************************************************************************/
-/* None */
+#ifndef CONFIG_EZ_QUEUE_DRAIN_BATCH
+/** @brief Number of drained elements freed under one acquisition of the lock
+ *  of the memory list. Costs one pointer per element on the stack of
+ *  ezQueue_Drain
+ */
+#define CONFIG_EZ_QUEUE_DRAIN_BATCH     8U
+#endif
+
+#define EZ_QUEUE_DRAIN_ALL              0xFFFFFFFFU /**< Drain every element in the queue */
 
 /*****************************************************************************
 * Module Typedefs
@@ -60,7 +69,10 @@ typedef struct ezQueue ezQueue;
 struct ezQueue
 {
     struct Node q_item_list;    /**< list of queue element */
+    uint32_t num_of_elements;   /**< number of elements linked in q_item_list */
     struct MemList mem_list;    /**< memory list, needed for static memory allocation*/
+    struct MemList *domain;     /**< memory list of the elements, mem_list or
+                                     one shared with other queues */
 };
 
 
@@ -68,6 +80,21 @@ struct ezQueue
  */
 typedef void* ezReservedElement;
 
+
+/** @brief Element passed to ezQueue_PushBatch
+ */
+typedef struct
+{
+    const void *data;   /**< data copied into the queue */
+    uint32_t data_size; /**< size of data */
+}ezQueueBatchElement;
+
+
+/** @brief Callback of ezQueue_Drain, returns true if the element is consumed
+ *  and can be removed, false to stop draining and keep it in the queue
+ */
+typedef bool (*ezQueue_DrainCallback)(void *data, uint32_t data_size, void *context);
+
 /*****************************************************************************
 * Module Variable Definitions
 *****************************************************************************/
@@ -83,9 +110,14 @@ typedef void* ezReservedElement;
 *//** 
 * @brief This function creates a data queue
 *
+* @details The block descriptors are taken from the pool shared by all memory
+* lists, see ezStaticAlloc_InitMemList. Use ezQueue_CreateQueueWithBlocks
+* for a queue which can not be starved by other lists.
+*
 * @param    *queue: (IN)pointer to the a queue structure, see ezQueue
 * @param    *buff: (IN) memory buffer providind to the queue to work
-* @param    *buff_size: (IN)size of the memory buffer
+* @param    *buff_size: (IN)size of the memory buffer, at most
+*                       EZ_STATIC_ALLOC_MAX_SIZE
 * @return   ezSUCCESS or ezFAIL
 *
 * @pre None
@@ -105,6 +137,85 @@ typedef void* ezReservedElement;
 ezSTATUS ezQueue_CreateQueue(ezQueue *queue, uint8_t *buff, uint32_t buff_size);
 
 
+/*****************************************************************************
+* Function : ezQueue_CreateQueueWithBlocks
+*//** 
+* @brief This function creates a data queue with a given number of block
+* descriptors
+*
+* @details The queue uses only its own descriptors, so other memory lists
+* can not exhaust them. Every element takes one descriptor, and a free gap
+* between elements one more, so num_of_blocks limits the number of elements.
+* The descriptors are taken from blocks, which leaves all of buff for the
+* elements, or carved from the beginning of buff if blocks is NULL, see
+* ezStaticAlloc_InitMemListWithBlocks.
+*
+* @param    *queue: (IN)pointer to the a queue structure, see ezQueue
+* @param    *buff: (IN) memory buffer providind to the queue to work
+* @param    *buff_size: (IN)size of the memory buffer, at most
+*                       EZ_STATIC_ALLOC_MAX_SIZE
+* @param    *blocks: (IN)array of num_of_blocks descriptors or NULL
+* @param    num_of_blocks: (IN)number of descriptors
+* @return   ezSUCCESS or ezFAIL
+*
+* @pre None
+* @post None
+*
+* @code
+* ezQueue queue;
+* static struct MemBlock queue_blocks[8];
+* static uint8_t queue_buff[256];
+* ezSTATUS status = ezQueue_CreateQueueWithBlocks(&queue, queue_buff,
+*                                                 sizeof(queue_buff),
+*                                                 queue_blocks, 8);
+* @endcode
+*
+* @see ezQueue_CreateQueue
+*
+*****************************************************************************/
+ezSTATUS ezQueue_CreateQueueWithBlocks(ezQueue *queue,
+                                       uint8_t *buff,
+                                       uint32_t buff_size,
+                                       struct MemBlock *blocks,
+                                       uint16_t num_of_blocks);
+
+
+/*****************************************************************************
+* Function : ezQueue_CreateQueueShared
+*//** 
+* @brief This function creates a queue allocating its elements from a memory
+* list shared with other queues
+*
+* @details Queues sharing a memory list form a domain, ezQueue_MoveFront
+* moves elements between them without copying. The queues compete for the
+* memory of the list. If the queues are used by different tasks, the memory
+* list must be protected with ezStaticAlloc_SetLock, and each queue by its
+* user.
+*
+* @param    *queue: (IN)pointer to the a queue structure, see ezQueue
+* @param    *domain: (IN)initialized memory list
+* @return   ezSUCCESS or ezFAIL
+*
+* @pre domain is initialized
+* @post None
+*
+* @code
+* static uint8_t pipeline_buff[1024];
+* static ezmMemList pipeline;
+* static ezQueue rx_queue;
+* static ezQueue work_queue;
+*
+* ezStaticAlloc_InitMemList(&pipeline, pipeline_buff, sizeof(pipeline_buff));
+* ezQueue_CreateQueueShared(&rx_queue, &pipeline);
+* ezQueue_CreateQueueShared(&work_queue, &pipeline);
+* @endcode
+*
+* @see ezQueue_MoveFront
+*
+*****************************************************************************/
+ezSTATUS ezQueue_CreateQueueShared(ezQueue *queue, ezmMemList *domain);
+
+
 /*****************************************************************************
 * Function : ezQueue_PopFront
 *//** 
@@ -167,11 +278,13 @@ ezSTATUS ezQueue_PopBack(ezQueue *queue);
 * queue user must call ezQueue_PushReservedElement(). In case this reserved
 * element is not needed, the user MUST call ezQueue_ReleaseReservedElement()
 * to "free" the element. This function gives the ability to block the memory
-* first, and let the user to write the data into the queue later.
+* first, and let the user to write the data into the queue later. A data_size
+* of 0 reserves an element without data, e.g. for a notification whose
+* meaning is carried by the element itself.
 *
 * @param    *queue: (IN)pointer to the a queue structure, see ezQueue
 * @param    **data: (IN)pointer to the reserve memory block
-* @param    data_size: (IN)size of the reserve memeory
+* @param    data_size: (IN)size of the reserve memeory, may be 0
 * @return   NULL if fail
 *
 * @pre queue must be initialized
@@ -195,6 +308,44 @@ ezReservedElement ezQueue_ReserveElement(ezQueue* queue, void **data, uint32_t d
 
 
 
+/*****************************************************************************
+* Function : ezQueue_ReserveElementAligned
+*//** 
+* @brief This function reserves an element with aligned data
+*
+* @details Same as ezQueue_ReserveElement, but the data of the element starts
+* at a multiple of alignment, e.g. for DMA transfers. The bookkeeping of the
+* element is stored in front of the data, padded up to the alignment.
+*
+* @param    *queue: (IN)pointer to the a queue structure, see ezQueue
+* @param    **data: (OUT)pointer to the reserve memory block
+* @param    data_size: (IN)size of the reserve memeory
+* @param    alignment: (IN)power of two, see ezStaticAlloc_MallocAligned
+* @return   NULL if fail
+*
+* @pre queue must be initialized
+* @post None
+*
+* @code
+* ezReservedElement elem;
+* uint8_t *buff = NULL;
+*
+* elem = ezQueue_ReserveElementAligned(&queue, (void**)&buff, 64, 32);
+* if(elem != NULL)
+* {
+*     StartDmaRead(buff, 64);
+* }
+* @endcode
+*
+* @see ezQueue_ReserveElement, ezQueue_PushReservedElement
+*
+*****************************************************************************/
+ezReservedElement ezQueue_ReserveElementAligned(ezQueue *queue,
+                                                void **data,
+                                                uint32_t data_size,
+                                                uint32_t alignment);
+
+
 /*****************************************************************************
 * Function : ezQueue_PushReservedElement
 *//** 
@@ -264,6 +415,117 @@ ezSTATUS ezQueue_ReleaseReservedElement(ezQueue *queue, ezReservedElement elemen
 ezSTATUS ezQueue_Push(ezQueue* queue, void *data, uint32_t data_size);
 
 
+/*****************************************************************************
+* Function : ezQueue_PushBatch
+*//** 
+* @brief This function copies several elements to the back of the queue
+*
+* @details Either all elements are pushed in the given order or none. The
+* elements are linked to the queue in one step after all of them are
+* allocated.
+*
+* @param    *queue: (IN)pointer to the a queue structure, see ezQueue
+* @param    *elements: (IN)data and size of every element
+* @param    num_of_elements: (IN)number of elements
+* @return   ezSUCCESS if all elements are pushed
+*           ezFAIL: if the queue is full or invalid function arguments, the
+*           queue is unchanged
+*
+* @pre queue is initialized
+* @post None
+*
+* @code
+* uint32_t code = 42;
+* ezQueueBatchElement elements[] = {
+*     { &code, sizeof(code) },
+*     { payload, payload_size },
+* };
+* ezSTATUS status = ezQueue_PushBatch(&queue, elements, 2);
+* @endcode
+*
+* @see ezQueue_Push, ezQueue_Drain
+*
+*****************************************************************************/
+ezSTATUS ezQueue_PushBatch(ezQueue *queue,
+                           const ezQueueBatchElement *elements,
+                           uint32_t num_of_elements);
+
+
+/*****************************************************************************
+* Function : ezQueue_Drain
+*//** 
+* @brief This function passes the front elements to a callback and removes
+* them from the queue
+*
+* @details At most max_items elements, and at most the elements which are in
+* the queue when the function is called, so elements pushed by the callback
+* are left for the next call. The memory of the consumed elements is freed
+* in batches of CONFIG_EZ_QUEUE_DRAIN_BATCH, so a push from the callback may
+* find less free memory than after a pop. The callback must not pop elements
+* from the queue.
+*
+* @param    *queue: (IN)pointer to the a queue structure, see ezQueue
+* @param    max_items: (IN)maximum number of elements, EZ_QUEUE_DRAIN_ALL for
+*                      all elements
+* @param    callback: (IN)called with the data of every element
+* @param    *context: (IN)passed to the callback
+* @return   number of elements removed from the queue
+*
+* @pre queue is initialized
+* @post None
+*
+* @code
+* static bool HandleEvent(void *data, uint32_t data_size, void *context)
+* {
+*     Dispatch((ezEventBus_t*)context, data, data_size);
+*     return true;
+* }
+*
+* (void)ezQueue_Drain(&queue, 16, HandleEvent, &event_bus);
+* @endcode
+*
+* @see ezQueue_PopFront, ezQueue_PushBatch
+*
+*****************************************************************************/
+uint32_t ezQueue_Drain(ezQueue *queue,
+                       uint32_t max_items,
+                       ezQueue_DrainCallback callback,
+                       void *context);
+
+
+/*****************************************************************************
+* Function : ezQueue_MoveFront
+*//** 
+* @brief This function moves the front element of a queue to the back of
+* another queue
+*
+* @details If both queues allocate from the same memory list, see
+* ezQueue_CreateQueueShared, the element is relinked and its data stays in
+* place, the cost does not depend on its size. Pointers to the data from
+* ezQueue_GetFront stay valid. Otherwise the data is copied into a new
+* element of the destination queue.
+*
+* @param    *to: (IN)destination queue
+* @param    *from: (IN)source queue
+* @return   ezSUCCESS if success
+*           ezFAIL: if from is empty, to is full, to and from are the same
+*           queue or invalid function arguments. Both queues are unchanged
+*
+* @pre both queues are initialized
+* @post None
+*
+* @code
+* while(ezQueue_MoveFront(&work_queue, &rx_queue) == ezSUCCESS)
+* {
+* }
+* @endcode
+*
+* @see ezQueue_CreateQueueShared
+*
+*****************************************************************************/
+ezSTATUS ezQueue_MoveFront(ezQueue *to, ezQueue *from);
+
+
 /*****************************************************************************
 * Function : ezQueue_GetFront
 *//** 
@@ -333,7 +595,8 @@ ezSTATUS ezQueue_GetBack(ezQueue* queue, void **data, uint32_t *data_size);
 *//** 
 * @brief ezQueue_GetNumOfElement
 *
-* @details
+* @details Returns a counter maintained on push and pop, the queue is not
+* walked. Reserved elements are not counted until they are pushed.
 *
 * @param    *queue: (IN)pointer to the a queue structure, see ezQueue
 * @return   Number of elements
@@ -0,0 +1,193 @@
+/*****************************************************************************
+* Filename:         ez_static_queue.h
+* Author:           Hai Nguyen
+* Original Date:    16.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+
+/** @file   ez_static_queue.h
+ *  @author Hai Nguyen
+ *  @date   16.10.2026
+ *  @brief  Type-safe fixed-capacity queue generated by a macro
+ *
+ *  @details EZ_QUEUE_DEFINE generates a queue type which stores its elements
+ *  inline in an array, together with static inline functions working on it.
+ *  The element type and the capacity are known to the compiler, so a push or
+ *  a pop is index arithmetic plus a struct assignment, without allocation,
+ *  size checks or memcpy of a run-time size. Use ezQueue for elements of
+ *  different sizes and ez::StaticQueue (ez_static_queue.hpp) from C++.
+ */
+
+#ifndef _EZ_STATIC_QUEUE_H
+#define _EZ_STATIC_QUEUE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*****************************************************************************
+* Includes
+*****************************************************************************/
+#if (EZ_BUILD_WITH_CMAKE == 0U)
+#include "ez_target_config.h"
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#if (EZ_QUEUE == 1U)
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+
+/*****************************************************************************
+* Function : EZ_QUEUE_DEFINE
+*//**
+* @brief Generate a queue type and its functions for one element type
+*
+* @details Generates the struct type name, holding capacity elements of type,
+* and the functions
+*   - void name_Init(name *q)
+*   - bool name_Push(name *q, const type *elem)
+*   - bool name_Pop(name *q, type *elem)
+*   - type *name_Front(name *q)
+*   - uint32_t name_GetNumOfElement(const name *q)
+*   - bool name_IsEmpty(const name *q)
+*   - bool name_IsFull(const name *q)
+*
+* Push copies the element behind the last one, Pop copies the front element
+* out and removes it, both return false if the queue is full or empty. Front
+* returns the front element in place, NULL if the queue is empty. The
+* capacity does not need to be a power of two. The generated functions check
+* no pointer for NULL and are not thread-safe. Use the macro once per type at
+* file scope, e.g. in the header shared by producer and consumer.
+*
+* @param[in]    name: name of the generated type, prefix of the functions
+* @param[in]    type: element type, must be assignable
+* @param[in]    capacity: maximum number of elements, greater than 0
+* @return       None
+*
+* @pre None
+* @post None
+*
+* \b Example
+* @code
+* EZ_QUEUE_DEFINE(JobQueue, Job, 16)
+*
+* static JobQueue jobs;
+* Job job = { ... };
+*
+* JobQueue_Init(&jobs);
+* JobQueue_Push(&jobs, &job);
+* while(JobQueue_Pop(&jobs, &job))
+* {
+*     RunJob(&job);
+* }
+* @endcode
+*
+*****************************************************************************/
+#define EZ_QUEUE_DEFINE(name, type, capacity)                               \
+    typedef char name##_CapacityCheck[((capacity) > 0) ? 1 : -1];           \
+    typedef struct                                                          \
+    {                                                                       \
+        type elems[capacity];                                               \
+        uint32_t head;                                                      \
+        uint32_t count;                                                     \
+    }name;                                                                  \
+                                                                            \
+    static inline void name##_Init(name *q)                                 \
+    {                                                                       \
+        q->head = 0U;                                                       \
+        q->count = 0U;                                                      \
+    }                                                                       \
+                                                                            \
+    static inline bool name##_Push(name *q, const type *elem)               \
+    {                                                                       \
+        uint32_t tail = q->head + q->count;                                 \
+        if(q->count >= (uint32_t)(capacity))                                \
+        {                                                                   \
+            return false;                                                   \
+        }                                                                   \
+        if(tail >= (uint32_t)(capacity))                                    \
+        {                                                                   \
+            tail -= (uint32_t)(capacity);                                   \
+        }                                                                   \
+        q->elems[tail] = *elem;                                             \
+        q->count++;                                                         \
+        return true;                                                        \
+    }                                                                       \
+                                                                            \
+    static inline bool name##_Pop(name *q, type *elem)                      \
+    {                                                                       \
+        if(q->count == 0U)                                                  \
+        {                                                                   \
+            return false;                                                   \
+        }                                                                   \
+        *elem = q->elems[q->head];                                          \
+        q->head++;                                                          \
+        if(q->head >= (uint32_t)(capacity))                                 \
+        {                                                                   \
+            q->head = 0U;                                                   \
+        }                                                                   \
+        q->count--;                                                         \
+        return true;                                                        \
+    }                                                                       \
+                                                                            \
+    static inline type *name##_Front(name *q)                               \
+    {                                                                       \
+        return (q->count == 0U) ? NULL : &q->elems[q->head];                \
+    }                                                                       \
+                                                                            \
+    static inline uint32_t name##_GetNumOfElement(const name *q)            \
+    {                                                                       \
+        return q->count;                                                    \
+    }                                                                       \
+                                                                            \
+    static inline bool name##_IsEmpty(const name *q)                        \
+    {                                                                       \
+        return q->count == 0U;                                              \
+    }                                                                       \
+                                                                            \
+    static inline bool name##_IsFull(const name *q)                         \
+    {                                                                       \
+        return q->count >= (uint32_t)(capacity);                            \
+    }
+
+
+/*****************************************************************************
+* Component Typedefs
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Component Variable Definitions
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Function Prototypes
+*****************************************************************************/
+/* None */
+
+
+#endif /* EZ_QUEUE == 1U */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _EZ_STATIC_QUEUE_H */
+
+/* End of file */
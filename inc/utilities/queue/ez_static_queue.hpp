@@ -0,0 +1,227 @@
+/*****************************************************************************
+* Filename:         ez_static_queue.hpp
+* Author:           Hai Nguyen
+* Original Date:    16.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+
+/** @file   ez_static_queue.hpp
+ *  @author Hai Nguyen
+ *  @date   16.10.2026
+ *  @brief  Type-safe fixed-capacity queue for C++20
+ *
+ *  @details ez::StaticQueue<T, N> is the C++ counterpart of EZ_QUEUE_DEFINE
+ *  (ez_static_queue.h). The elements live inline in the object, elements
+ *  are constructed on push and destroyed on pop, so T does not need a
+ *  default constructor and move-only types are supported. Nothing is
+ *  allocated on the heap and no exception is thrown by the queue itself.
+ */
+
+#ifndef _EZ_STATIC_QUEUE_HPP
+#define _EZ_STATIC_QUEUE_HPP
+
+/*****************************************************************************
+* Includes
+*****************************************************************************/
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+
+namespace ez
+{
+
+/*****************************************************************************
+* Class : StaticQueue
+*//**
+* @brief Fixed-capacity FIFO queue storing up to N elements of type T inline
+*
+* @details push and emplace return false if the queue is full, pop returns
+* false if it is empty. front and back must only be called on a non-empty
+* queue. The queue is not thread-safe and cannot be copied or moved, since
+* it is meant to be a static or member object shared by its users.
+*
+* \b Example
+* @code
+* static ez::StaticQueue<Job, 16> jobs;
+* Job job;
+*
+* jobs.push(Job{ ... });
+* while(jobs.pop(job))
+* {
+*     RunJob(job);
+* }
+* @endcode
+*
+*****************************************************************************/
+template<typename T, std::size_t N>
+    requires (N > 0U && N <= UINT32_MAX && std::is_nothrow_destructible_v<T>)
+class StaticQueue
+{
+public:
+    StaticQueue() noexcept = default;
+
+    StaticQueue(const StaticQueue &) = delete;
+    StaticQueue &operator=(const StaticQueue &) = delete;
+
+    ~StaticQueue()
+    {
+        clear();
+    }
+
+    /** @brief Copy an element behind the last one
+     */
+    bool push(const T &elem) noexcept(std::is_nothrow_copy_constructible_v<T>)
+    {
+        return emplace(elem);
+    }
+
+    /** @brief Move an element behind the last one
+     */
+    bool push(T &&elem) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        return emplace(std::move(elem));
+    }
+
+    /** @brief Construct an element in place behind the last one
+     */
+    template<typename... Args>
+    bool emplace(Args &&...args) noexcept(std::is_nothrow_constructible_v<T, Args...>)
+    {
+        if(count_ >= N)
+        {
+            return false;
+        }
+
+        std::construct_at(slot(wrap(head_ + count_)), std::forward<Args>(args)...);
+        count_++;
+        return true;
+    }
+
+    /** @brief Move the front element into elem and remove it
+     */
+    bool pop(T &elem) noexcept(std::is_nothrow_move_assignable_v<T>)
+    {
+        if(count_ == 0U)
+        {
+            return false;
+        }
+
+        elem = std::move(*slot(head_));
+        pop_front();
+        return true;
+    }
+
+    /** @brief Remove the front element without reading it
+     */
+    bool pop() noexcept
+    {
+        if(count_ == 0U)
+        {
+            return false;
+        }
+
+        pop_front();
+        return true;
+    }
+
+    T &front() noexcept
+    {
+        return *slot(head_);
+    }
+
+    const T &front() const noexcept
+    {
+        return *slot(head_);
+    }
+
+    T &back() noexcept
+    {
+        return *slot(wrap(head_ + count_ - 1U));
+    }
+
+    const T &back() const noexcept
+    {
+        return *slot(wrap(head_ + count_ - 1U));
+    }
+
+    /** @brief Destroy all elements
+     */
+    void clear() noexcept
+    {
+        while(count_ > 0U)
+        {
+            pop_front();
+        }
+        head_ = 0U;
+    }
+
+    std::uint32_t size() const noexcept
+    {
+        return count_;
+    }
+
+    bool empty() const noexcept
+    {
+        return count_ == 0U;
+    }
+
+    bool full() const noexcept
+    {
+        return count_ >= N;
+    }
+
+    static constexpr std::uint32_t capacity() noexcept
+    {
+        return static_cast<std::uint32_t>(N);
+    }
+
+private:
+    static constexpr std::uint32_t wrap(std::uint32_t index) noexcept
+    {
+        /* index is below 2 * N, a compare is cheaper than a modulo when N is
+         * not a power of two */
+        return (index >= N) ? index - static_cast<std::uint32_t>(N) : index;
+    }
+
+    T *slot(std::uint32_t index) noexcept
+    {
+        return std::launder(reinterpret_cast<T *>(storage_ + (static_cast<std::size_t>(index) * sizeof(T))));
+    }
+
+    const T *slot(std::uint32_t index) const noexcept
+    {
+        return std::launder(reinterpret_cast<const T *>(storage_ + (static_cast<std::size_t>(index) * sizeof(T))));
+    }
+
+    void pop_front() noexcept
+    {
+        std::destroy_at(slot(head_));
+        head_ = wrap(head_ + 1U);
+        count_--;
+    }
+
+    alignas(T) std::byte storage_[N * sizeof(T)];
+    /**< raw storage, [head_, head_ + count_) modulo N hold elements*/
+    std::uint32_t head_ = 0U;
+    /**< index of the front element*/
+    std::uint32_t count_ = 0U;
+    /**< number of elements in the queue*/
+};
+
+} /* namespace ez */
+
+#endif /* _EZ_STATIC_QUEUE_HPP */
+
+/* End of file */
@@ -0,0 +1,412 @@
+/*****************************************************************************
+* Filename:         ez_record_ring.h
+* Author:           Hai Nguyen
+* Original Date:    16.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+
+/** @file   ez_record_ring.h
+ *  @author Hai Nguyen
+ *  @date   16.10.2026
+ *  @brief  Public API of the record ring component
+ *
+ *  @details Stores variable-length records inline in a RingBuffer. Each
+ *  record is a 4-byte length header followed by the payload, padded to a
+ *  multiple of 4 bytes. A record never wraps: if it does not fit before the
+ *  end of the storage, the remaining bytes are marked as padding and the
+ *  record starts at the beginning. Push, pop and peek are O(1) and do not
+ *  allocate memory.
+ */
+
+#ifndef RECORD_RING_H
+#define RECORD_RING_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Includes
+*******************************************************************************/
+#if (EZ_BUILD_WITH_CMAKE == 0U)
+#include "ez_target_config.h"
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ez_ring_buffer.h"
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+#define EZ_RECORD_RING_HEADER_SIZE      4U  /**< size of the length header */
+
+/** @brief Number of bytes a record with a payload of size bytes occupies,
+ *  useful to dimension the storage
+ */
+#define EZ_RECORD_RING_RECORD_SIZE(size) \
+    (EZ_RECORD_RING_HEADER_SIZE + (((size) + 3U) & ~3U))
+
+/*****************************************************************************
+* Component Typedefs
+*****************************************************************************/
+/** @brief Data structure of a record ring
+ */
+typedef struct
+{
+    RingBuffer ring;
+    /**< byte storage holding headers, payloads and padding*/
+    uint32_t num_of_records;
+    /**< number of committed records*/
+    uint32_t dropped_records;
+    /**< number of records lost by overwriting*/
+    ezRingBufferSize_t reserved_size;
+    /**< payload size of the pending reservation*/
+    ezRingBufferSize_t reserved_pad;
+    /**< padding needed in front of the pending reservation*/
+    bool is_reserved;
+    /**< true if a reservation is pending*/
+    bool overwrite;
+    /**< true: drop the oldest records when a new one does not fit*/
+}ezRecordRing;
+
+
+/*****************************************************************************
+* Component Variable Definitions
+*****************************************************************************/
+/* None */
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/*****************************************************************************
+* Function : ezRecordRing_Init
+*//**
+* @brief Initialize the record ring
+*
+* @details The capacity is rounded down to a multiple of 4. If buff is 4-byte
+* aligned, every payload is 4-byte aligned too.
+*
+* @param[in]    record_ring: pointer to the record ring
+* @param[in]    buff: storage of the records
+* @param[in]    size: size of buff
+* @return       true if success, else false
+*
+* @pre None
+* @post None
+*
+* \b Example
+* @code
+* static uint32_t storage[64];
+* ezRecordRing records;
+* ezRecordRing_Init(&records, (uint8_t *)storage, sizeof(storage));
+* @endcode
+*
+*****************************************************************************/
+bool ezRecordRing_Init(ezRecordRing *record_ring, uint8_t *buff, ezRingBufferSize_t size);
+
+
+/*****************************************************************************
+* Function : ezRecordRing_Reserve
+*//**
+* @brief Reserve contiguous space for the payload of a new record
+*
+* @details The caller writes the payload into the returned memory and then
+* calls ezRecordRing_Commit. In overwrite mode the oldest records are dropped
+* until the new record fits. Calling Reserve again replaces the pending
+* reservation.
+*
+* @param[in]    record_ring: pointer to the record ring
+* @param[in]    size: maximum payload size
+* @return       pointer to the payload area, NULL if the record does not fit
+*
+* @pre record ring is initialized
+* @post None
+*
+* \b Example
+* @code
+* uint8_t *payload = ezRecordRing_Reserve(&records, 16);
+* if(payload != NULL)
+* {
+*     ezRingBufferSize_t n = build_frame(payload, 16);
+*     ezRecordRing_Commit(&records, n);
+* }
+* @endcode
+*
+* @see ezRecordRing_Commit
+*
+*****************************************************************************/
+uint8_t *ezRecordRing_Reserve(ezRecordRing *record_ring, ezRingBufferSize_t size);
+
+
+/*****************************************************************************
+* Function : ezRecordRing_Commit
+*//**
+* @brief Publish the pending reservation as a record
+*
+* @details
+*
+* @param[in]    record_ring: pointer to the record ring
+* @param[in]    size: actual payload size, at most the reserved size
+* @return       true if success, false if nothing is reserved or size is too
+*               large
+*
+* @pre ezRecordRing_Reserve returned a valid pointer
+* @post None
+*
+* \b Example
+* @code
+* ezRecordRing_Commit(&records, n);
+* @endcode
+*
+* @see ezRecordRing_Reserve
+*
+*****************************************************************************/
+bool ezRecordRing_Commit(ezRecordRing *record_ring, ezRingBufferSize_t size);
+
+
+/*****************************************************************************
+* Function : ezRecordRing_Push
+*//**
+* @brief Copy data into the record ring as one record
+*
+* @details Zero-length records are allowed.
+*
+* @param[in]    record_ring: pointer to the record ring
+* @param[in]    data: payload, may be NULL if size is 0
+* @param[in]    size: payload size
+* @return       true if success, false if the record does not fit
+*
+* @pre record ring is initialized
+* @post None
+*
+* \b Example
+* @code
+* uint8_t msg[3] = {1, 2, 3};
+* ezRecordRing_Push(&records, msg, sizeof(msg));
+* @endcode
+*
+* @see ezRecordRing_Pop
+*
+*****************************************************************************/
+bool ezRecordRing_Push(ezRecordRing *record_ring, const uint8_t *data, ezRingBufferSize_t size);
+
+
+/*****************************************************************************
+* Function : ezRecordRing_Peek
+*//**
+* @brief Get the oldest record without removing it
+*
+* @details The payload is read in place. It stays valid until the record is
+* consumed or overwritten.
+*
+* @param[in]    record_ring: pointer to the record ring
+* @param[out]   data: pointer to the payload
+* @param[out]   size: payload size
+* @return       true if a record is available, else false
+*
+* @pre record ring is initialized
+* @post None
+*
+* \b Example
+* @code
+* uint8_t *payload;
+* ezRingBufferSize_t size;
+* if(ezRecordRing_Peek(&records, &payload, &size))
+* {
+*     handle(payload, size);
+*     ezRecordRing_Consume(&records);
+* }
+* @endcode
+*
+* @see ezRecordRing_Consume
+*
+*****************************************************************************/
+bool ezRecordRing_Peek(ezRecordRing *record_ring, uint8_t **data, ezRingBufferSize_t *size);
+
+
+/*****************************************************************************
+* Function : ezRecordRing_Consume
+*//**
+* @brief Remove the oldest record
+*
+* @details
+*
+* @param[in]    record_ring: pointer to the record ring
+* @return       true if a record is removed, false if empty
+*
+* @pre record ring is initialized
+* @post None
+*
+* \b Example
+* @code
+* ezRecordRing_Consume(&records);
+* @endcode
+*
+* @see ezRecordRing_Peek
+*
+*****************************************************************************/
+bool ezRecordRing_Consume(ezRecordRing *record_ring);
+
+
+/*****************************************************************************
+* Function : ezRecordRing_Pop
+*//**
+* @brief Copy the oldest record out and remove it
+*
+* @details If the buffer is too small, the record is kept and size is set to
+* the payload size of the record.
+*
+* @param[in]    record_ring: pointer to the record ring
+* @param[out]   data: buffer receiving the payload
+* @param[in,out] size: in: size of data. out: payload size
+* @return       true if a record is popped, else false
+*
+* @pre record ring is initialized
+* @post None
+*
+* \b Example
+* @code
+* uint8_t msg[32];
+* ezRingBufferSize_t size = sizeof(msg);
+* ezRecordRing_Pop(&records, msg, &size);
+* @endcode
+*
+* @see ezRecordRing_Push
+*
+*****************************************************************************/
+bool ezRecordRing_Pop(ezRecordRing *record_ring, uint8_t *data, ezRingBufferSize_t *size);
+
+
+/*****************************************************************************
+* Function : ezRecordRing_GetNumOfRecords
+*//**
+* @brief Return number of stored records
+*
+* @details
+*
+* @param[in]    record_ring: pointer to the record ring
+* @return       number of records
+*
+* @pre record ring is initialized
+* @post None
+*
+* \b Example
+* @code
+* uint32_t count = ezRecordRing_GetNumOfRecords(&records);
+* @endcode
+*
+*****************************************************************************/
+uint32_t ezRecordRing_GetNumOfRecords(ezRecordRing *record_ring);
+
+
+/*****************************************************************************
+* Function : ezRecordRing_Reset
+*//**
+* @brief Drop all records and the pending reservation
+*
+* @details The dropped records counter is not cleared.
+*
+* @param[in]    record_ring: pointer to the record ring
+* @return       None
+*
+* @pre record ring is initialized
+* @post None
+*
+* \b Example
+* @code
+* ezRecordRing_Reset(&records);
+* @endcode
+*
+*****************************************************************************/
+void ezRecordRing_Reset(ezRecordRing *record_ring);
+
+
+/*****************************************************************************
+* Function : ezRecordRing_SetOverwrite
+*//**
+* @brief Enable or disable dropping the oldest records on overflow
+*
+* @details Records are always dropped whole. Disabled after init.
+*
+* @param[in]    record_ring: pointer to the record ring
+* @param[in]    enable: true to overwrite the oldest records
+* @return       None
+*
+* @pre record ring is initialized
+* @post None
+*
+* \b Example
+* @code
+* ezRecordRing_SetOverwrite(&records, true);
+* @endcode
+*
+* @see ezRecordRing_GetDroppedRecords
+*
+*****************************************************************************/
+void ezRecordRing_SetOverwrite(ezRecordRing *record_ring, bool enable);
+
+
+/*****************************************************************************
+* Function : ezRecordRing_GetDroppedRecords
+*//**
+* @brief Return number of records lost by overwriting
+*
+* @details
+*
+* @param[in]    record_ring: pointer to the record ring
+* @return       number of dropped records
+*
+* @pre record ring is initialized
+* @post None
+*
+* \b Example
+* @code
+* uint32_t lost = ezRecordRing_GetDroppedRecords(&records);
+* @endcode
+*
+* @see ezRecordRing_SetOverwrite
+*
+*****************************************************************************/
+uint32_t ezRecordRing_GetDroppedRecords(ezRecordRing *record_ring);
+
+
+/*****************************************************************************
+* Function : ezRecordRing_ResetDroppedRecords
+*//**
+* @brief Clear the dropped records counter
+*
+* @details
+*
+* @param[in]    record_ring: pointer to the record ring
+* @return       None
+*
+* @pre record ring is initialized
+* @post None
+*
+* \b Example
+* @code
+* ezRecordRing_ResetDroppedRecords(&records);
+* @endcode
+*
+* @see ezRecordRing_GetDroppedRecords
+*
+*****************************************************************************/
+void ezRecordRing_ResetDroppedRecords(ezRecordRing *record_ring);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RECORD_RING_H */
+
+/* End of file */
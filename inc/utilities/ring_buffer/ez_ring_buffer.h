@@ -41,28 +41,60 @@ extern "C" {
 /*****************************************************************************
 * Component Preprocessor Macros
 *****************************************************************************/
-/* None */
+#define EZ_RING_BUFFER_NUM_OF_REGIONS   2U  /**< max number of contiguous regions, 2 when wrapping */
 
 /*****************************************************************************
 * Component Typedefs
 *****************************************************************************/
+#if (EZ_RING_BUFFER_32BIT == 1U)
+typedef uint32_t ezRingBufferSize_t;    /**< capacity up to 4 GiB */
+#else
+typedef uint16_t ezRingBufferSize_t;    /**< capacity up to 64 KiB */
+#endif
+
 /** @brief Data structure of a ring buffer
+ *
+ *  When the capacity is a power of two, head_index and tail_index run freely
+ *  and are masked with index_mask on access, so no wrap branch is needed.
+ *  Otherwise they are kept within [0, capacity].
  */
 typedef struct
 {
     uint8_t *buff;
     /**< pointer to the data buffer*/
-    uint16_t capacity;
+    ezRingBufferSize_t capacity;
     /**< size of the buffer*/
-    uint16_t head_index;
+    ezRingBufferSize_t head_index;
     /**< buffer head*/
-    uint16_t tail_index;
+    ezRingBufferSize_t tail_index;
     /**< buffer tail*/
-    uint16_t written_byte_count;
+    ezRingBufferSize_t written_byte_count;
     /**< number of byte written*/
+    ezRingBufferSize_t index_mask;
+    /**< capacity - 1 if capacity is a power of two, otherwise 0*/
+    uint32_t dropped_bytes;
+    /**< number of bytes lost by overwriting, see ezRingBuffer_SetOverwrite*/
+    bool overwrite;
+    /**< true: push overwrites the oldest bytes when the buffer is full*/
+#if (EZ_RING_BUFFER_MIRROR == 1U)
+    bool is_mirrored;
+    /**< storage is mapped twice back to back, see ezRingBuffer_InitMirrored*/
+#endif
 }RingBuffer;
 
 
+/** @brief Contiguous region inside the ring buffer storage, used by the
+ *  zero-copy API
+ */
+typedef struct
+{
+    uint8_t *data;
+    /**< pointer to the first byte of the region*/
+    ezRingBufferSize_t size;
+    /**< number of bytes in the region, 0 if unused*/
+}ezRingBufferRegion;
+
+
 /*****************************************************************************
 * Component Variable Definitions
 *****************************************************************************/
@@ -81,7 +113,8 @@ typedef struct
 *
 * @param[in]    ring_buff: pointer to the ring buffer
 * @param[in]    buff: pointer of buffer holding data
-* @param[in]    size: size of buff
+* @param[in]    size: size of buff. A power of two enables the masked fast
+*               path
 * @return       true if success, else false
 *
 * @pre None
@@ -96,7 +129,7 @@ typedef struct
 * @see
 *
 *****************************************************************************/
-bool ezRingBuffer_Init(RingBuffer *ring_buff, uint8_t *buff, uint16_t size);
+bool ezRingBuffer_Init(RingBuffer *ring_buff, uint8_t *buff, ezRingBufferSize_t size);
 
 
 /*****************************************************************************
@@ -158,7 +191,9 @@ bool ezRingBuffer_IsFull(RingBuffer *ring_buff);
 *//** 
 * @brief Push data into the ring buffet
 *
-* @details
+* @details By default only the bytes that fit are pushed. In overwrite mode
+* the oldest bytes are dropped to make room, so all bytes (at most the last
+* capacity bytes of data) are pushed.
 *
 * @param[in]    ring_buff: pointer to the ring buffer
 * @param[in]    data: pointer to the pushed data
@@ -179,7 +214,7 @@ bool ezRingBuffer_IsFull(RingBuffer *ring_buff);
 * @see ezRingBuffer_Init
 *
 *****************************************************************************/
-uint16_t ezRingBuffer_Push(RingBuffer * ring_buff, uint8_t *data, uint16_t size);
+ezRingBufferSize_t ezRingBuffer_Push(RingBuffer * ring_buff, uint8_t *data, ezRingBufferSize_t size);
 
 
 /*****************************************************************************
@@ -208,7 +243,7 @@ uint16_t ezRingBuffer_Push(RingBuffer * ring_buff, uint8_t *data, uint16_t size)
 * @see ezRingBuffer_Init
 *
 *****************************************************************************/
-uint16_t ezRingBuffer_Pop(RingBuffer *ring_buff, uint8_t *data, uint16_t size);
+ezRingBufferSize_t ezRingBuffer_Pop(RingBuffer *ring_buff, uint8_t *data, ezRingBufferSize_t size);
 
 
 /*****************************************************************************
@@ -256,7 +291,255 @@ void ezRingBuffer_Reset(RingBuffer *ring_buff);
 * @see RingBuffer_Init
 *
 *****************************************************************************/
-uint16_t ezRingBuffer_GetAvailableMemory( RingBuffer *ring_buff);
+ezRingBufferSize_t ezRingBuffer_GetAvailableMemory( RingBuffer *ring_buff);
+
+
+/*****************************************************************************
+* Function : ezRingBuffer_Reserve
+*//** 
+* @brief Get the free space of the ring buffer as contiguous regions
+*
+* @details The caller writes directly into the returned regions (e.g. with a
+* DMA transfer or read()) and then makes the data visible with
+* ezRingBuffer_Commit. regions[0] starts at the head, regions[1] is only
+* used when the free space wraps around the end of the storage.
+*
+* @param[in]    ring_buff: pointer to the ring buffer
+* @param[out]   regions: array of EZ_RING_BUFFER_NUM_OF_REGIONS regions
+* @return       Total number of writable bytes
+*
+* @pre a RingBuffer is exsiting
+* @post None
+*
+* \b Example
+* @code
+* ezRingBufferRegion regions[EZ_RING_BUFFER_NUM_OF_REGIONS];
+* ezRingBuffer_Reserve(&buffer, regions);
+* ezRingBufferSize_t n = uart_read(regions[0].data, regions[0].size);
+* ezRingBuffer_Commit(&buffer, n);
+* @endcode
+*
+* @see ezRingBuffer_Commit
+*
+*****************************************************************************/
+ezRingBufferSize_t ezRingBuffer_Reserve(RingBuffer *ring_buff,
+                                        ezRingBufferRegion regions[EZ_RING_BUFFER_NUM_OF_REGIONS]);
+
+
+/*****************************************************************************
+* Function : ezRingBuffer_Commit
+*//** 
+* @brief Make bytes written into the reserved regions part of the buffer
+*
+* @details
+*
+* @param[in]    ring_buff: pointer to the ring buffer
+* @param[in]    size: number of bytes written, starting at regions[0]
+* @return       true if success, false if size exceeds the free space
+*
+* @pre ezRingBuffer_Reserve is called
+* @post None
+*
+* \b Example
+* @code
+* ezRingBuffer_Commit(&buffer, n);
+* @endcode
+*
+* @see ezRingBuffer_Reserve
+*
+*****************************************************************************/
+bool ezRingBuffer_Commit(RingBuffer *ring_buff, ezRingBufferSize_t size);
+
+
+/*****************************************************************************
+* Function : ezRingBuffer_Peek
+*//** 
+* @brief Get the stored data as contiguous regions without removing it
+*
+* @details regions[0] starts at the tail, regions[1] is only used when the
+* stored data wraps around the end of the storage. The data stays in the
+* buffer until ezRingBuffer_Consume is called.
+*
+* @param[in]    ring_buff: pointer to the ring buffer
+* @param[out]   regions: array of EZ_RING_BUFFER_NUM_OF_REGIONS regions
+* @return       Total number of readable bytes
+*
+* @pre a RingBuffer is exsiting
+* @post None
+*
+* \b Example
+* @code
+* ezRingBufferRegion regions[EZ_RING_BUFFER_NUM_OF_REGIONS];
+* ezRingBuffer_Peek(&buffer, regions);
+* ezRingBufferSize_t n = parse(regions[0].data, regions[0].size);
+* ezRingBuffer_Consume(&buffer, n);
+* @endcode
+*
+* @see ezRingBuffer_Consume
+*
+*****************************************************************************/
+ezRingBufferSize_t ezRingBuffer_Peek(RingBuffer *ring_buff,
+                                     ezRingBufferRegion regions[EZ_RING_BUFFER_NUM_OF_REGIONS]);
+
+
+/*****************************************************************************
+* Function : ezRingBuffer_Consume
+*//** 
+* @brief Remove bytes from the tail of the ring buffer without copying
+*
+* @details
+*
+* @param[in]    ring_buff: pointer to the ring buffer
+* @param[in]    size: number of bytes to remove
+* @return       true if success, false if size exceeds the stored data
+*
+* @pre a RingBuffer is exsiting
+* @post None
+*
+* \b Example
+* @code
+* ezRingBuffer_Consume(&buffer, n);
+* @endcode
+*
+* @see ezRingBuffer_Peek
+*
+*****************************************************************************/
+bool ezRingBuffer_Consume(RingBuffer *ring_buff, ezRingBufferSize_t size);
+
+
+/*****************************************************************************
+* Function : ezRingBuffer_SetOverwrite
+*//** 
+* @brief Enable or disable the overwrite-oldest mode
+*
+* @details In overwrite mode ezRingBuffer_Push never blocks the producer on a
+* full buffer: the oldest bytes are discarded and counted in dropped_bytes.
+* Disabled after ezRingBuffer_Init.
+*
+* @param[in]    ring_buff: pointer to the ring buffer
+* @param[in]    enable: true to overwrite the oldest data on overflow
+* @return       None
+*
+* @pre a RingBuffer is exsiting
+* @post None
+*
+* \b Example
+* @code
+* ezRingBuffer_SetOverwrite(&buffer, true);
+* @endcode
+*
+* @see ezRingBuffer_GetDroppedBytes
+*
+*****************************************************************************/
+void ezRingBuffer_SetOverwrite(RingBuffer *ring_buff, bool enable);
+
+
+/*****************************************************************************
+* Function : ezRingBuffer_GetDroppedBytes
+*//** 
+* @brief Return number of bytes lost by overwriting
+*
+* @details The counter is not cleared by ezRingBuffer_Reset.
+*
+* @param[in]    ring_buff: pointer to the ring buffer
+* @return       Number of dropped bytes since init or the last
+*               ezRingBuffer_ResetDroppedBytes
+*
+* @pre a RingBuffer is exsiting
+* @post None
+*
+* \b Example
+* @code
+* uint32_t lost = ezRingBuffer_GetDroppedBytes(&buffer);
+* @endcode
+*
+* @see ezRingBuffer_SetOverwrite
+*
+*****************************************************************************/
+uint32_t ezRingBuffer_GetDroppedBytes(RingBuffer *ring_buff);
+
+
+/*****************************************************************************
+* Function : ezRingBuffer_ResetDroppedBytes
+*//** 
+* @brief Clear the dropped bytes counter
+*
+* @details
+*
+* @param[in]    ring_buff: pointer to the ring buffer
+* @return       None
+*
+* @pre a RingBuffer is exsiting
+* @post None
+*
+* \b Example
+* @code
+* ezRingBuffer_ResetDroppedBytes(&buffer);
+* @endcode
+*
+* @see ezRingBuffer_GetDroppedBytes
+*
+*****************************************************************************/
+void ezRingBuffer_ResetDroppedBytes(RingBuffer *ring_buff);
+
+
+#if (EZ_RING_BUFFER_MIRROR == 1U)
+/*****************************************************************************
+* Function : ezRingBuffer_InitMirrored
+*//** 
+* @brief Initialize the ring buffer with a mirrored virtual memory storage
+*
+* @details The storage is allocated from a memfd and mapped twice back to
+* back, so buff[i] and buff[i + capacity] are the same byte. Push and Pop
+* then copy in one piece and Reserve/Peek always return a single
+* contiguous region. All other functions of the API work unchanged. Linux
+* only.
+*
+* @param[in]    ring_buff: pointer to the ring buffer
+* @param[in]    size: requested size, rounded up to a multiple of the page
+*               size. The rounded size is stored in capacity
+* @return       true if success, else false
+*
+* @pre None
+* @post ezRingBuffer_DeinitMirrored must be called to release the mapping
+*
+* \b Example
+* @code
+* RingBuffer buffer;
+* ezRingBuffer_InitMirrored(&buffer, 4096);
+* ...
+* ezRingBuffer_DeinitMirrored(&buffer);
+* @endcode
+*
+* @see ezRingBuffer_DeinitMirrored
+*
+*****************************************************************************/
+bool ezRingBuffer_InitMirrored(RingBuffer *ring_buff, ezRingBufferSize_t size);
+
+
+/*****************************************************************************
+* Function : ezRingBuffer_DeinitMirrored
+*//** 
+* @brief Release the storage of a mirrored ring buffer
+*
+* @details Does nothing if the ring buffer is not mirrored.
+*
+* @param[in]    ring_buff: pointer to the ring buffer
+* @return       None
+*
+* @pre ring buffer is initialized with ezRingBuffer_InitMirrored
+* @post None
+*
+* \b Example
+* @code
+* ezRingBuffer_DeinitMirrored(&buffer);
+* @endcode
+*
+* @see ezRingBuffer_InitMirrored
+*
+*****************************************************************************/
+void ezRingBuffer_DeinitMirrored(RingBuffer *ring_buff);
+#endif /* EZ_RING_BUFFER_MIRROR == 1U */
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,288 @@
+/*****************************************************************************
+* Filename:         ez_spsc_ring_buffer.h
+* Author:           Hai Nguyen
+* Original Date:    16.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+
+/** @file   ez_spsc_ring_buffer.h
+ *  @author Hai Nguyen
+ *  @date   16.10.2026
+ *  @brief  Public API of the single-producer/single-consumer ring buffer
+ *
+ *  @details Lock-free variant of the ring buffer. Exactly one context may
+ *  push (e.g. a UART ISR) and exactly one context may pop (e.g. a consumer
+ *  task) concurrently, without any surrounding lock. The producer owns the
+ *  head index and the consumer owns the tail index; there is no shared
+ *  counter, so the two sides never write the same field.
+ */
+
+#ifndef SPSC_RING_BUFFER_H
+#define SPSC_RING_BUFFER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+* Includes
+*******************************************************************************/
+#if (EZ_BUILD_WITH_CMAKE == 0U)
+#include "ez_target_config.h"
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+/* None */
+
+/*****************************************************************************
+* Component Typedefs
+*****************************************************************************/
+/** @brief Data structure of a single-producer/single-consumer ring buffer
+ *
+ *  Indices run in the range [0, 2 * capacity) so that a full buffer can be
+ *  distinguished from an empty one without a shared byte counter.
+ */
+typedef struct
+{
+    uint8_t *buff;
+    /**< pointer to the data buffer*/
+    uint32_t capacity;
+    /**< size of the buffer*/
+    uint32_t head_index;
+    /**< write index, only modified by the producer*/
+    uint32_t tail_index;
+    /**< read index, only modified by the consumer*/
+}ezSpscRingBuffer;
+
+
+/*****************************************************************************
+* Component Variable Definitions
+*****************************************************************************/
+/* None */
+
+/******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/*****************************************************************************
+* Function : ezSpscRingBuffer_Init
+*//**
+* @brief This function initializes the SPSC ring buffer
+*
+* @details Must be called before the producer and the consumer start.
+*
+* @param[in]    ring_buff: pointer to the ring buffer
+* @param[in]    buff: pointer of buffer holding data
+* @param[in]    size: size of buff, at most 0x7FFFFFFF bytes
+* @return       true if success, else false
+*
+* @pre None
+* @post None
+*
+* \b Example
+* @code
+* ezSpscRingBuffer buffer;
+* uint8_t storage[64];
+* ezSpscRingBuffer_Init(&buffer, storage, sizeof(storage));
+* @endcode
+*
+*****************************************************************************/
+bool ezSpscRingBuffer_Init(ezSpscRingBuffer *ring_buff, uint8_t *buff, uint32_t size);
+
+
+/*****************************************************************************
+* Function : ezSpscRingBuffer_Push
+*//**
+* @brief Push data into the ring buffer. Producer side only.
+*
+* @details If there is not enough free space, only the bytes that fit are
+* pushed.
+*
+* @param[in]    ring_buff: pointer to the ring buffer
+* @param[in]    data: pointer to the pushed data
+* @param[in]    size: size of the data
+* @return       Number of bytes pushed into the ring buffer
+*
+* @pre ring buffer is initialized
+* @post None
+*
+* \b Example
+* @code
+* uint8_t data[3U] = {0U,1U,2U};
+* ezSpscRingBuffer_Push(&buffer, data, 3U);
+* @endcode
+*
+* @see ezSpscRingBuffer_Init
+*
+*****************************************************************************/
+uint32_t ezSpscRingBuffer_Push(ezSpscRingBuffer *ring_buff, const uint8_t *data, uint32_t size);
+
+
+/*****************************************************************************
+* Function : ezSpscRingBuffer_Pop
+*//**
+* @brief Pop data out of the ring buffer. Consumer side only.
+*
+* @details
+*
+* @param[in]    ring_buff: pointer to the ring buffer
+* @param[out]   data: pointer to the popped data
+* @param[in]    size: size of the popped data
+* @return       Number of bytes popped out of the ring buffer
+*
+* @pre ring buffer is initialized
+* @post None
+*
+* \b Example
+* @code
+* uint8_t data[3U];
+* ezSpscRingBuffer_Pop(&buffer, data, 3U);
+* @endcode
+*
+* @see ezSpscRingBuffer_Init
+*
+*****************************************************************************/
+uint32_t ezSpscRingBuffer_Pop(ezSpscRingBuffer *ring_buff, uint8_t *data, uint32_t size);
+
+
+/*****************************************************************************
+* Function : ezSpscRingBuffer_GetUsedMemory
+*//**
+* @brief Return number of bytes stored in the ring buffer
+*
+* @details The value is a snapshot, the other side may change it right after
+* the call returns.
+*
+* @param[in]    ring_buff: pointer to the ring buffer
+* @return       Number of stored bytes
+*
+* @pre ring buffer is initialized
+* @post None
+*
+* \b Example
+* @code
+* uint32_t used = ezSpscRingBuffer_GetUsedMemory(&buffer);
+* @endcode
+*
+* @see ezSpscRingBuffer_Init
+*
+*****************************************************************************/
+uint32_t ezSpscRingBuffer_GetUsedMemory(ezSpscRingBuffer *ring_buff);
+
+
+/*****************************************************************************
+* Function : ezSpscRingBuffer_GetAvailableMemory
+*//**
+* @brief Return number of bytes available for pushing
+*
+* @details The value is a snapshot, the other side may change it right after
+* the call returns.
+*
+* @param[in]    ring_buff: pointer to the ring buffer
+* @return       Number of available bytes
+*
+* @pre ring buffer is initialized
+* @post None
+*
+* \b Example
+* @code
+* uint32_t avail = ezSpscRingBuffer_GetAvailableMemory(&buffer);
+* @endcode
+*
+* @see ezSpscRingBuffer_Init
+*
+*****************************************************************************/
+uint32_t ezSpscRingBuffer_GetAvailableMemory(ezSpscRingBuffer *ring_buff);
+
+
+/*****************************************************************************
+* Function : ezSpscRingBuffer_IsEmpty
+*//**
+* @brief Check if the buffer is empty
+*
+* @details
+*
+* @param[in]    ring_buff: pointer to the ring buffer
+* @return       true if empty, otherwise false
+*
+* @pre ring buffer is initialized
+* @post None
+*
+* \b Example
+* @code
+* bool empty = ezSpscRingBuffer_IsEmpty(&buffer);
+* @endcode
+*
+* @see ezSpscRingBuffer_Init
+*
+*****************************************************************************/
+bool ezSpscRingBuffer_IsEmpty(ezSpscRingBuffer *ring_buff);
+
+
+/*****************************************************************************
+* Function : ezSpscRingBuffer_IsFull
+*//**
+* @brief Check if the buffer is full
+*
+* @details
+*
+* @param[in]    ring_buff: pointer to the ring buffer
+* @return       true if full, otherwise false
+*
+* @pre ring buffer is initialized
+* @post None
+*
+* \b Example
+* @code
+* bool full = ezSpscRingBuffer_IsFull(&buffer);
+* @endcode
+*
+* @see ezSpscRingBuffer_Init
+*
+*****************************************************************************/
+bool ezSpscRingBuffer_IsFull(ezSpscRingBuffer *ring_buff);
+
+
+/*****************************************************************************
+* Function : ezSpscRingBuffer_Reset
+*//**
+* @brief Drop all data in the ring buffer
+*
+* @details Not safe to call while the producer or the consumer is running.
+*
+* @param[in]    ring_buff: pointer to the ring buffer
+* @return       None
+*
+* @pre ring buffer is initialized
+* @post None
+*
+* \b Example
+* @code
+* ezSpscRingBuffer_Reset(&buffer);
+* @endcode
+*
+* @see ezSpscRingBuffer_Init
+*
+*****************************************************************************/
+void ezSpscRingBuffer_Reset(ezSpscRingBuffer *ring_buff);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SPSC_RING_BUFFER_H */
+
+/* End of file */
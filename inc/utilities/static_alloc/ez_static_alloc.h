@@ -39,18 +39,191 @@ extern "C" {
 #if (EZ_STATIC_ALLOC == 1)
 
 #include "stdint.h"
+#include "stdbool.h"
 #include "ez_linked_list.h"
 
 /*****************************************************************************
 * Component Preprocessor Macros
 *****************************************************************************/
-/* None */
+/** @brief Number of bytes needed to carve num_of_blocks block descriptors
+ *  from the managed buffer, including the worst case alignment padding.
+ *  See ezStaticAlloc_InitMemListWithBlocks
+ */
+#define EZ_STATIC_ALLOC_BLOCKS_SIZE(num_of_blocks) \
+    ((sizeof(struct MemBlock) * (num_of_blocks)) + sizeof(void*) - 1U)
+
+#ifndef CONFIG_EZ_STATIC_ALLOC_TLSF_SL_LOG2
+/** @brief log2 of the number of second level lists of the TLSF backend.
+ *  Higher values waste less memory per allocation but need a bigger control
+ *  structure at the beginning of the buffer.
+ */
+#define CONFIG_EZ_STATIC_ALLOC_TLSF_SL_LOG2     3U
+#endif
+
+#ifndef CONFIG_EZ_STATIC_ALLOC_STATS
+/** @brief 1: count usage and failures per memory list, see
+ *  ezStaticAlloc_GetStats. 0: save the counters in every memory list
+ */
+#define CONFIG_EZ_STATIC_ALLOC_STATS            1U
+#endif
+
+#ifndef CONFIG_EZ_STATIC_ALLOC_16BIT_SIZE
+/** @brief 1: store block sizes in 16 bits to save memory in the block
+ *  descriptors of small MCUs. Buffers and allocations are then limited to
+ *  EZ_STATIC_ALLOC_MAX_SIZE bytes. 0: 32-bit sizes
+ */
+#define CONFIG_EZ_STATIC_ALLOC_16BIT_SIZE       0U
+#endif
+
+#ifndef CONFIG_EZ_STATIC_ALLOC_CACHE_LINE_SIZE
+/** @brief Size of a cache line in bytes, alignment for
+ *  ezStaticAlloc_MallocAligned to avoid sharing a cache line with other data
+ */
+#define CONFIG_EZ_STATIC_ALLOC_CACHE_LINE_SIZE  64U
+#endif
+
+#ifndef CONFIG_EZ_STATIC_ALLOC_COMPACTION
+/** @brief 1: support movable allocations and ezStaticAlloc_Compact. Every
+ *  block descriptor grows by one pointer. 0: save the pointer
+ */
+#define CONFIG_EZ_STATIC_ALLOC_COMPACTION       1U
+#endif
+
+#ifndef CONFIG_EZ_STATIC_ALLOC_THREAD_SAFE
+/** @brief 1: a memory list can be protected by a lock set with
+ *  ezStaticAlloc_SetLock. Every memory list grows by one pointer
+ */
+#define CONFIG_EZ_STATIC_ALLOC_THREAD_SAFE      1U
+#endif
+
+#ifndef CONFIG_EZ_STATIC_ALLOC_CACHE_CLASSES
+/** @brief Number of size classes of a per-task cache. Class i holds blocks
+ *  of 16 << i bytes, larger requests bypass the cache
+ */
+#define CONFIG_EZ_STATIC_ALLOC_CACHE_CLASSES    6U
+#endif
+
+#ifndef CONFIG_EZ_STATIC_ALLOC_MAGAZINE_SIZE
+/** @brief Number of free blocks a per-task cache keeps per size class */
+#define CONFIG_EZ_STATIC_ALLOC_MAGAZINE_SIZE    8U
+#endif
+
+#ifndef CONFIG_EZ_STATIC_ALLOC_MAX_REGIONS
+/** @brief Maximum number of regions (memory lists) of one ezStaticAllocHeap */
+#define CONFIG_EZ_STATIC_ALLOC_MAX_REGIONS      4U
+#endif
+
+/** @brief Largest buffer and allocation size a memory list can manage */
+#if (CONFIG_EZ_STATIC_ALLOC_16BIT_SIZE == 1U)
+#define EZ_STATIC_ALLOC_MAX_SIZE                0xFFFFU
+#else
+#define EZ_STATIC_ALLOC_MAX_SIZE                0xFFFFFFFFU
+#endif
+
+/** @brief Number of size classes of the failure counters. Class 0 counts
+ *  requests up to 16 bytes, class i up to 16 << i bytes, the last class
+ *  everything larger
+ */
+#define EZ_STATIC_ALLOC_NUM_OF_SIZE_CLASSES     8U
 
 
 /*****************************************************************************
 * Component Typedefs
 *****************************************************************************/
 
+/**@brief Size of a buffer or of a block as stored by a memory list. The API
+ * takes uint32_t sizes and rejects sizes above EZ_STATIC_ALLOC_MAX_SIZE
+ */
+#if (CONFIG_EZ_STATIC_ALLOC_16BIT_SIZE == 1U)
+typedef uint16_t ezStaticAllocSize_t;
+#else
+typedef uint32_t ezStaticAllocSize_t;
+#endif
+
+
+/**@brief Allocation algorithm used by a memory list
+ */
+typedef enum
+{
+    EZ_STATIC_ALLOC_FIRST_FIT = 0,
+    /**< First fit over address ordered block lists, no memory overhead */
+    EZ_STATIC_ALLOC_TLSF,
+    /**< Two-Level Segregated Fit, O(1) malloc and free */
+}ezStaticAllocBackend;
+
+
+/**@brief Snapshot of a failed allocation
+ */
+typedef struct
+{
+    uint32_t size;                  /**< requested size */
+    uint32_t free_bytes;            /**< free bytes at the time of the failure */
+    uint32_t largest_free_block;    /**< largest free block at the time of the failure */
+}ezStaticAllocFailure;
+
+
+/**@brief Counters maintained by a memory list
+ */
+typedef struct
+{
+    uint32_t used_bytes;        /**< bytes in allocated blocks */
+    uint32_t peak_used_bytes;   /**< highest value of used_bytes */
+    uint32_t num_of_malloc;     /**< number of successful allocations */
+    uint32_t num_of_free;       /**< number of successful frees */
+    uint32_t num_of_failed;     /**< number of failed allocations */
+    uint32_t num_of_resized;    /**< reallocations done without a new block */
+    uint32_t failed_by_class[EZ_STATIC_ALLOC_NUM_OF_SIZE_CLASSES];
+    /**< failed allocations per size class */
+    ezStaticAllocFailure *failure_trace;
+    /**< ring of recent failed allocations, NULL if not attached */
+    uint32_t failure_trace_size;
+    /**< number of entries of failure_trace */
+}ezStaticAllocCounters;
+
+
+/**@brief Statistics of a memory list, see ezStaticAlloc_GetStats
+ */
+typedef struct
+{
+    ezStaticAllocCounters counters;
+    /**< counters since init or the last reset */
+    uint32_t free_bytes;
+    /**< bytes in free blocks */
+    uint32_t largest_free_block;
+    /**< size of the largest free block. With TLSF a malloc of this size
+     * can still fail, the request is rounded up to the next size class */
+    uint32_t num_of_free_blocks;
+    /**< number of free blocks */
+    uint32_t num_of_alloc_blocks;
+    /**< number of allocated blocks */
+    uint8_t fragmentation;
+    /**< 0 - 100: percentage of free bytes outside of the largest free block */
+}ezStaticAllocStats;
+
+
+/**@brief Lock protecting a memory list used by several tasks
+ */
+typedef struct
+{
+    void (*lock)(void *context);    /**< take the lock, may block */
+    void (*unlock)(void *context);  /**< release the lock */
+    void *context;                  /**< argument of lock and unlock, e.g. a semaphore */
+}ezStaticAllocLock;
+
+
+/**@brief Header of a memory block
+ */
+struct MemBlock
+{
+    struct Node node;   /* Linked list node, links unused descriptors too */
+    void* buff;         /* Pointer to the allocated memory */
+    ezStaticAllocSize_t buff_size; /* Size of the allocated memory */
+#if (CONFIG_EZ_STATIC_ALLOC_COMPACTION == 1U)
+    void** handle;      /* Pointer updated when the block moves, NULL if pinned */
+#endif
+};
+
+
 /**@brief List to manage the memory block
  */
 struct MemList
@@ -61,24 +234,89 @@ struct MemList
     /**< List to manage the allocated blocks*/
     uint8_t* buff;
     /**< Pointer to the memory buffer */
-    uint16_t buff_size;
+    ezStaticAllocSize_t buff_size;
     /**< Size of the buffer */
+    struct MemBlock* unused_blocks;
+    /**< Unused block descriptors owned by this list */
+    bool is_shared_pool;
+    /**< true: descriptors are taken from the shared pool */
+    ezStaticAllocBackend backend;
+    /**< Allocation algorithm of this list */
+#if (CONFIG_EZ_STATIC_ALLOC_STATS == 1U)
+    ezStaticAllocCounters counters;
+    /**< Usage and failure counters */
+#endif
+#if (CONFIG_EZ_STATIC_ALLOC_THREAD_SAFE == 1U)
+    const ezStaticAllocLock* lock;
+    /**< Lock taken by every operation, NULL if not shared */
+#endif
 };
 
 
-/**@brief Header of a memory block
+/**@brief Define ezmMemList data type
  */
-struct MemBlock
+typedef struct MemList ezmMemList;
+
+
+/**@brief Where ezStaticAlloc_HeapMalloc looks first for memory
+ */
+typedef enum
 {
-    struct Node node;   /* Linked list node */
-    void* buff;         /* Pointer to the allocated memory */
-    uint16_t buff_size; /* Size of the allocated memory */
-};
+    EZ_STATIC_ALLOC_FAST_FIRST = 0,
+    /**< Fastest region first, spill to slower regions when it is full */
+    EZ_STATIC_ALLOC_SLOW_FIRST,
+    /**< Slowest region first, keeps the fast memory for hot data */
+    EZ_STATIC_ALLOC_BY_SIZE,
+    /**< Slow first from large_threshold bytes on, else fast first */
+}ezStaticAllocPlacement;
 
 
-/**@brief Define ezmMemList data type
+/**@brief Memory list managing one memory bank of a heap
  */
-typedef struct MemList ezmMemList;
+typedef struct
+{
+    ezmMemList *mem_list;   /**< initialized memory list of the bank */
+    uint8_t speed;          /**< higher is faster */
+}ezStaticAllocRegion;
+
+
+/**@brief Allocator spanning several non-contiguous memory banks
+ */
+typedef struct
+{
+    ezStaticAllocRegion regions[CONFIG_EZ_STATIC_ALLOC_MAX_REGIONS];
+    /**< Regions sorted fastest first */
+    uint32_t num_of_regions;
+    /**< Number of used entries of regions */
+    uint32_t large_threshold;
+    /**< Size from which EZ_STATIC_ALLOC_BY_SIZE prefers slow memory */
+}ezStaticAllocHeap;
+
+
+/**@brief Free blocks of one size class kept by a per-task cache
+ */
+typedef struct
+{
+    void *blocks[CONFIG_EZ_STATIC_ALLOC_MAGAZINE_SIZE];
+    /**< Stack of free blocks, most recently freed last */
+    uint32_t count;
+    /**< Number of blocks in the magazine */
+}ezStaticAllocMagazine;
+
+
+/**@brief Per-task cache of recently freed blocks of a memory list
+ */
+typedef struct
+{
+    ezmMemList *mem_list;
+    /**< Memory list the blocks belong to */
+    ezStaticAllocMagazine magazines[CONFIG_EZ_STATIC_ALLOC_CACHE_CLASSES];
+    /**< One magazine per size class */
+    uint32_t num_of_hits;
+    /**< Allocations served from a magazine, without the lock */
+    uint32_t num_of_misses;
+    /**< Allocations served by the memory list */
+}ezStaticAllocCache;
 
 
 /******************************************************************************
@@ -100,7 +338,8 @@ typedef struct MemList ezmMemList;
 *
 * @param[in]    *mem_list:      handle to manage memory buffer
 * @param[in]    *buffer:        buffer to be managed
-* @param[in]    buffer_size:    size of the buffer
+* @param[in]    buffer_size:    size of the buffer, at most
+*                               EZ_STATIC_ALLOC_MAX_SIZE
 * @return       True is initialization is success
 *
 * @pre None
@@ -114,7 +353,84 @@ typedef struct MemList ezmMemList;
 * @endcode
 *
 *****************************************************************************/
-bool ezStaticAlloc_InitMemList(ezmMemList* mem_list, void* buff, uint16_t buff_size);
+bool ezStaticAlloc_InitMemList(ezmMemList* mem_list, void* buff, uint32_t buff_size);
+
+
+/*****************************************************************************
+* Function : ezStaticAlloc_InitMemListWithBlocks
+*//** 
+* @brief This function initializes memory handle with its own block
+* descriptors
+*
+* @details ezStaticAlloc_InitMemList takes the block descriptors from a pool
+* of CONFIG_NUM_OF_MEM_BLOCK descriptors shared by all memory lists. A list
+* initialized with this function uses only its own descriptors, so it can not
+* be starved by other lists. If blocks is NULL, the descriptors are carved
+* from the beginning of buff and the rest of buff is managed.
+*
+* @param[in]    *mem_list:      handle to manage memory buffer
+* @param[in]    *buff:          buffer to be managed
+* @param[in]    buff_size:      size of the buffer
+* @param[in]    *blocks:        array of descriptors or NULL
+* @param[in]    num_of_blocks:  number of descriptors, limits the number of
+*                               allocated plus free blocks
+* @return       True is initialization is success
+*
+* @pre None
+* @post None
+*
+* \b Example
+* @code
+* ezmMemList mem_list;
+* uint8_t buff[256 + EZ_STATIC_ALLOC_BLOCKS_SIZE(8)];
+* bool success = ezStaticAlloc_InitMemListWithBlocks(&mem_list, buff,
+*                                                    sizeof(buff), NULL, 8);
+* @endcode
+*
+* @see ezStaticAlloc_InitMemList
+*
+*****************************************************************************/
+bool ezStaticAlloc_InitMemListWithBlocks(ezmMemList* mem_list,
+                                         void* buff,
+                                         uint32_t buff_size,
+                                         struct MemBlock* blocks,
+                                         uint16_t num_of_blocks);
+
+
+/*****************************************************************************
+* Function : ezStaticAlloc_InitMemListTlsf
+*//** 
+* @brief This function initializes memory handle to manage the memory buffer
+* with the Two-Level Segregated Fit algorithm
+*
+* @details Malloc and free take a bounded time independent of the number of
+* blocks. The blocks are managed with headers inside of the buffer, so each
+* allocation costs two pointers of overhead and the control structure takes
+* the beginning of the buffer. Allocated memory is aligned to the size of a
+* pointer. The rest of the API is used the same way as with
+* ezStaticAlloc_InitMemList.
+*
+* @param[in]    *mem_list:      handle to manage memory buffer
+* @param[in]    *buff:          buffer to be managed
+* @param[in]    buff_size:      size of the buffer, at most
+*                               EZ_STATIC_ALLOC_MAX_SIZE and 2 GiB
+* @return       True is initialization is success, false if the buffer can
+*               not hold the control structure or is too large
+*
+* @pre None
+* @post None
+*
+* \b Example
+* @code
+* ezmMemList mem_list;
+* static uint8_t buff[4096];
+* bool success = ezStaticAlloc_InitMemListTlsf(&mem_list, buff, sizeof(buff));
+* @endcode
+*
+* @see ezStaticAlloc_InitMemList
+*
+*****************************************************************************/
+bool ezStaticAlloc_InitMemListTlsf(ezmMemList* mem_list, void* buff, uint32_t buff_size);
 
 
 /*****************************************************************************
@@ -147,11 +463,12 @@ bool ezStaticAlloc_IsMemListReady(ezmMemList *mem_list);
 *//** 
 * @brief This function allocate the number of bytes in the initialized memory
 *
-* @details This is the implementation of the malloc() function
+* @details This is the implementation of the malloc() function. Sizes larger
+* than the buffer of the memory list are rejected.
 *
 * @param[in]    *mem_list:  handle to manage memory buffer
 * @param[in]    alloc_size: number of byte to be allocated
-* @return       address of the allocated memory
+* @return       address of the allocated memory, NULL if not enough memory
 *
 * @pre mem_list must initialized
 * @post None
@@ -171,7 +488,40 @@ bool ezStaticAlloc_IsMemListReady(ezmMemList *mem_list);
 * @see ezStaticAlloc_InitMemList
 *
 *****************************************************************************/
-void *ezStaticAlloc_Malloc(ezmMemList* mem_list, uint16_t alloc_size);
+void *ezStaticAlloc_Malloc(ezmMemList* mem_list, uint32_t alloc_size);
+
+
+/*****************************************************************************
+* Function : ezStaticAlloc_MallocAligned
+*//** 
+* @brief Allocate a block starting at a multiple of alignment
+*
+* @details For DMA descriptors, cache maintenance and vectorized access. Use
+* CONFIG_EZ_STATIC_ALLOC_CACHE_LINE_SIZE to give the block its own cache
+* lines. With the first fit backend the memory in front of the block stays a
+* free block, so it costs one more block descriptor. With the TLSF backend a
+* gap too small for a free block is skipped by adding alignment. The block is
+* freed with ezStaticAlloc_Free and is never moved by ezStaticAlloc_Compact.
+*
+* @param[in]    *mem_list:  handle to manage memory buffer
+* @param[in]    alloc_size: number of byte to be allocated
+* @param[in]    alignment:  power of two
+* @return       address of the allocated memory, NULL if not enough memory or
+*               alignment is not a power of two
+*
+* @pre mem_list must initialized
+* @post None
+*
+* \b Example
+* @code
+* uint8_t *dma_buff = (uint8_t*)ezStaticAlloc_MallocAligned(&mem_list, 256,
+*                               CONFIG_EZ_STATIC_ALLOC_CACHE_LINE_SIZE);
+* @endcode
+*
+* @see ezStaticAlloc_Malloc
+*
+*****************************************************************************/
+void *ezStaticAlloc_MallocAligned(ezmMemList* mem_list, uint32_t alloc_size, uint32_t alignment);
 
 
 /*****************************************************************************
@@ -211,6 +561,146 @@ void *ezStaticAlloc_Malloc(ezmMemList* mem_list, uint16_t alloc_size);
 bool ezStaticAlloc_Free(ezmMemList *mem_list, void *alloc_addr);
 
 
+/*****************************************************************************
+* Function : ezStaticAlloc_FreeBatch
+*//** 
+* @brief This function frees several blocks under one acquisition of the lock
+*
+* @details Same as calling ezStaticAlloc_Free for every address, but a list
+* shared with ezStaticAlloc_SetLock is locked only once. NULL entries are
+* skipped.
+*
+* @param[in]    *mem_list:  handle to manage memory buffer
+* @param[in]    *alloc_addrs: addresses of the allocated blocks
+* @param[in]    num_of_blocks: number of addresses
+* @return       number of blocks freed
+*
+* @pre mem_list must initialized
+* @post None
+*
+* \b Example
+* @code
+* void *blocks[4];
+* ...
+* if(ezStaticAlloc_FreeBatch(&mem_list, blocks, 4) != 4)
+* {
+*     printf("error");
+* }
+* @endcode
+*
+* @see ezStaticAlloc_Free
+*
+*****************************************************************************/
+uint32_t ezStaticAlloc_FreeBatch(ezmMemList *mem_list, void * const *alloc_addrs, uint32_t num_of_blocks);
+
+
+/*****************************************************************************
+* Function : ezStaticAlloc_Realloc
+*//** 
+* @brief Change the size of an allocated block, in place when possible
+*
+* @details Shrinking splits the tail of the block off as a free block.
+* Growing first takes the free block following the block, then the free
+* block in front of it, moving the data down with memmove. Only if the
+* neighbours are too small, a new block is allocated, the data copied and the
+* old block freed. The content up to the smaller of both sizes is kept. A
+* movable block stays movable and its handle is updated. The alignment of a
+* block from ezStaticAlloc_MallocAligned is not kept if the block moves.
+*
+* @param[in]    *mem_list:  handle to manage memory buffer
+* @param[in]    *alloc_addr: allocated block, NULL to allocate a new block
+* @param[in]    new_size:   new size of the block, 0 to free the block
+* @return       address of the block, NULL if new_size is 0 or not enough
+*               memory. On failure the block is unchanged and stays allocated
+*
+* @pre mem_list must initialized
+* @post None
+*
+* \b Example
+* @code
+* char *line = (char*)ezStaticAlloc_Malloc(&mem_list, 32);
+* char *longer = (char*)ezStaticAlloc_Realloc(&mem_list, line, 64);
+* if (longer != NULL)
+* {
+*     line = longer;
+* }
+* @endcode
+*
+* @see ezStaticAlloc_Malloc, ezStaticAlloc_Free
+*
+*****************************************************************************/
+void *ezStaticAlloc_Realloc(ezmMemList *mem_list, void *alloc_addr, uint32_t new_size);
+
+
+#if (CONFIG_EZ_STATIC_ALLOC_COMPACTION == 1U)
+/*****************************************************************************
+* Function : ezStaticAlloc_MallocMovable
+*//** 
+* @brief Allocate a block which ezStaticAlloc_Compact may relocate
+*
+* @details The address of the block is stored in *handle and updated
+* whenever the block moves. The user must always access the block through
+* *handle and must not keep other pointers to it across a compaction. The
+* block is freed with ezStaticAlloc_Free(mem_list, *handle), which also sets
+* *handle to NULL. Only the first fit backend supports movable blocks.
+*
+* @param[in]    *mem_list:  handle to manage memory buffer
+* @param[out]   **handle:   pointer owned by the user, must stay valid while
+*                           the block is allocated
+* @param[in]    alloc_size: size of the block
+* @return       true if success, else false
+*
+* @pre mem_list must initialized
+* @post None
+*
+* \b Example
+* @code
+* static uint8_t *record = NULL;
+* if (ezStaticAlloc_MallocMovable(&mem_list, (void**)&record, 64))
+* {
+*     memset(record, 0, 64);
+* }
+* @endcode
+*
+* @see ezStaticAlloc_Compact
+*
+*****************************************************************************/
+bool ezStaticAlloc_MallocMovable(ezmMemList *mem_list, void **handle, uint32_t alloc_size);
+
+
+/*****************************************************************************
+* Function : ezStaticAlloc_Compact
+*//** 
+* @brief Relocate movable blocks to rebuild large free regions
+*
+* @details Movable blocks are slid towards the beginning of the buffer and
+* their handles are updated. Blocks allocated with ezStaticAlloc_Malloc are
+* pinned and stay in place, the free memory between two pinned blocks is
+* gathered in one free block. The pass copies memory and walks the lists, so
+* call it when an allocation fails or at idle time, not in every cycle.
+*
+* @param[in]    *mem_list:  handle to manage memory buffer
+* @return       number of relocated blocks
+*
+* @pre mem_list must initialized, no task accesses movable blocks
+* @post None
+*
+* \b Example
+* @code
+* if (ezStaticAlloc_MallocMovable(&mem_list, &handle, size) == false
+*     && ezStaticAlloc_Compact(&mem_list) > 0U)
+* {
+*     (void)ezStaticAlloc_MallocMovable(&mem_list, &handle, size);
+* }
+* @endcode
+*
+* @see ezStaticAlloc_MallocMovable
+*
+*****************************************************************************/
+uint32_t ezStaticAlloc_Compact(ezmMemList *mem_list);
+#endif /* CONFIG_EZ_STATIC_ALLOC_COMPACTION == 1U */
+
+
 /*****************************************************************************
 * Function : ezStaticAlloc_GetNumOfAllocBlock
 *//** 
@@ -232,7 +722,7 @@ bool ezStaticAlloc_Free(ezmMemList *mem_list, void *alloc_addr);
 * @see ezStaticAlloc_InitMemList
 *
 *****************************************************************************/
-uint16_t ezStaticAlloc_GetNumOfAllocBlock(ezmMemList* mem_list);
+uint32_t ezStaticAlloc_GetNumOfAllocBlock(ezmMemList* mem_list);
 
 
 /*****************************************************************************
@@ -256,7 +746,7 @@ uint16_t ezStaticAlloc_GetNumOfAllocBlock(ezmMemList* mem_list);
 * @see ezStaticAlloc_InitMemList
 *
 *****************************************************************************/
-uint16_t ezStaticAlloc_GetNumOfFreeBlock(ezmMemList* mem_list);
+uint32_t ezStaticAlloc_GetNumOfFreeBlock(ezmMemList* mem_list);
 
 
 /*****************************************************************************
@@ -330,6 +820,451 @@ void ezStaticAlloc_PrintFreeList (ezmMemList* mem_list);
 *****************************************************************************/
 void ezStaticAlloc_PrintAllocList(ezmMemList* mem_list);
 
+
+#if (CONFIG_EZ_STATIC_ALLOC_STATS == 1U)
+/*****************************************************************************
+* Function : ezStaticAlloc_GetStats
+*//** 
+* @brief Return the usage and failure statistics of a memory list
+*
+* @details Counters are maintained on every malloc and free. The free block
+* figures are collected on this call by walking the free blocks. A failed
+* allocation with enough free bytes but a small largest free block points to
+* fragmentation, otherwise the buffer is too small.
+*
+* @param[in]    *mem_list:  handle to manage memory buffer
+* @param[out]   *stats:     statistics
+* @return       true if success, else false
+*
+* @pre mem_list must initialized
+* @post None
+*
+* \b Example
+* @code
+* ezStaticAllocStats stats;
+* if(ezStaticAlloc_GetStats(&mem_list, &stats))
+* {
+*     printf("peak %u of %u bytes\n", stats.counters.peak_used_bytes, mem_list.buff_size);
+* }
+* @endcode
+*
+* @see ezStaticAlloc_ResetStats
+*
+*****************************************************************************/
+bool ezStaticAlloc_GetStats(ezmMemList* mem_list, ezStaticAllocStats* stats);
+
+
+/*****************************************************************************
+* Function : ezStaticAlloc_ResetStats
+*//** 
+* @brief Clear the counters of a memory list
+*
+* @details The peak usage restarts from the current usage. The failure trace
+* stays attached but is emptied.
+*
+* @param[in]    *mem_list:  handle to manage memory buffer
+* @return       None
+*
+* @pre mem_list must initialized
+* @post None
+*
+* \b Example
+* @code
+* ezStaticAlloc_ResetStats(&mem_list);
+* @endcode
+*
+* @see ezStaticAlloc_GetStats
+*
+*****************************************************************************/
+void ezStaticAlloc_ResetStats(ezmMemList* mem_list);
+
+
+/*****************************************************************************
+* Function : ezStaticAlloc_SetFailureTrace
+*//** 
+* @brief Attach a ring buffer recording the most recent failed allocations
+*
+* @details Each entry holds the requested size, the free bytes and the
+* largest free block at the time of the failure. Initializing the memory
+* list detaches the trace.
+*
+* @param[in]    *mem_list:      handle to manage memory buffer
+* @param[in]    *trace:         array of entries, NULL to detach
+* @param[in]    trace_size:     number of entries
+* @return       None
+*
+* @pre mem_list must initialized
+* @post None
+*
+* \b Example
+* @code
+* static ezStaticAllocFailure trace[8];
+* ezStaticAlloc_SetFailureTrace(&mem_list, trace, 8);
+* @endcode
+*
+* @see ezStaticAlloc_GetFailures
+*
+*****************************************************************************/
+void ezStaticAlloc_SetFailureTrace(ezmMemList* mem_list,
+                                   ezStaticAllocFailure* trace,
+                                   uint32_t trace_size);
+
+
+/*****************************************************************************
+* Function : ezStaticAlloc_GetFailures
+*//** 
+* @brief Copy the most recent failed allocations
+*
+* @details Returns 0 if no trace is attached.
+*
+* @param[in]    *mem_list:      handle to manage memory buffer
+* @param[out]   *failures:      array receiving the failures, oldest first
+* @param[in]    max_failures:   size of the array
+* @return       number of copied failures
+*
+* @pre mem_list must initialized
+* @post None
+*
+* \b Example
+* @code
+* ezStaticAllocFailure failures[4];
+* uint32_t count = ezStaticAlloc_GetFailures(&mem_list, failures, 4);
+* @endcode
+*
+* @see ezStaticAlloc_SetFailureTrace
+*
+*****************************************************************************/
+uint32_t ezStaticAlloc_GetFailures(ezmMemList* mem_list,
+                                   ezStaticAllocFailure* failures,
+                                   uint32_t max_failures);
+#endif /* CONFIG_EZ_STATIC_ALLOC_STATS == 1U */
+
+
+#if (CONFIG_EZ_STATIC_ALLOC_THREAD_SAFE == 1U)
+/*****************************************************************************
+* Function : ezStaticAlloc_SetLock
+*//** 
+* @brief Protect a memory list with a lock
+*
+* @details Every function of the API taking the memory list takes the lock,
+* so several tasks can share the list. The lock does not need to be
+* recursive. Memory lists initialized with ezStaticAlloc_InitMemList share
+* one pool of block descriptors, which has its own lock, see
+* ezStaticAlloc_SetSharedPoolLock. Initializing the list removes the lock.
+*
+* @param[in]    *mem_list: memory list
+* @param[in]    *lock: lock, must stay valid while it is set. NULL removes
+*               the lock
+* @return       None
+*
+* @pre mem_list is initialized and not used by another task yet
+* @post None
+*
+* \b Example
+* @code
+* static void Lock(void *context)
+* {
+*     (void)ezOsal_SemaphoreTake((ezOsal_SemaphoreHandle_t *)context, 0xFFFFFFFFU);
+* }
+*
+* static void Unlock(void *context)
+* {
+*     (void)ezOsal_SemaphoreGive((ezOsal_SemaphoreHandle_t *)context);
+* }
+*
+* EZ_OSAL_DEFINE_SEMAPHORE_HANDLE(mem_sem, 1, NULL);
+* static const ezStaticAllocLock mem_lock = { Lock, Unlock, &mem_sem };
+*
+* ezOsal_SemaphoreCreate(&mem_sem);
+* ezStaticAlloc_SetLock(&mem_list, &mem_lock);
+* @endcode
+*
+*****************************************************************************/
+void ezStaticAlloc_SetLock(ezmMemList* mem_list, const ezStaticAllocLock* lock);
+
+
+/*****************************************************************************
+* Function : ezStaticAlloc_SetSharedPoolLock
+*//** 
+* @brief Protect the block descriptors shared by the memory lists initialized
+* with ezStaticAlloc_InitMemList
+*
+* @details Those lists take and return descriptors of one global pool, also
+* when each list has its own lock set with ezStaticAlloc_SetLock. If such
+* lists are used by different tasks, the pool needs this lock. It is taken
+* for a moment inside the list lock, so it must be a different lock than the
+* lock of any list. Lists with their own descriptors
+* (ezStaticAlloc_InitMemListWithBlocks) or the TLSF backend never take it.
+*
+* @param[in]    *lock: lock, must stay valid while it is set. NULL removes
+*               the lock
+* @return       None
+*
+* @pre No memory list with shared descriptors is used by a task yet
+* @post None
+*
+* \b Example
+* @code
+* EZ_OSAL_DEFINE_SEMAPHORE_HANDLE(pool_sem, 1, NULL);
+* static const ezStaticAllocLock pool_lock = { Lock, Unlock, &pool_sem };
+*
+* ezOsal_SemaphoreCreate(&pool_sem);
+* ezStaticAlloc_SetSharedPoolLock(&pool_lock);
+* @endcode
+*
+* @see ezStaticAlloc_SetLock
+*
+*****************************************************************************/
+void ezStaticAlloc_SetSharedPoolLock(const ezStaticAllocLock* lock);
+
+
+/*****************************************************************************
+* Function : ezStaticAlloc_InitCache
+*//** 
+* @brief Initialize a per-task cache of a memory list
+*
+* @details Each task owns its cache. Blocks freed through the cache are kept
+* in a magazine of their size class and handed out again by the next
+* allocation of the class, without taking the lock of the memory list.
+*
+* @param[in]    *cache: cache owned by the calling task
+* @param[in]    *mem_list: memory list, usually protected by a lock
+* @return       true if success, else false
+*
+* @pre mem_list is initialized
+* @post The cache is empty
+*
+* \b Example
+* @code
+* static ezStaticAllocCache worker_cache;
+* ezStaticAlloc_InitCache(&worker_cache, &mem_list);
+* @endcode
+*
+* @see ezStaticAlloc_CacheMalloc, ezStaticAlloc_CacheFree
+*
+*****************************************************************************/
+bool ezStaticAlloc_InitCache(ezStaticAllocCache* cache, ezmMemList* mem_list);
+
+
+/*****************************************************************************
+* Function : ezStaticAlloc_CacheMalloc
+*//** 
+* @brief Allocate memory through a per-task cache
+*
+* @details Requests up to 16 << (CONFIG_EZ_STATIC_ALLOC_CACHE_CLASSES - 1)
+* bytes are rounded up to their size class and served from the magazine of
+* the class if possible. Larger requests, and requests of a class whose
+* magazine is empty, are served by the memory list. If the memory list is
+* out of memory, the cache is flushed and the allocation retried.
+*
+* @param[in]    *cache: cache of the calling task
+* @param[in]    alloc_size: number of bytes
+* @return       pointer to the memory, NULL if failed
+*
+* @pre cache is initialized and only used by the calling task
+* @post None
+*
+* \b Example
+* @code
+* Job *job = (Job *)ezStaticAlloc_CacheMalloc(&worker_cache, sizeof(Job));
+* @endcode
+*
+* @see ezStaticAlloc_CacheFree
+*
+*****************************************************************************/
+void *ezStaticAlloc_CacheMalloc(ezStaticAllocCache* cache, uint32_t alloc_size);
+
+
+/*****************************************************************************
+* Function : ezStaticAlloc_CacheFree
+*//** 
+* @brief Free memory allocated with ezStaticAlloc_CacheMalloc
+*
+* @details The block may be freed through the cache of another task of the
+* same memory list. When the magazine of the class is full, half of it is
+* returned to the memory list under one acquisition of the lock.
+*
+* @param[in]    *cache: cache of the calling task
+* @param[in]    *alloc_addr: address returned by ezStaticAlloc_CacheMalloc
+* @param[in]    alloc_size: size passed to ezStaticAlloc_CacheMalloc, selects
+*               the size class
+* @return       true if success, else false
+*
+* @pre cache is initialized and only used by the calling task
+* @post None
+*
+* \b Example
+* @code
+* ezStaticAlloc_CacheFree(&worker_cache, job, sizeof(Job));
+* @endcode
+*
+* @see ezStaticAlloc_CacheMalloc
+*
+*****************************************************************************/
+bool ezStaticAlloc_CacheFree(ezStaticAllocCache* cache, void* alloc_addr, uint32_t alloc_size);
+
+
+/*****************************************************************************
+* Function : ezStaticAlloc_CacheFlush
+*//** 
+* @brief Return all blocks kept by a cache to the memory list
+*
+* @details Call it before the task ends, or to make the memory available to
+* other tasks.
+*
+* @param[in]    *cache: cache of the calling task
+* @return       None
+*
+* @pre cache is initialized and only used by the calling task
+* @post The cache is empty
+*
+* \b Example
+* @code
+* ezStaticAlloc_CacheFlush(&worker_cache);
+* @endcode
+*
+*****************************************************************************/
+void ezStaticAlloc_CacheFlush(ezStaticAllocCache* cache);
+#endif /* CONFIG_EZ_STATIC_ALLOC_THREAD_SAFE == 1U */
+
+
+/*****************************************************************************
+* Function : ezStaticAlloc_InitHeap
+*//** 
+* @brief Initialize a heap without regions
+*
+* @details A heap lets one allocator own several memory banks, e.g. fast
+* tightly-coupled RAM and slow external RAM. Each bank is managed by its own
+* memory list, added with ezStaticAlloc_AddRegion.
+*
+* @param[in]    *heap: heap to initialize
+* @param[in]    large_threshold: size from which EZ_STATIC_ALLOC_BY_SIZE
+*               allocates from the slowest region first
+* @return       true if success, else false
+*
+* @pre None
+* @post The heap has no region
+*
+* \b Example
+* @code
+* ezStaticAllocHeap heap;
+* ezStaticAlloc_InitHeap(&heap, 1024);
+* @endcode
+*
+* @see ezStaticAlloc_AddRegion
+*
+*****************************************************************************/
+bool ezStaticAlloc_InitHeap(ezStaticAllocHeap *heap, uint32_t large_threshold);
+
+
+/*****************************************************************************
+* Function : ezStaticAlloc_AddRegion
+*//** 
+* @brief Add a memory bank to a heap
+*
+* @details The memory list may use any backend. Regions of equal speed are
+* tried in the order they were added. The memory list can still be used
+* directly, e.g. for statistics.
+*
+* @param[in]    *heap: heap
+* @param[in]    *mem_list: initialized memory list managing the bank
+* @param[in]    speed: speed attribute of the bank, higher is faster
+* @return       true if success, false if the heap is full, the memory list
+*               is not initialized or already belongs to the heap
+*
+* @pre heap is initialized
+* @post None
+*
+* \b Example
+* @code
+* ezStaticAlloc_InitMemList(&tcm_list, tcm_buff, sizeof(tcm_buff));
+* ezStaticAlloc_InitMemListTlsf(&ext_list, ext_buff, sizeof(ext_buff));
+* ezStaticAlloc_AddRegion(&heap, &tcm_list, 10);
+* ezStaticAlloc_AddRegion(&heap, &ext_list, 1);
+* @endcode
+*
+*****************************************************************************/
+bool ezStaticAlloc_AddRegion(ezStaticAllocHeap *heap, ezmMemList *mem_list, uint8_t speed);
+
+
+/*****************************************************************************
+* Function : ezStaticAlloc_HeapMalloc
+*//** 
+* @brief Allocate memory from the regions of a heap
+*
+* @details The regions are tried in the order given by placement until one
+* of them can serve the request.
+*
+* @param[in]    *heap: heap
+* @param[in]    alloc_size: number of bytes
+* @param[in]    placement: which regions are tried first
+* @return       pointer to the memory, NULL if no region can serve it
+*
+* @pre heap is initialized
+* @post None
+*
+* \b Example
+* @code
+* Sample *hot = (Sample *)ezStaticAlloc_HeapMalloc(&heap, sizeof(Sample),
+*                                                  EZ_STATIC_ALLOC_FAST_FIRST);
+* @endcode
+*
+* @see ezStaticAlloc_HeapFree
+*
+*****************************************************************************/
+void *ezStaticAlloc_HeapMalloc(ezStaticAllocHeap *heap,
+                               uint32_t alloc_size,
+                               ezStaticAllocPlacement placement);
+
+
+/*****************************************************************************
+* Function : ezStaticAlloc_HeapFree
+*//** 
+* @brief Free memory allocated from a heap
+*
+* @details The region is found from the address.
+*
+* @param[in]    *heap: heap
+* @param[in]    *alloc_addr: address returned by ezStaticAlloc_HeapMalloc
+* @return       true if free is success, else false
+*
+* @pre heap is initialized
+* @post None
+*
+* \b Example
+* @code
+* ezStaticAlloc_HeapFree(&heap, hot);
+* @endcode
+*
+* @see ezStaticAlloc_HeapMalloc
+*
+*****************************************************************************/
+bool ezStaticAlloc_HeapFree(ezStaticAllocHeap *heap, void *alloc_addr);
+
+
+/*****************************************************************************
+* Function : ezStaticAlloc_HeapGetRegion
+*//** 
+* @brief Return the memory list whose buffer contains an address
+*
+* @details Lets the caller use the rest of the API, or check in which bank a
+* block was placed.
+*
+* @param[in]    *heap: heap
+* @param[in]    *addr: address
+* @return       memory list, NULL if the address is outside of all regions
+*
+* @pre heap is initialized
+* @post None
+*
+* \b Example
+* @code
+* bool is_fast = (ezStaticAlloc_HeapGetRegion(&heap, hot) == &tcm_list);
+* @endcode
+*
+*****************************************************************************/
+ezmMemList *ezStaticAlloc_HeapGetRegion(ezStaticAllocHeap *heap, void *addr);
+
 #ifdef __cplusplus
 }
 #endif
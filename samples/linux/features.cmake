@@ -8,15 +8,22 @@ option(ENABLE_EZ_LOGGING_COLOR  "Enable logging using color feature"    ON)
 option(ENABLE_EZ_LINKEDLIST     "Enable linked list feature"            ON)
 option(ENABLE_EZ_HEXDUMP        "Enable hexdump feature"                ON)
 option(ENABLE_EZ_RING_BUFFER    "Enable ring buffer feature"            ON)
+option(ENABLE_EZ_RING_BUFFER_32BIT "Use 32-bit ring buffer indices"     ON)
+option(ENABLE_EZ_RING_BUFFER_MIRROR "Mirrored mmap ring buffer (Linux)" ON)
 option(ENABLE_EZ_ASSERT         "Enable assert feature"                 ON)
 option(ENABLE_EZ_STATIC_ALLOC   "Enable static allocation feature"      ON)
 option(ENABLE_EZ_SYS_ERROR      "Enable system error feature"           ON)
 option(ENABLE_EZ_QUEUE          "Enable queue feature"                  ON)
+option(ENABLE_EZ_MPMC_QUEUE     "Enable lock-free MPMC queue feature"   ON)
+option(ENABLE_EZ_POOL           "Enable fixed-size object pool feature" ON)
+option(ENABLE_EZ_ARENA          "Enable arena allocator feature"        ON)
+option(ENABLE_EZ_PRIORITY_QUEUE "Enable priority queue feature"         ON)
 
 # Configure Service modules
 option(ENABLE_EZ_EVENT_BUS         "Enable the Event Bus module"            ON)
 option(ENABLE_EZ_KERNEL            "Enable the Kernel service"              OFF)
 option(ENABLE_EZ_TASK_WORKER       "Enable the task worker"                 ON)
+option(ENABLE_EZ_BLOCKING_QUEUE    "Enable the blocking queue"              ON)
 option(ENABLE_EZ_STATE_MACHINE     "Enable state machine"                   ON)
 
 # Configure application framework
@@ -240,9 +240,9 @@ static ezSTATUS ezOsal_FreeRTOSSemaphoreCreate(ezOsal_SemaphoreHandle_t *handle)
 
 #if (EZ_OSAL_USE_STATIC == 1)
     ASSERT_MSG(handle->static_resource != NULL, "static_resource must be set");
-    handle->handle = xSemaphoreCreateCountingStatic(handle->max_count, 0, (StaticSemaphore_t*)handle->static_resource);
+    handle->handle = xSemaphoreCreateCountingStatic(handle->max_count, handle->initial_count, (StaticSemaphore_t*)handle->static_resource);
 #else
-    handle->handle = xSemaphoreCreateCounting(handle->max_count, 0); 
+    handle->handle = xSemaphoreCreateCounting(handle->max_count, handle->initial_count);
 #endif
     if(handle->handle == NULL)
     {
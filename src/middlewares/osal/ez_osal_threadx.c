@@ -283,7 +283,7 @@ static ezSTATUS ezOsal_ThreadXSemaphoreCreate(ezOsal_SemaphoreHandle_t* semaphor
     
     ASSERT_MSG(semaphore_handle->static_resource != NULL,
         "semaphore_handle->static_resource is null, please set it to ezOsal_SemaphoreResource_t");
-    status = tx_semaphore_create((TX_SEMAPHORE*)semaphore_handle->static_resource, (CHAR *)NULL, semaphore_handle->max_count);
+    status = tx_semaphore_create((TX_SEMAPHORE*)semaphore_handle->static_resource, (CHAR *)NULL, semaphore_handle->initial_count);
     
     if(status != TX_SUCCESS)
     {
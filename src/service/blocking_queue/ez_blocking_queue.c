@@ -0,0 +1,320 @@
+/*****************************************************************************
+* Filename:         ez_blocking_queue.c
+* Author:           Hai Nguyen
+* Original Date:    16.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   ez_blocking_queue.c
+ *  @author Hai Nguyen
+ *  @date   16.10.2026
+ *  @brief  Implementation of the blocking queue component
+ *
+ *  @details A task which cannot push or pop clears the event it waits for
+ *  while holding the lock, releases the lock and waits for the event. The
+ *  other side sets the event after changing the queue while holding the
+ *  lock, so a wake-up between the check and the wait is not lost. Every wake-up
+ *  checks the queue again, several tasks may have been woken by one event.
+ */
+
+/*****************************************************************************
+* Includes
+*****************************************************************************/
+#include "ez_blocking_queue.h"
+
+#if (EZ_BLOCKING_QUEUE == 1)
+#include <string.h>
+#include "ez_default_logging_level.h"
+
+#define DEBUG_LVL   EZ_BLOCKING_QUEUE_LOGGING_LEVEL /**< logging level */
+#define MOD_NAME    "ez_blocking_queue"             /**< module name */
+#include "ez_logging.h"
+
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Component Typedefs
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Component Variable Definitions
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Function Definitions
+*****************************************************************************/
+static ezSTATUS ezBlockingQueue_Wait(ezBlockingQueue *bq,
+                                     uint32_t event_mask,
+                                     uint32_t start_tick,
+                                     uint32_t timeout_ticks);
+
+
+/*****************************************************************************
+* Public functions
+*****************************************************************************/
+ezSTATUS ezBlockingQueue_Create(ezBlockingQueue *bq,
+                                uint8_t *buff,
+                                uint32_t buff_size,
+                                uint32_t capacity,
+                                ezOsal_SemaphoreHandle_t *lock,
+                                ezOsal_EventHandle_t *event)
+{
+    ezSTATUS status = ezSTATUS_ARG_INVALID;
+
+    EZTRACE("ezBlockingQueue_Create(size = %d, capacity = %d)", buff_size, capacity);
+
+    if(bq == NULL || buff == NULL || buff_size == 0U || lock == NULL || event == NULL)
+    {
+        return status;
+    }
+
+    bq->capacity = capacity;
+    bq->lock = lock;
+    bq->event = event;
+
+    status = ezQueue_CreateQueue(&bq->queue, buff, buff_size);
+    if(status == ezSUCCESS)
+    {
+        /* The lock starts free */
+        bq->lock->initial_count = 1U;
+        status = ezOsal_SemaphoreCreate(bq->lock);
+    }
+
+    if(status == ezSUCCESS)
+    {
+        status = ezOsal_EventCreate(bq->event);
+
+        if(status != ezSUCCESS)
+        {
+            (void)ezOsal_SemaphoreDelete(bq->lock);
+        }
+    }
+
+    if(status != ezSUCCESS)
+    {
+        EZERROR("Cannot create queue, semaphore or event");
+    }
+
+    return status;
+}
+
+
+ezSTATUS ezBlockingQueue_Delete(ezBlockingQueue *bq)
+{
+    EZTRACE("ezBlockingQueue_Delete()");
+
+    if(bq == NULL)
+    {
+        return ezSTATUS_ARG_INVALID;
+    }
+
+    (void)ezOsal_EventDelete(bq->event);
+    (void)ezOsal_SemaphoreDelete(bq->lock);
+
+    return ezSUCCESS;
+}
+
+
+ezSTATUS ezBlockingQueue_PushTimeout(ezBlockingQueue *bq,
+                                     void *data,
+                                     uint32_t data_size,
+                                     uint32_t timeout_ticks)
+{
+    ezSTATUS status = ezFAIL;
+    uint32_t num_of_elements = 0U;
+    uint32_t start_tick = 0U;
+
+    EZTRACE("ezBlockingQueue_PushTimeout(size = %d, timeout = %d)", data_size, timeout_ticks);
+
+    if(bq == NULL || data == NULL || data_size == 0U)
+    {
+        return ezSTATUS_ARG_INVALID;
+    }
+
+    start_tick = (uint32_t)ezOsal_TaskGetTickCount();
+    for(;;)
+    {
+        if(ezOsal_SemaphoreTake(bq->lock, EZ_BLOCKING_QUEUE_WAIT_FOREVER) != ezSUCCESS)
+        {
+            return ezFAIL;
+        }
+
+        status = ezFAIL;
+        num_of_elements = ezQueue_GetNumOfElement(&bq->queue);
+        if(bq->capacity == 0U || num_of_elements < bq->capacity)
+        {
+            status = ezQueue_Push(&bq->queue, data, data_size);
+        }
+
+        if(status == ezSUCCESS)
+        {
+            (void)ezOsal_EventSet(bq->event, EZ_BLOCKING_QUEUE_DATA_AVAIL);
+        }
+        else
+        {
+            (void)ezOsal_EventClear(bq->event, EZ_BLOCKING_QUEUE_SPACE_AVAIL);
+        }
+        (void)ezOsal_SemaphoreGive(bq->lock);
+
+        /* An element which does not fit into the empty queue never will */
+        if(status == ezSUCCESS || num_of_elements == 0U)
+        {
+            break;
+        }
+
+        status = ezBlockingQueue_Wait(bq, EZ_BLOCKING_QUEUE_SPACE_AVAIL, start_tick, timeout_ticks);
+        if(status != ezSUCCESS)
+        {
+            break;
+        }
+    }
+
+    return status;
+}
+
+
+ezSTATUS ezBlockingQueue_PopTimeout(ezBlockingQueue *bq,
+                                    void *data,
+                                    uint32_t *data_size,
+                                    uint32_t timeout_ticks)
+{
+    ezSTATUS status = ezFAIL;
+    void *front_data = NULL;
+    uint32_t front_size = 0U;
+    uint32_t start_tick = 0U;
+
+    EZTRACE("ezBlockingQueue_PopTimeout(timeout = %d)", timeout_ticks);
+
+    if(bq == NULL || data == NULL || data_size == NULL)
+    {
+        return ezSTATUS_ARG_INVALID;
+    }
+
+    start_tick = (uint32_t)ezOsal_TaskGetTickCount();
+    for(;;)
+    {
+        if(ezOsal_SemaphoreTake(bq->lock, EZ_BLOCKING_QUEUE_WAIT_FOREVER) != ezSUCCESS)
+        {
+            return ezFAIL;
+        }
+
+        status = ezQueue_GetFront(&bq->queue, &front_data, &front_size);
+        if(status == ezSUCCESS && front_size > *data_size)
+        {
+            status = ezSTATUS_ARG_INVALID;
+        }
+        else if(status == ezSUCCESS)
+        {
+            memcpy(data, front_data, front_size);
+            status = ezQueue_PopFront(&bq->queue);
+            (void)ezOsal_EventSet(bq->event, EZ_BLOCKING_QUEUE_SPACE_AVAIL);
+        }
+        else
+        {
+            (void)ezOsal_EventClear(bq->event, EZ_BLOCKING_QUEUE_DATA_AVAIL);
+        }
+        (void)ezOsal_SemaphoreGive(bq->lock);
+
+        if(front_size > 0U)
+        {
+            *data_size = front_size;
+            break;
+        }
+
+        status = ezBlockingQueue_Wait(bq, EZ_BLOCKING_QUEUE_DATA_AVAIL, start_tick, timeout_ticks);
+        if(status != ezSUCCESS)
+        {
+            break;
+        }
+    }
+
+    return status;
+}
+
+
+uint32_t ezBlockingQueue_GetNumOfElement(ezBlockingQueue *bq)
+{
+    uint32_t num_of_elements = 0U;
+
+    if(bq == NULL)
+    {
+        return num_of_elements;
+    }
+
+    if(ezOsal_SemaphoreTake(bq->lock, EZ_BLOCKING_QUEUE_WAIT_FOREVER) == ezSUCCESS)
+    {
+        num_of_elements = ezQueue_GetNumOfElement(&bq->queue);
+        (void)ezOsal_SemaphoreGive(bq->lock);
+    }
+
+    return num_of_elements;
+}
+
+
+/*****************************************************************************
+* Local functions
+*****************************************************************************/
+
+/*****************************************************************************
+* Function: ezBlockingQueue_Wait
+*//**
+* @brief Wait for an event of the queue within the rest of the timeout
+*
+* @details
+*
+* @param[in]    bq: blocking queue
+* @param[in]    event_mask: EZ_BLOCKING_QUEUE_DATA_AVAIL or
+*                           EZ_BLOCKING_QUEUE_SPACE_AVAIL
+* @param[in]    start_tick: tick count when the operation started
+* @param[in]    timeout_ticks: timeout of the operation
+* @return       ezSUCCESS if the event is set, else ezSTATUS_TIMEOUT
+*
+* @pre the caller has cleared the event while holding the lock
+* @post None
+*
+*****************************************************************************/
+static ezSTATUS ezBlockingQueue_Wait(ezBlockingQueue *bq,
+                                     uint32_t event_mask,
+                                     uint32_t start_tick,
+                                     uint32_t timeout_ticks)
+{
+    uint32_t elapsed_ticks = 0U;
+    uint32_t wait_ticks = EZ_BLOCKING_QUEUE_WAIT_FOREVER;
+
+    if(timeout_ticks != EZ_BLOCKING_QUEUE_WAIT_FOREVER)
+    {
+        elapsed_ticks = (uint32_t)ezOsal_TaskGetTickCount() - start_tick;
+        if(elapsed_ticks >= timeout_ticks)
+        {
+            return ezSTATUS_TIMEOUT;
+        }
+        wait_ticks = timeout_ticks - elapsed_ticks;
+    }
+
+    if(((uint32_t)ezOsal_EventWait(bq->event, event_mask, wait_ticks) & event_mask) == 0U)
+    {
+        EZDEBUG("no event within %d ticks", wait_ticks);
+        return ezSTATUS_TIMEOUT;
+    }
+
+    return ezSUCCESS;
+}
+
+#endif /* EZ_BLOCKING_QUEUE == 1 */
+/* End of file*/
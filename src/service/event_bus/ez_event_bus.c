@@ -43,7 +43,15 @@
 /*****************************************************************************
 * Component Typedefs
 *****************************************************************************/
-
+/** @brief Header of an event in the event queue, the event data follows it.
+ *  The pointer member pads the header so that the event data keeps the
+ *  alignment of the data of a queue element.
+ */
+typedef union
+{
+    uint32_t event_code;    /**< code of the event */
+    void *align;            /**< unused, pads the header */
+} ezEventRecordHeader;
 
 
 /*****************************************************************************
@@ -121,8 +129,10 @@ ezSTATUS ezEventBus_CreateListener(ezEventListener_t *listener, EVENT_CALLBACK c
 
 ezSTATUS ezEventBus_Run(ezEventBus_t * event_bus)
 {
+    void *record = NULL;
+    uint32_t record_size = 0U;
     uint32_t event_code = 0U;
-    void *data = NULL;
+    const void *data = NULL;
     uint32_t data_size = 0U;
     struct Node* it_node = NULL;
     ezEventListener_t *listener = NULL;
@@ -133,41 +143,29 @@ ezSTATUS ezEventBus_Run(ezEventBus_t * event_bus)
         return ezSTATUS_ARG_INVALID;
     }
 
-    if(ezQueue_GetNumOfElement(&event_bus->event_queue) >= 2U)
+    if(ezQueue_GetNumOfElement(&event_bus->event_queue) > 0U)
     {
-        /* Get event code */
         if(ezQueue_GetFront(
             &event_bus->event_queue,
-            &data,
-            &data_size) != ezSUCCESS)
+            &record,
+            &record_size) != ezSUCCESS)
         {
-            EZERROR("Cannot get event code from queue");
-            (void)ezQueue_PopFront(&event_bus->event_queue); /* pop event code */
-            (void)ezQueue_PopFront(&event_bus->event_queue); /* pop event data */
+            EZERROR("Cannot get event from queue");
             return ezFAIL;
         }
 
-        
-        if(data_size != sizeof(uint32_t))
+        if(record_size < sizeof(ezEventRecordHeader))
         {
-            EZERROR("Invalid event code size");
-            (void)ezQueue_PopFront(&event_bus->event_queue); /* pop event code */
-            (void)ezQueue_PopFront(&event_bus->event_queue); /* pop event data */
+            EZERROR("Invalid event size");
+            (void)ezQueue_PopFront(&event_bus->event_queue);
             return ezFAIL;
         }
 
-        event_code = *(uint32_t*)data;
-        (void)ezQueue_PopFront(&event_bus->event_queue);
-
-        /* Get event data */
-        if(ezQueue_GetFront(
-            &event_bus->event_queue,
-            (void*)&data,
-            &data_size) != ezSUCCESS)
+        event_code = ((ezEventRecordHeader*)record)->event_code;
+        data_size = record_size - (uint32_t)sizeof(ezEventRecordHeader);
+        if(data_size > 0U)
         {
-            EZERROR("Cannot get event data from queue");
-            (void)ezQueue_PopFront(&event_bus->event_queue); /* pop event data */
-            return ezFAIL;
+            data = (uint8_t*)record + sizeof(ezEventRecordHeader);
         }
 
         /* Notify all listeners */
@@ -183,7 +181,7 @@ ezSTATUS ezEventBus_Run(ezEventBus_t * event_bus)
             }
         }
 
-         (void)ezQueue_PopFront(&event_bus->event_queue); /* pop event data */
+        (void)ezQueue_PopFront(&event_bus->event_queue);
     }
     return ezSUCCESS;
 }
@@ -259,35 +257,37 @@ bool ezEventBus_SendEvent(
     void *event_data,
     size_t event_data_size)
 {
-    ezReservedElement q_element_event_code = NULL;
-    ezReservedElement q_element_data = NULL;
-    void *code = NULL;
-    void *data = NULL;
+    ezReservedElement q_element = NULL;
+    void *record = NULL;
 
     EZDEBUG("evntNoti_NotifyEnvent()");
-    if(event_bus == NULL)
+    if(event_bus == NULL
+        || (event_data == NULL && event_data_size > 0U)
+        || event_data_size > UINT32_MAX - sizeof(ezEventRecordHeader))
     {
         EZWARNING("  Invalid argument");
         return false;
     }
 
-    
-    q_element_event_code = ezQueue_ReserveElement(&event_bus->event_queue, &code, sizeof(uint32_t));
-    q_element_data = ezQueue_ReserveElement(&event_bus->event_queue, &data, (uint32_t)event_data_size);
+    /* One element per event: the code in the header, the data behind it */
+    q_element = ezQueue_ReserveElement(
+        &event_bus->event_queue,
+        &record,
+        (uint32_t)(sizeof(ezEventRecordHeader) + event_data_size));
 
-    if(q_element_event_code == NULL || q_element_data == NULL)
+    if(q_element == NULL)
     {
         EZWARNING("Cannot reserve event queue element");
-        ezQueue_ReleaseReservedElement(&event_bus->event_queue, q_element_event_code);
-        ezQueue_ReleaseReservedElement(&event_bus->event_queue, q_element_data);
         return false;
     }
 
-    *(uint32_t*)code = event_code;
-    memcpy(data, event_data, event_data_size);
-   
-    ezQueue_PushReservedElement(&event_bus->event_queue, q_element_event_code);
-    ezQueue_PushReservedElement(&event_bus->event_queue, q_element_data);
+    ((ezEventRecordHeader*)record)->event_code = event_code;
+    if(event_data_size > 0U)
+    {
+        memcpy((uint8_t*)record + sizeof(ezEventRecordHeader), event_data, event_data_size);
+    }
+
+    (void)ezQueue_PushReservedElement(&event_bus->event_queue, q_element);
 
     return true;
 }
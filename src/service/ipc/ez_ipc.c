@@ -44,6 +44,10 @@
 #define CONFIG_NUM_OF_IPC_INSTANCE      5U
 #endif /* CONFIG_NUM_OF_IPC_INSTANCE */
 
+#ifndef CONFIG_NUM_OF_IPC_MEM_BLOCK
+#define CONFIG_NUM_OF_IPC_MEM_BLOCK     16U
+#endif /* CONFIG_NUM_OF_IPC_MEM_BLOCK */
+
 #ifndef CONFIG_USING_MODULE_NAME
 #define CONFIG_USING_MODULE_NAME     1U
 #endif /* CONFIG_USING_MODULE_NAME */
@@ -72,6 +76,8 @@ typedef struct
 {
     bool        is_busy;                /**< Store the id of the owner of the instance */
     ezmMemList  memory_list;            /**< Memory list to manage the buffer of the ipc instance*/
+    struct MemBlock blocks[CONFIG_NUM_OF_IPC_MEM_BLOCK];
+                                        /**< Block descriptors of memory_list, not shared with other lists*/
     struct Node pending_list_head;      /**< list contains message pending to be sent*/
     ezmIpc_MessageCallback fnCallback;  /**< Callback function */
 }IpcInstance;
@@ -108,19 +114,23 @@ void ezIpc_InitModule(void)
 }
 
 
-ezmMailBox ezIpc_GetInstance(uint8_t* ipc_buffer, uint16_t buffer_size, ezmIpc_MessageCallback fnCallback)
+ezmMailBox ezIpc_GetInstance(uint8_t* ipc_buffer, uint32_t buffer_size, ezmIpc_MessageCallback fnCallback)
 {
     ezmMailBox free_instance = CONFIG_NUM_OF_IPC_INSTANCE;
     for (uint8_t i = 0; i < CONFIG_NUM_OF_IPC_INSTANCE; i++)
     {
         if (instance_pool[i].is_busy == false)
         {
-            instance_pool[i].is_busy = true;
-            instance_pool[i].fnCallback = fnCallback;
-            instance_pool[i].memory_list.buff = ipc_buffer;
-            instance_pool[i].memory_list.buff_size = buffer_size;
-            (void)ezStaticAlloc_InitMemList(&instance_pool[i].memory_list, ipc_buffer, buffer_size);
-            free_instance = (ezmMailBox)i;
+            if (ezStaticAlloc_InitMemListWithBlocks(&instance_pool[i].memory_list,
+                                                    ipc_buffer,
+                                                    buffer_size,
+                                                    instance_pool[i].blocks,
+                                                    CONFIG_NUM_OF_IPC_MEM_BLOCK) == true)
+            {
+                instance_pool[i].is_busy = true;
+                instance_pool[i].fnCallback = fnCallback;
+                free_instance = (ezmMailBox)i;
+            }
             break;
         }
     }
@@ -178,7 +188,7 @@ bool ezIpc_SendMessage(ezmMailBox send_to, void *message)
 }
 
 
-void* ezIpc_ReceiveMessage(ezmMailBox receive_from, uint16_t *message_size)
+void* ezIpc_ReceiveMessage(ezmMailBox receive_from, uint32_t *message_size)
 {
     void        *buffer_address = NULL;
     IpcInstance *instance = NULL;
@@ -92,6 +92,8 @@ bool ezTaskWorker_CreateWorker(struct ezTaskWorker *worker,
 
             if(status == ezSUCCESS)
             {
+                /* The semaphore guards the queue, it starts free */
+                worker->sem_handle->initial_count = 1U;
                 status = ezOsal_SemaphoreCreate(worker->sem_handle);
             }
 
@@ -0,0 +1,155 @@
+/*****************************************************************************
+* Filename:         ez_arena.c
+* Author:           Hai Nguyen
+* Original Date:    16.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   ez_arena.c
+ *  @author Hai Nguyen
+ *  @date   16.10.2026
+ *  @brief  Implementation of the arena (bump) allocator
+ *
+ *  @details Everything below offset is allocated, everything above is free.
+ *  The alignment is computed on the address, so the buffer itself may have
+ *  any alignment.
+ */
+
+/*****************************************************************************
+* Includes
+*****************************************************************************/
+#include "ez_arena.h"
+
+#if (EZ_ARENA == 1U)
+#include <stddef.h>
+
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Component Typedefs
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Component Variable Definitions
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Function Definitions
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Public functions
+*****************************************************************************/
+bool ezArena_Init(ezArena *arena, void *buff, uint32_t buff_size)
+{
+    if(arena == NULL || buff == NULL || buff_size == 0U)
+    {
+        return false;
+    }
+
+    arena->buff = (uint8_t *)buff;
+    arena->buff_size = buff_size;
+    arena->offset = 0U;
+    arena->peak = 0U;
+
+    return true;
+}
+
+
+void *ezArena_Alloc(ezArena *arena, uint32_t size)
+{
+    return ezArena_AllocAligned(arena, size, (uint32_t)CONFIG_EZ_ARENA_ALIGNMENT);
+}
+
+
+void *ezArena_AllocAligned(ezArena *arena, uint32_t size, uint32_t alignment)
+{
+    uint32_t padding = 0U;
+    uint8_t *mem = NULL;
+
+    if(size == 0U || alignment == 0U || (alignment & (alignment - 1U)) != 0U)
+    {
+        return NULL;
+    }
+
+    padding = (uint32_t)((alignment - ((uintptr_t)&arena->buff[arena->offset] & (alignment - 1U)))
+                         & (alignment - 1U));
+
+    if((uint64_t)arena->offset + padding + size > arena->buff_size)
+    {
+        return NULL;
+    }
+
+    mem = &arena->buff[arena->offset + padding];
+    arena->offset += padding + size;
+    if(arena->offset > arena->peak)
+    {
+        arena->peak = arena->offset;
+    }
+
+    return mem;
+}
+
+
+ezArenaMark ezArena_GetMark(ezArena *arena)
+{
+    return arena->offset;
+}
+
+
+bool ezArena_Rewind(ezArena *arena, ezArenaMark mark)
+{
+    if(mark > arena->offset)
+    {
+        return false;
+    }
+
+    arena->offset = mark;
+    return true;
+}
+
+
+void ezArena_Reset(ezArena *arena)
+{
+    arena->offset = 0U;
+}
+
+
+uint32_t ezArena_GetFreeSize(ezArena *arena)
+{
+    return arena->buff_size - arena->offset;
+}
+
+
+uint32_t ezArena_GetPeak(ezArena *arena)
+{
+    return arena->peak;
+}
+
+
+/*****************************************************************************
+* Local functions
+*****************************************************************************/
+/* None */
+
+#endif /* EZ_ARENA == 1U */
+
+/* End of file */
@@ -0,0 +1,201 @@
+/*****************************************************************************
+* Filename:         ez_mpmc_queue.c
+* Author:           Hai Nguyen
+* Original Date:    16.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   ez_mpmc_queue.c
+ *  @author Hai Nguyen
+ *  @date   16.10.2026
+ *  @brief  Implementation of the multi-producer/multi-consumer queue
+ *
+ *  @details Bounded queue with per-slot sequence numbers (D. Vyukov).
+ *  Slot i is initialized with sequence i. A producer at position pos may
+ *  write slot (pos & mask) when its sequence equals pos and publishes it
+ *  with pos + 1. A consumer at position pos may read it when the sequence
+ *  equals pos + 1 and releases it for the next lap with pos + num_of_slots.
+ */
+
+/*****************************************************************************
+* Includes
+*****************************************************************************/
+#include "ez_mpmc_queue.h"
+
+#if (EZ_MPMC_QUEUE == 1U)
+#include <string.h>
+#include "ez_atomic.h"
+
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Component Typedefs
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Component Variable Definitions
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Function Definitions
+*****************************************************************************/
+static uint32_t *ezMpmcQueue_GetSequence(ezMpmcQueue *queue, uint32_t pos);
+
+
+/*****************************************************************************
+* Public functions
+*****************************************************************************/
+bool ezMpmcQueue_Init(ezMpmcQueue *queue,
+                      void *buff,
+                      uint32_t buff_size,
+                      uint32_t elem_size,
+                      uint32_t num_of_slots)
+{
+    uint32_t slot_size = (uint32_t)EZ_MPMC_QUEUE_SLOT_SIZE(elem_size);
+
+    if(queue == NULL || buff == NULL || elem_size == 0U
+       || num_of_slots < 2U || (num_of_slots & (num_of_slots - 1U)) != 0U
+       || ((uintptr_t)buff & (sizeof(uint32_t) - 1U)) != 0U
+       || (uint64_t)slot_size * num_of_slots > buff_size)
+    {
+        return false;
+    }
+
+    queue->buff = (uint8_t *)buff;
+    queue->slot_size = slot_size;
+    queue->elem_size = elem_size;
+    queue->mask = num_of_slots - 1U;
+
+    for(uint32_t i = 0; i < num_of_slots; i++)
+    {
+        EZ_ATOMIC_STORE_RELAXED(ezMpmcQueue_GetSequence(queue, i), i);
+    }
+
+    EZ_ATOMIC_STORE_RELAXED(&queue->dequeue_pos, 0U);
+    EZ_ATOMIC_STORE_RELEASE(&queue->enqueue_pos, 0U);
+    return true;
+}
+
+
+bool ezMpmcQueue_Enqueue(ezMpmcQueue *queue, const void *elem)
+{
+    uint32_t pos = EZ_ATOMIC_LOAD_RELAXED(&queue->enqueue_pos);
+    uint32_t *sequence = NULL;
+
+    for(;;)
+    {
+        sequence = ezMpmcQueue_GetSequence(queue, pos);
+        int32_t diff = (int32_t)(EZ_ATOMIC_LOAD_ACQUIRE(sequence) - pos);
+
+        if(diff == 0)
+        {
+            /* Slot is free for this lap, try to claim the position */
+            if(EZ_ATOMIC_CAS_WEAK(&queue->enqueue_pos, &pos, pos + 1U))
+            {
+                break;
+            }
+        }
+        else if(diff < 0)
+        {
+            /* The consumer of the previous lap has not released the slot */
+            return false;
+        }
+        else
+        {
+            /* Another producer claimed the position */
+            pos = EZ_ATOMIC_LOAD_RELAXED(&queue->enqueue_pos);
+        }
+    }
+
+    memcpy(sequence + 1, elem, queue->elem_size);
+    EZ_ATOMIC_STORE_RELEASE(sequence, pos + 1U);
+    return true;
+}
+
+
+bool ezMpmcQueue_Dequeue(ezMpmcQueue *queue, void *elem)
+{
+    uint32_t pos = EZ_ATOMIC_LOAD_RELAXED(&queue->dequeue_pos);
+    uint32_t *sequence = NULL;
+
+    for(;;)
+    {
+        sequence = ezMpmcQueue_GetSequence(queue, pos);
+        int32_t diff = (int32_t)(EZ_ATOMIC_LOAD_ACQUIRE(sequence) - (pos + 1U));
+
+        if(diff == 0)
+        {
+            /* Slot is filled, try to claim the position */
+            if(EZ_ATOMIC_CAS_WEAK(&queue->dequeue_pos, &pos, pos + 1U))
+            {
+                break;
+            }
+        }
+        else if(diff < 0)
+        {
+            /* The producer has not published the slot yet */
+            return false;
+        }
+        else
+        {
+            /* Another consumer claimed the position */
+            pos = EZ_ATOMIC_LOAD_RELAXED(&queue->dequeue_pos);
+        }
+    }
+
+    memcpy(elem, sequence + 1, queue->elem_size);
+    EZ_ATOMIC_STORE_RELEASE(sequence, pos + queue->mask + 1U);
+    return true;
+}
+
+
+uint32_t ezMpmcQueue_GetNumOfElements(ezMpmcQueue *queue)
+{
+    uint32_t dequeue_pos = EZ_ATOMIC_LOAD_ACQUIRE(&queue->dequeue_pos);
+    uint32_t enqueue_pos = EZ_ATOMIC_LOAD_ACQUIRE(&queue->enqueue_pos);
+    uint32_t count = enqueue_pos - dequeue_pos;
+
+    /* A stale snapshot may show more elements than slots */
+    return (count > queue->mask + 1U) ? (queue->mask + 1U) : count;
+}
+
+
+/*****************************************************************************
+* Local functions
+*****************************************************************************/
+
+/******************************************************************************
+* Function : ezMpmcQueue_GetSequence
+*//**
+* @Description: Return the sequence number of the slot used by position pos.
+*               The element follows directly after it
+*
+* @param    queue: (IN)pointer to the queue
+* @param    pos: (IN)enqueue or dequeue position
+* @return   pointer to the sequence number
+*
+*******************************************************************************/
+static uint32_t *ezMpmcQueue_GetSequence(ezMpmcQueue *queue, uint32_t pos)
+{
+    return (uint32_t *)(void *)&queue->buff[(pos & queue->mask) * queue->slot_size];
+}
+
+#endif /* EZ_MPMC_QUEUE == 1U */
+
+/* End of file */
@@ -0,0 +1,296 @@
+/*****************************************************************************
+* Filename:         ez_pool.c
+* Author:           Hai Nguyen
+* Original Date:    16.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   ez_pool.c
+ *  @author Hai Nguyen
+ *  @date   16.10.2026
+ *  @brief  Implementation of the fixed-size object pool
+ *
+ *  @details Bitmap mode: bit i of the bitmap is set while object i is
+ *  allocated. Bits past the last object are set at init, so they are never
+ *  handed out. All words before search_word are full.
+ *
+ *  Lock-free mode: every free object stores index + 1 of the next free
+ *  object in its first word (0 ends the stack). The top of the stack carries
+ *  a 16-bit tag that changes on every pop and push, so a compare-and-swap by
+ *  a task holding a stale top fails (ABA).
+ */
+
+/*****************************************************************************
+* Includes
+*****************************************************************************/
+#include "ez_pool.h"
+
+#if (EZ_POOL == 1U)
+#include <stddef.h>
+#include "ez_atomic.h"
+
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+#define BITS_PER_WORD       32U
+#define TOP_INDEX_MASK      0xFFFFU         /**< index + 1 part of free_top */
+#define TOP_TAG_MASK        0xFFFF0000U     /**< tag part of free_top */
+#define TOP_TAG_INC         0x10000U        /**< increment of the tag */
+
+
+/*****************************************************************************
+* Component Typedefs
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Component Variable Definitions
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Function Definitions
+*****************************************************************************/
+static uint32_t ezPool_Ctz(uint32_t value);
+static uint32_t *ezPool_GetLink(ezPool *pool, uint32_t index);
+static bool ezPool_GetIndex(ezPool *pool, void *obj, uint32_t *index);
+
+
+/*****************************************************************************
+* Public functions
+*****************************************************************************/
+bool ezPool_Init(ezPool *pool,
+                 void *buff,
+                 uint32_t buff_size,
+                 uint32_t obj_size,
+                 uint32_t num_of_objs,
+                 bool lock_free)
+{
+    uint32_t num_of_words = (num_of_objs + BITS_PER_WORD - 1U) / BITS_PER_WORD;
+    uint32_t aligned_size = EZ_POOL_OBJ_SIZE(obj_size);
+    uint8_t *start = NULL;
+
+    /* The room for aligning the start is required even if buff happens to
+     * be aligned, so a buffer size which works once works everywhere */
+    if(pool == NULL || buff == NULL || obj_size == 0U || num_of_objs == 0U
+       || obj_size > UINT32_MAX - CONFIG_EZ_POOL_ALIGNMENT
+       || ((uintptr_t)buff & (sizeof(uint32_t) - 1U)) != 0U
+       || (lock_free && num_of_objs > EZ_POOL_LOCK_FREE_MAX_OBJS)
+       || (uint64_t)(CONFIG_EZ_POOL_ALIGNMENT - sizeof(uint32_t))
+          + EZ_POOL_BITMAP_SIZE(num_of_objs)
+          + ((uint64_t)aligned_size * num_of_objs) > buff_size)
+    {
+        return false;
+    }
+
+    start = (uint8_t *)buff
+            + ((CONFIG_EZ_POOL_ALIGNMENT - ((uintptr_t)buff & (CONFIG_EZ_POOL_ALIGNMENT - 1U)))
+               & (CONFIG_EZ_POOL_ALIGNMENT - 1U));
+    pool->bitmap = (uint32_t *)(void *)start;
+    pool->objs = start + EZ_POOL_BITMAP_SIZE(num_of_objs);
+    pool->obj_size = aligned_size;
+    pool->num_of_objs = num_of_objs;
+    pool->num_of_free = num_of_objs;
+    pool->search_word = 0U;
+    pool->free_top = 0U;
+    pool->lock_free = lock_free;
+
+    if(lock_free)
+    {
+        for(uint32_t i = 0; i < num_of_objs; i++)
+        {
+            *ezPool_GetLink(pool, i) = (i + 1U < num_of_objs) ? (i + 2U) : 0U;
+        }
+        EZ_ATOMIC_STORE_RELEASE(&pool->free_top, 1U);
+    }
+    else
+    {
+        for(uint32_t i = 0; i < num_of_words; i++)
+        {
+            pool->bitmap[i] = 0U;
+        }
+
+        if((num_of_objs % BITS_PER_WORD) != 0U)
+        {
+            pool->bitmap[num_of_words - 1U] = ~((1U << (num_of_objs % BITS_PER_WORD)) - 1U);
+        }
+    }
+
+    return true;
+}
+
+
+void *ezPool_Alloc(ezPool *pool)
+{
+    uint32_t num_of_words = (pool->num_of_objs + BITS_PER_WORD - 1U) / BITS_PER_WORD;
+    uint32_t top = 0U;
+    uint32_t next = 0U;
+    uint32_t bit = 0U;
+
+    if(pool->lock_free)
+    {
+        top = EZ_ATOMIC_LOAD_ACQUIRE(&pool->free_top);
+        do
+        {
+            if((top & TOP_INDEX_MASK) == 0U)
+            {
+                return NULL;
+            }
+
+            /* The object may be popped by another task meanwhile, then the
+             * tag has changed and the compare-and-swap fails */
+            next = EZ_ATOMIC_LOAD_RELAXED(ezPool_GetLink(pool, (top & TOP_INDEX_MASK) - 1U));
+        } while(!EZ_ATOMIC_CAS_WEAK(&pool->free_top, &top,
+                                    ((top + TOP_TAG_INC) & TOP_TAG_MASK) | next));
+
+        (void)EZ_ATOMIC_FETCH_ADD(&pool->num_of_free, 0xFFFFFFFFU);
+        return &pool->objs[((top & TOP_INDEX_MASK) - 1U) * pool->obj_size];
+    }
+
+    for(uint32_t i = pool->search_word; i < num_of_words; i++)
+    {
+        if(pool->bitmap[i] != 0xFFFFFFFFU)
+        {
+            bit = ezPool_Ctz(~pool->bitmap[i]);
+            pool->bitmap[i] |= (1U << bit);
+            pool->search_word = i;
+            pool->num_of_free--;
+            return &pool->objs[((i * BITS_PER_WORD) + bit) * pool->obj_size];
+        }
+    }
+
+    pool->search_word = num_of_words;
+    return NULL;
+}
+
+
+bool ezPool_Free(ezPool *pool, void *obj)
+{
+    uint32_t index = 0U;
+    uint32_t top = 0U;
+    uint32_t word = 0U;
+    uint32_t mask = 0U;
+
+    if(!ezPool_GetIndex(pool, obj, &index))
+    {
+        return false;
+    }
+
+    if(pool->lock_free)
+    {
+        top = EZ_ATOMIC_LOAD_RELAXED(&pool->free_top);
+        do
+        {
+            EZ_ATOMIC_STORE_RELAXED(ezPool_GetLink(pool, index), top & TOP_INDEX_MASK);
+        } while(!EZ_ATOMIC_CAS_WEAK(&pool->free_top, &top,
+                                    ((top + TOP_TAG_INC) & TOP_TAG_MASK) | (index + 1U)));
+
+        (void)EZ_ATOMIC_FETCH_ADD(&pool->num_of_free, 1U);
+        return true;
+    }
+
+    word = index / BITS_PER_WORD;
+    mask = 1U << (index % BITS_PER_WORD);
+    if((pool->bitmap[word] & mask) == 0U)
+    {
+        /* Double free */
+        return false;
+    }
+
+    pool->bitmap[word] &= ~mask;
+    pool->num_of_free++;
+    if(word < pool->search_word)
+    {
+        pool->search_word = word;
+    }
+
+    return true;
+}
+
+
+uint32_t ezPool_GetNumOfFree(ezPool *pool)
+{
+    return EZ_ATOMIC_LOAD_RELAXED(&pool->num_of_free);
+}
+
+
+/*****************************************************************************
+* Local functions
+*****************************************************************************/
+
+/******************************************************************************
+* Function : ezPool_Ctz
+*//**
+* @Description: Return the index of the least significant set bit
+*
+* @param    value: (IN)value, must not be 0
+* @return   bit index
+*
+*******************************************************************************/
+static uint32_t ezPool_Ctz(uint32_t value)
+{
+    return (uint32_t)__builtin_ctz(value);
+}
+
+
+/******************************************************************************
+* Function : ezPool_GetLink
+*//**
+* @Description: Return the first word of an object, holding the link to the
+*               next free object in lock-free mode
+*
+* @param    pool: (IN)pointer to the pool
+* @param    index: (IN)index of the object
+* @return   pointer to the link
+*
+*******************************************************************************/
+static uint32_t *ezPool_GetLink(ezPool *pool, uint32_t index)
+{
+    return (uint32_t *)(void *)&pool->objs[index * pool->obj_size];
+}
+
+
+/******************************************************************************
+* Function : ezPool_GetIndex
+*//**
+* @Description: Return the index of an object of the pool
+*
+* @param    pool: (IN)pointer to the pool
+* @param    obj: (IN)pointer to the object
+* @param    index: (OUT)index of the object
+* @return   true if obj points to the start of an object of the pool
+*
+*******************************************************************************/
+static bool ezPool_GetIndex(ezPool *pool, void *obj, uint32_t *index)
+{
+    uintptr_t offset = 0U;
+
+    if(obj == NULL || (uint8_t *)obj < pool->objs)
+    {
+        return false;
+    }
+
+    offset = (uintptr_t)((uint8_t *)obj - pool->objs);
+    if(offset >= (uintptr_t)pool->obj_size * pool->num_of_objs
+       || (offset % pool->obj_size) != 0U)
+    {
+        return false;
+    }
+
+    *index = (uint32_t)(offset / pool->obj_size);
+    return true;
+}
+
+#endif /* EZ_POOL == 1U */
+
+/* End of file */
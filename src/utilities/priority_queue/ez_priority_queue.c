@@ -0,0 +1,376 @@
+/*****************************************************************************
+* Filename:         ez_priority_queue.c
+* Author:           Hai Nguyen
+* Original Date:    16.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   ez_priority_queue.c
+ *  @author Hai Nguyen
+ *  @date   16.10.2026
+ *  @brief  Implementation of the priority queue
+ *
+ *  @details The heap holds slot indices, so sifting moves one word per level
+ *  instead of the element. Every slot stores its position in the heap, which
+ *  lets DecreaseKey find the element of a handle. The tail of the heap array
+ *  behind the last element holds the free slots, a pop leaves the slot of the
+ *  popped element there.
+ */
+
+/*****************************************************************************
+* Includes
+*****************************************************************************/
+#include "ez_priority_queue.h"
+
+#if (EZ_PRIORITY_QUEUE == 1U)
+#include <stddef.h>
+#include <string.h>
+
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+#define SLOT_PRIORITY       0U  /**< word of the priority in a slot */
+#define SLOT_SEQ            1U  /**< word of the sequence number in a slot */
+#define SLOT_POS            2U  /**< word of the position in the heap */
+/** @brief first word of the data, behind the header padded to the alignment */
+#define SLOT_DATA           (EZ_PRIORITY_QUEUE_ALIGN_UP(3U * sizeof(uint32_t)) / sizeof(uint32_t))
+
+
+/*****************************************************************************
+* Component Typedefs
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Component Variable Definitions
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Function Definitions
+*****************************************************************************/
+static uint32_t *ezPriorityQueue_GetSlot(ezPriorityQueue *pq, uint32_t slot);
+static bool ezPriorityQueue_IsBefore(ezPriorityQueue *pq, uint32_t slot_a, uint32_t slot_b);
+static void ezPriorityQueue_Place(ezPriorityQueue *pq, uint32_t pos, uint32_t slot);
+static void ezPriorityQueue_SiftUp(ezPriorityQueue *pq, uint32_t pos);
+static void ezPriorityQueue_SiftDown(ezPriorityQueue *pq, uint32_t pos);
+
+
+/*****************************************************************************
+* Public functions
+*****************************************************************************/
+bool ezPriorityQueue_Init(ezPriorityQueue *pq,
+                          void *buff,
+                          uint32_t buff_size,
+                          uint32_t elem_size,
+                          uint32_t capacity)
+{
+    uint64_t heap_size = 0U;
+    uint8_t *start = NULL;
+
+    if(pq == NULL || buff == NULL || elem_size == 0U || capacity == 0U
+       || elem_size > (UINT32_MAX - (2U * CONFIG_EZ_PRIORITY_QUEUE_ALIGNMENT))
+       || ((uintptr_t)buff & (sizeof(uint32_t) - 1U)) != 0U)
+    {
+        return false;
+    }
+
+    /* The room for aligning the start is required even if buff happens to
+     * be aligned, so a buffer size which works once works everywhere */
+    heap_size = ((uint64_t)capacity * sizeof(uint32_t) + CONFIG_EZ_PRIORITY_QUEUE_ALIGNMENT - 1U)
+                & ~(uint64_t)(CONFIG_EZ_PRIORITY_QUEUE_ALIGNMENT - 1U);
+    if((uint64_t)buff_size < (CONFIG_EZ_PRIORITY_QUEUE_ALIGNMENT - sizeof(uint32_t)) + heap_size
+                             + ((uint64_t)capacity * EZ_PRIORITY_QUEUE_SLOT_WORDS(elem_size) * sizeof(uint32_t)))
+    {
+        return false;
+    }
+
+    start = (uint8_t *)buff
+            + ((CONFIG_EZ_PRIORITY_QUEUE_ALIGNMENT - ((uintptr_t)buff & (CONFIG_EZ_PRIORITY_QUEUE_ALIGNMENT - 1U)))
+               & (CONFIG_EZ_PRIORITY_QUEUE_ALIGNMENT - 1U));
+    pq->heap = (uint32_t *)(void *)start;
+    pq->slots = (uint32_t *)(void *)(start + heap_size);
+    pq->slot_words = EZ_PRIORITY_QUEUE_SLOT_WORDS(elem_size);
+    pq->elem_size = elem_size;
+    pq->capacity = capacity;
+    pq->count = 0U;
+    pq->next_seq = 0U;
+
+    for(uint32_t i = 0; i < capacity; i++)
+    {
+        pq->heap[i] = i;
+    }
+
+    return true;
+}
+
+
+bool ezPriorityQueue_Push(ezPriorityQueue *pq,
+                          const void *elem,
+                          uint32_t priority,
+                          ezPriorityQueueHandle *handle)
+{
+    uint32_t slot = 0U;
+    uint32_t *slot_words = NULL;
+
+    if(pq == NULL || elem == NULL || pq->count >= pq->capacity)
+    {
+        return false;
+    }
+
+    slot = pq->heap[pq->count];
+    slot_words = ezPriorityQueue_GetSlot(pq, slot);
+    slot_words[SLOT_PRIORITY] = priority;
+    slot_words[SLOT_SEQ] = pq->next_seq;
+    memcpy(&slot_words[SLOT_DATA], elem, pq->elem_size);
+
+    pq->next_seq++;
+    ezPriorityQueue_Place(pq, pq->count, slot);
+    pq->count++;
+    ezPriorityQueue_SiftUp(pq, pq->count - 1U);
+
+    if(handle != NULL)
+    {
+        *handle = slot;
+    }
+
+    return true;
+}
+
+
+bool ezPriorityQueue_Pop(ezPriorityQueue *pq, void *elem, uint32_t *priority)
+{
+    uint32_t top = 0U;
+    uint32_t *slot_words = NULL;
+
+    if(pq == NULL || elem == NULL || pq->count == 0U)
+    {
+        return false;
+    }
+
+    top = pq->heap[0];
+    slot_words = ezPriorityQueue_GetSlot(pq, top);
+    memcpy(elem, &slot_words[SLOT_DATA], pq->elem_size);
+    if(priority != NULL)
+    {
+        *priority = slot_words[SLOT_PRIORITY];
+    }
+
+    /* The last element fills the root, the freed slot takes its place */
+    pq->count--;
+    if(pq->count > 0U)
+    {
+        ezPriorityQueue_Place(pq, 0U, pq->heap[pq->count]);
+        ezPriorityQueue_SiftDown(pq, 0U);
+    }
+    pq->heap[pq->count] = top;
+
+    return true;
+}
+
+
+void *ezPriorityQueue_Peek(ezPriorityQueue *pq, uint32_t *priority)
+{
+    uint32_t *slot_words = NULL;
+
+    if(pq == NULL || pq->count == 0U)
+    {
+        return NULL;
+    }
+
+    slot_words = ezPriorityQueue_GetSlot(pq, pq->heap[0]);
+    if(priority != NULL)
+    {
+        *priority = slot_words[SLOT_PRIORITY];
+    }
+
+    return &slot_words[SLOT_DATA];
+}
+
+
+bool ezPriorityQueue_DecreaseKey(ezPriorityQueue *pq,
+                                 ezPriorityQueueHandle handle,
+                                 uint32_t priority)
+{
+    uint32_t *slot_words = NULL;
+    uint32_t pos = 0U;
+
+    if(pq == NULL || handle >= pq->capacity)
+    {
+        return false;
+    }
+
+    /* The position of a free slot is stale, the heap tells if it is used */
+    slot_words = ezPriorityQueue_GetSlot(pq, handle);
+    pos = slot_words[SLOT_POS];
+    if(pos >= pq->count || pq->heap[pos] != handle
+       || priority > slot_words[SLOT_PRIORITY])
+    {
+        return false;
+    }
+
+    slot_words[SLOT_PRIORITY] = priority;
+    ezPriorityQueue_SiftUp(pq, pos);
+
+    return true;
+}
+
+
+uint32_t ezPriorityQueue_GetNumOfElement(ezPriorityQueue *pq)
+{
+    if(pq == NULL)
+    {
+        return 0U;
+    }
+
+    return pq->count;
+}
+
+
+/*****************************************************************************
+* Local functions
+*****************************************************************************/
+
+/******************************************************************************
+* Function : ezPriorityQueue_GetSlot
+*//**
+* @Description: Return the first word of a slot
+*
+* @param    pq: (IN)pointer to the priority queue
+* @param    slot: (IN)index of the slot
+* @return   first word of the slot
+*
+*******************************************************************************/
+static uint32_t *ezPriorityQueue_GetSlot(ezPriorityQueue *pq, uint32_t slot)
+{
+    return pq->slots + ((size_t)slot * pq->slot_words);
+}
+
+
+/******************************************************************************
+* Function : ezPriorityQueue_IsBefore
+*//**
+* @Description: Return true if the element in slot_a must be popped before
+*               the element in slot_b
+*
+* @param    pq: (IN)pointer to the priority queue
+* @param    slot_a: (IN)index of the first slot
+* @param    slot_b: (IN)index of the second slot
+* @return   true if slot_a has a lower priority value, or the same and was
+*           pushed earlier
+*
+*******************************************************************************/
+static bool ezPriorityQueue_IsBefore(ezPriorityQueue *pq, uint32_t slot_a, uint32_t slot_b)
+{
+    uint32_t *a = ezPriorityQueue_GetSlot(pq, slot_a);
+    uint32_t *b = ezPriorityQueue_GetSlot(pq, slot_b);
+
+    if(a[SLOT_PRIORITY] != b[SLOT_PRIORITY])
+    {
+        return a[SLOT_PRIORITY] < b[SLOT_PRIORITY];
+    }
+
+    /* Serial number arithmetic, correct across the wrap around of next_seq
+     * as long as the elements in the queue were pushed within 2^31 pushes */
+    return (int32_t)(a[SLOT_SEQ] - b[SLOT_SEQ]) < 0;
+}
+
+
+/******************************************************************************
+* Function : ezPriorityQueue_Place
+*//**
+* @Description: Put a slot at a position of the heap
+*
+* @param    pq: (IN)pointer to the priority queue
+* @param    pos: (IN)position in the heap
+* @param    slot: (IN)index of the slot
+* @return   None
+*
+*******************************************************************************/
+static void ezPriorityQueue_Place(ezPriorityQueue *pq, uint32_t pos, uint32_t slot)
+{
+    pq->heap[pos] = slot;
+    ezPriorityQueue_GetSlot(pq, slot)[SLOT_POS] = pos;
+}
+
+
+/******************************************************************************
+* Function : ezPriorityQueue_SiftUp
+*//**
+* @Description: Move the element at pos towards the root until its parent
+*               comes before it
+*
+* @param    pq: (IN)pointer to the priority queue
+* @param    pos: (IN)position in the heap
+* @return   None
+*
+*******************************************************************************/
+static void ezPriorityQueue_SiftUp(ezPriorityQueue *pq, uint32_t pos)
+{
+    uint32_t slot = pq->heap[pos];
+    uint32_t parent = 0U;
+
+    while(pos > 0U)
+    {
+        parent = (pos - 1U) / 2U;
+        if(!ezPriorityQueue_IsBefore(pq, slot, pq->heap[parent]))
+        {
+            break;
+        }
+        ezPriorityQueue_Place(pq, pos, pq->heap[parent]);
+        pos = parent;
+    }
+
+    ezPriorityQueue_Place(pq, pos, slot);
+}
+
+
+/******************************************************************************
+* Function : ezPriorityQueue_SiftDown
+*//**
+* @Description: Move the element at pos towards the leaves until it comes
+*               before both children
+*
+* @param    pq: (IN)pointer to the priority queue
+* @param    pos: (IN)position in the heap
+* @return   None
+*
+*******************************************************************************/
+static void ezPriorityQueue_SiftDown(ezPriorityQueue *pq, uint32_t pos)
+{
+    uint32_t slot = pq->heap[pos];
+    uint32_t child = 0U;
+
+    while(pos < pq->count / 2U)
+    {
+        child = (2U * pos) + 1U;
+        if(child + 1U < pq->count
+           && ezPriorityQueue_IsBefore(pq, pq->heap[child + 1U], pq->heap[child]))
+        {
+            child++;
+        }
+
+        if(!ezPriorityQueue_IsBefore(pq, pq->heap[child], slot))
+        {
+            break;
+        }
+        ezPriorityQueue_Place(pq, pos, pq->heap[child]);
+        pos = child;
+    }
+
+    ezPriorityQueue_Place(pq, pos, slot);
+}
+
+#endif /* EZ_PRIORITY_QUEUE == 1U */
+
+/* End of file */
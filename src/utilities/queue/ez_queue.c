@@ -37,15 +37,18 @@
 /*****************************************************************************
 * Module Preprocessor Macros
 *****************************************************************************/
-/* None */
+#define ITEM_ALIGNMENT      ((uint32_t)sizeof(void*))   /**< alignment of the element header */
+
+/** @brief round size up to a multiple of alignment, a power of two */
+#define ALIGN_UP(size, alignment)   (((size) + (alignment) - 1U) & ~((uint32_t)(alignment) - 1U))
 
 /*****************************************************************************
 * Module Typedefs
 *****************************************************************************/
 
 
-/** @brief item of the queue structure
- *
+/** @brief item of the queue structure. The data follows the item in the
+ *  same memory block
  */
 typedef struct
 {
@@ -75,12 +78,40 @@ ezSTATUS ezQueue_CreateQueue(ezQueue *queue, uint8_t *buff, uint32_t buff_size)
 
     EZTRACE("ezQueue_CreateQueue( size = %d)", buff_size);
 
-    memset(buff, 0, buff_size);
+    if (queue != NULL && buff != NULL && buff_size > 0)
+    {
+        memset(buff, 0, buff_size);
+        ezLinkedList_InitNode(&queue->q_item_list);
+        queue->num_of_elements = 0U;
+        queue->domain = &queue->mem_list;
+        if (ezStaticAlloc_InitMemList(&queue->mem_list, buff, buff_size) == true)
+        {
+            status = ezSUCCESS;
+            EZDEBUG("create queue success");
+        }
+    }
+
+    return status;
+}
+
+
+ezSTATUS ezQueue_CreateQueueWithBlocks(ezQueue *queue,
+                                       uint8_t *buff,
+                                       uint32_t buff_size,
+                                       struct MemBlock *blocks,
+                                       uint16_t num_of_blocks)
+{
+    ezSTATUS status = ezFAIL;
+
+    EZTRACE("ezQueue_CreateQueueWithBlocks( size = %d, blocks = %d)", buff_size, num_of_blocks);
 
     if (queue != NULL && buff != NULL && buff_size > 0)
     {
+        memset(buff, 0, buff_size);
         ezLinkedList_InitNode(&queue->q_item_list);
-        if (ezStaticAlloc_InitMemList(&queue->mem_list, buff, (uint16_t)buff_size) == true)
+        queue->num_of_elements = 0U;
+        queue->domain = &queue->mem_list;
+        if (ezStaticAlloc_InitMemListWithBlocks(&queue->mem_list, buff, buff_size, blocks, num_of_blocks) == true)
         {
             status = ezSUCCESS;
             EZDEBUG("create queue success");
@@ -90,6 +121,25 @@ ezSTATUS ezQueue_CreateQueue(ezQueue *queue, uint8_t *buff, uint32_t buff_size)
     return status;
 }
 
+
+ezSTATUS ezQueue_CreateQueueShared(ezQueue *queue, ezmMemList *domain)
+{
+    ezSTATUS status = ezFAIL;
+
+    EZTRACE("ezQueue_CreateQueueShared()");
+
+    if (queue != NULL && domain != NULL && ezStaticAlloc_IsMemListReady(domain) == true)
+    {
+        ezLinkedList_InitNode(&queue->q_item_list);
+        queue->num_of_elements = 0U;
+        queue->domain = domain;
+        status = ezSUCCESS;
+        EZDEBUG("create shared queue success");
+    }
+
+    return status;
+}
+
 ezSTATUS ezQueue_PopFront(ezQueue* queue)
 {
     ezSTATUS status = ezSUCCESS;
@@ -99,25 +149,17 @@ ezSTATUS ezQueue_PopFront(ezQueue* queue)
 
     if (queue != NULL)
     {
-        if (ezQueue_GetNumOfElement(queue) > 0)
+        if (queue->num_of_elements > 0)
         {
             popped_item = EZ_LINKEDLIST_GET_PARENT_OF(queue->q_item_list.next, node, ezQueueItem);
             EZ_LINKEDLIST_UNLINK_NODE(&popped_item->node);
+            queue->num_of_elements--;
 
-            if (ezStaticAlloc_Free(&queue->mem_list, popped_item->data) == false)
+            if (ezStaticAlloc_Free(queue->domain, (void*)popped_item) == false)
             {
                 status = ezFAIL;
                 EZTRACE("free fail");
             }
-
-            if (status == ezSUCCESS)
-            {
-                if (ezStaticAlloc_Free(&queue->mem_list, (void*)popped_item) == false)
-                {
-                    status = ezFAIL;
-                    EZTRACE("free fail");
-                }
-            }
         }
     }
     else
@@ -138,25 +180,17 @@ ezSTATUS ezQueue_PopBack(ezQueue *queue)
 
     if (queue != NULL)
     {
-        if (ezQueue_GetNumOfElement(queue) > 0)
+        if (queue->num_of_elements > 0)
         {
             popped_item = EZ_LINKEDLIST_GET_PARENT_OF(queue->q_item_list.prev, node, ezQueueItem);
             EZ_LINKEDLIST_UNLINK_NODE(&popped_item->node);
+            queue->num_of_elements--;
 
-            if (ezStaticAlloc_Free(&queue->mem_list, popped_item->data) == false)
+            if (ezStaticAlloc_Free(queue->domain, (void *)popped_item) == false)
             {
                 status = ezFAIL;
                 EZTRACE("free fail");
             }
-
-            if (status == ezSUCCESS)
-            {
-                if (ezStaticAlloc_Free(&queue->mem_list, (void *)popped_item) == false)
-                {
-                    status = ezFAIL;
-                    EZTRACE("free fail");
-                }
-            }
         }
     }
     else
@@ -169,30 +203,51 @@ ezSTATUS ezQueue_PopBack(ezQueue *queue)
 
 
 ezReservedElement ezQueue_ReserveElement(ezQueue *queue, void **data, uint32_t data_size)
+{
+    EZTRACE("ezQueue_ReserveElement( [size = %d])", data_size);
+
+    return ezQueue_ReserveElementAligned(queue, data, data_size, 1U);
+}
+
+
+ezReservedElement ezQueue_ReserveElementAligned(ezQueue *queue,
+                                                void **data,
+                                                uint32_t data_size,
+                                                uint32_t alignment)
 {
     ezQueueItem* item = NULL;
+    uint32_t header_size = 0U;
 
-    EZTRACE("ezQueue_Push( [@ = %p], [size = %d])", *data, data_size);
+    EZTRACE("ezQueue_ReserveElementAligned( [size = %d], [alignment = %d])", data_size, alignment);
 
-    if (queue != NULL && data != NULL && data_size > 0)
+    if (queue != NULL && data != NULL
+        && alignment != 0U && (alignment & (alignment - 1U)) == 0U)
     {
-        item = (ezQueueItem*)ezStaticAlloc_Malloc(&queue->mem_list, sizeof(ezQueueItem));
+        if (alignment < ITEM_ALIGNMENT)
+        {
+            alignment = ITEM_ALIGNMENT;
+        }
+
+        /* One block: the item, padding up to the alignment, then the data.
+         * Whole multiples of the item alignment keep the next block aligned */
+        header_size = ALIGN_UP((uint32_t)sizeof(ezQueueItem), alignment);
+        if (data_size <= queue->domain->buff_size)
+        {
+            item = (ezQueueItem*)ezStaticAlloc_MallocAligned(queue->domain,
+                                                             ALIGN_UP(header_size + data_size, ITEM_ALIGNMENT),
+                                                             alignment);
+        }
 
         if (item != NULL)
         {
+            ezLinkedList_InitNode(&item->node);
             item->data_size = data_size;
-            item->data = ezStaticAlloc_Malloc(&queue->mem_list, (uint16_t)data_size);
-
-            if (item->data == NULL)
-            {
-                ezStaticAlloc_Free(&queue->mem_list, (void*)item);
-                item = NULL;
-                EZTRACE("allocate data fail");
-            }
-            else
-            {
-                *data = item->data;
-            }
+            item->data = (uint8_t*)item + header_size;
+            *data = item->data;
+        }
+        else
+        {
+            EZTRACE("allocate element fail");
         }
     }
 
@@ -208,6 +263,7 @@ ezSTATUS ezQueue_PushReservedElement(ezQueue *queue, ezReservedElement element)
     if (queue != NULL && element != NULL)
     {
         EZ_LINKEDLIST_ADD_TAIL(&queue->q_item_list, &item->node);
+        queue->num_of_elements++;
     }
     else
     {
@@ -225,8 +281,7 @@ ezSTATUS ezQueue_ReleaseReservedElement( ezQueue *queue, ezReservedElement eleme
 
     if (queue != NULL && item != NULL)
     {
-        if (ezStaticAlloc_Free(&queue->mem_list, (void *)item->data) == true
-            && ezStaticAlloc_Free(&queue->mem_list, (void *)item) == true)
+        if (ezStaticAlloc_Free(queue->domain, (void *)item) == true)
         {
             status = ezSUCCESS;
         }
@@ -267,6 +322,156 @@ ezSTATUS ezQueue_Push(ezQueue* queue, void *data, uint32_t data_size)
     return status;
 }
 
+
+ezSTATUS ezQueue_PushBatch(ezQueue *queue,
+                           const ezQueueBatchElement *elements,
+                           uint32_t num_of_elements)
+{
+    ezSTATUS status = ezSUCCESS;
+    struct Node batch = EZ_LINKEDLIST_INIT_NODE(batch);
+    ezQueueItem *item = NULL;
+    void *reserve_data = NULL;
+
+    EZTRACE("ezQueue_PushBatch( [num of elements = %d])", num_of_elements);
+
+    if (queue == NULL || elements == NULL || num_of_elements == 0U)
+    {
+        return ezFAIL;
+    }
+
+    for (uint32_t i = 0; i < num_of_elements && status == ezSUCCESS; i++)
+    {
+        item = NULL;
+        if (elements[i].data != NULL && elements[i].data_size > 0U)
+        {
+            item = (ezQueueItem*)ezQueue_ReserveElement(queue, &reserve_data, elements[i].data_size);
+        }
+
+        if (item != NULL)
+        {
+            memcpy(reserve_data, elements[i].data, elements[i].data_size);
+            EZ_LINKEDLIST_ADD_TAIL(&batch, &item->node);
+        }
+        else
+        {
+            status = ezFAIL;
+        }
+    }
+
+    if (status == ezSUCCESS)
+    {
+        /* Splice the whole batch behind the last element */
+        batch.next->prev = queue->q_item_list.prev;
+        batch.prev->next = &queue->q_item_list;
+        queue->q_item_list.prev->next = batch.next;
+        queue->q_item_list.prev = batch.prev;
+        queue->num_of_elements += num_of_elements;
+    }
+    else
+    {
+        EZDEBUG("push batch fail");
+        while (batch.next != &batch)
+        {
+            item = EZ_LINKEDLIST_GET_PARENT_OF(batch.next, node, ezQueueItem);
+            EZ_LINKEDLIST_UNLINK_NODE(&item->node);
+            (void)ezStaticAlloc_Free(queue->domain, (void*)item);
+        }
+    }
+
+    return status;
+}
+
+
+uint32_t ezQueue_Drain(ezQueue *queue,
+                       uint32_t max_items,
+                       ezQueue_DrainCallback callback,
+                       void *context)
+{
+    void *consumed[CONFIG_EZ_QUEUE_DRAIN_BATCH];
+    uint32_t num_of_consumed = 0U;
+    uint32_t num_of_drained = 0U;
+    ezQueueItem *item = NULL;
+
+    EZTRACE("ezQueue_Drain( [max items = %d])", max_items);
+
+    if (queue == NULL || callback == NULL)
+    {
+        return 0U;
+    }
+
+    /* Elements pushed by the callback are left for the next call */
+    if (max_items > queue->num_of_elements)
+    {
+        max_items = queue->num_of_elements;
+    }
+
+    while (num_of_drained < max_items)
+    {
+        item = EZ_LINKEDLIST_GET_PARENT_OF(queue->q_item_list.next, node, ezQueueItem);
+        if (callback(item->data, item->data_size, context) == false)
+        {
+            break;
+        }
+
+        EZ_LINKEDLIST_UNLINK_NODE(&item->node);
+        queue->num_of_elements--;
+        num_of_drained++;
+
+        consumed[num_of_consumed] = item;
+        num_of_consumed++;
+        if (num_of_consumed == CONFIG_EZ_QUEUE_DRAIN_BATCH)
+        {
+            (void)ezStaticAlloc_FreeBatch(queue->domain, consumed, num_of_consumed);
+            num_of_consumed = 0U;
+        }
+    }
+
+    (void)ezStaticAlloc_FreeBatch(queue->domain, consumed, num_of_consumed);
+
+    return num_of_drained;
+}
+
+
+ezSTATUS ezQueue_MoveFront(ezQueue *to, ezQueue *from)
+{
+    ezSTATUS status = ezFAIL;
+    ezQueueItem *item = NULL;
+    void *reserve_data = NULL;
+    ezReservedElement copy = NULL;
+
+    EZTRACE("ezQueue_MoveFront()");
+
+    if (to == NULL || from == NULL || to == from || from->num_of_elements == 0U)
+    {
+        return ezFAIL;
+    }
+
+    item = EZ_LINKEDLIST_GET_PARENT_OF(from->q_item_list.next, node, ezQueueItem);
+    if (to->domain == from->domain)
+    {
+        /* Same memory list: the element changes its owner, nothing is copied */
+        EZ_LINKEDLIST_UNLINK_NODE(&item->node);
+        from->num_of_elements--;
+        EZ_LINKEDLIST_ADD_TAIL(&to->q_item_list, &item->node);
+        to->num_of_elements++;
+        status = ezSUCCESS;
+    }
+    else
+    {
+        copy = ezQueue_ReserveElement(to, &reserve_data, item->data_size);
+        if (copy != NULL)
+        {
+            EZDEBUG("different memory lists, element is copied");
+            memcpy(reserve_data, item->data, item->data_size);
+            (void)ezQueue_PushReservedElement(to, copy);
+            status = ezQueue_PopFront(from);
+        }
+    }
+
+    return status;
+}
+
+
 ezSTATUS ezQueue_GetFront(ezQueue* queue, void **data, uint32_t *data_size)
 {
     ezSTATUS status = ezSUCCESS;
@@ -276,7 +481,7 @@ ezSTATUS ezQueue_GetFront(ezQueue* queue, void **data, uint32_t *data_size)
 
     if (queue != NULL && data != NULL && data_size != NULL)
     {
-        if (ezQueue_GetNumOfElement(queue) > 0)
+        if (queue->num_of_elements > 0)
         {
             front_item = EZ_LINKEDLIST_GET_PARENT_OF(queue->q_item_list.next, node, ezQueueItem);
             *data = front_item->data;
@@ -315,7 +520,7 @@ ezSTATUS ezQueue_GetBack(ezQueue* queue, void **data, uint32_t *data_size)
 
     if (queue != NULL && data != NULL && data_size != NULL)
     {
-        if (ezQueue_GetNumOfElement(queue) > 0)
+        if (queue->num_of_elements > 0)
         {
             back_item = EZ_LINKEDLIST_GET_PARENT_OF(queue->q_item_list.prev, node, ezQueueItem);
             *data = back_item->data;
@@ -347,7 +552,7 @@ uint32_t ezQueue_GetNumOfElement(ezQueue* queue)
 
     if (queue != NULL)
     {
-        num_of_element = ezLinkedList_GetListSize(&queue->q_item_list);
+        num_of_element = queue->num_of_elements;
     }
 
     return num_of_element;
@@ -358,7 +563,8 @@ uint32_t ezQueue_IsQueueReady(ezQueue *queue)
 {
     bool is_ready = false;
 
-    if (queue != NULL && ezStaticAlloc_IsMemListReady(&queue->mem_list) == true)
+    if (queue != NULL && queue->domain != NULL
+        && ezStaticAlloc_IsMemListReady(queue->domain) == true)
     {
         is_ready = true;
     }
@@ -0,0 +1,401 @@
+/*****************************************************************************
+* Filename:         ez_record_ring.c
+* Author:           Hai Nguyen
+* Original Date:    16.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   ez_record_ring.c
+ *  @author Hai Nguyen
+ *  @date   16.10.2026
+ *  @brief  Implementation of the record ring
+ *
+ *  @details Layout of the storage:
+ *  | len | payload | pad to 4 | len | payload | ... | PADDING ... end |
+ *  All headers start at a multiple of 4, so the space left before the end
+ *  of the storage is either 0 or large enough for a padding marker.
+ */
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include "ez_record_ring.h"
+
+#if (EZ_RING_BUFFER == 1U)
+#include <string.h>
+
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+#define PADDING_MARKER      0xFFFFFFFFU     /**< header value of padding */
+
+
+/*****************************************************************************
+* Component Typedefs
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Component Variable Definitions
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Function Definitions
+*****************************************************************************/
+static uint32_t ezRecordRing_Footprint(ezRingBufferSize_t size);
+static bool ezRecordRing_FindSpace(ezRecordRing *record_ring,
+                                   uint32_t footprint,
+                                   ezRingBufferSize_t *pad);
+static bool ezRecordRing_SkipPadding(ezRecordRing *record_ring,
+                                     ezRingBufferRegion regions[EZ_RING_BUFFER_NUM_OF_REGIONS]);
+static uint32_t ezRecordRing_ReadHeader(const uint8_t *header);
+static void ezRecordRing_WriteHeader(uint8_t *header, uint32_t value);
+
+
+/*****************************************************************************
+* Public functions
+*****************************************************************************/
+bool ezRecordRing_Init(ezRecordRing *record_ring, uint8_t *buff, ezRingBufferSize_t size)
+{
+    bool ret = false;
+    ezRingBufferSize_t capacity = (ezRingBufferSize_t)(size & ~(ezRingBufferSize_t)3U);
+
+    if(record_ring != NULL && capacity > EZ_RECORD_RING_HEADER_SIZE)
+    {
+        ret = ezRingBuffer_Init(&record_ring->ring, buff, capacity);
+        record_ring->num_of_records = 0;
+        record_ring->dropped_records = 0;
+        record_ring->reserved_size = 0;
+        record_ring->reserved_pad = 0;
+        record_ring->is_reserved = false;
+        record_ring->overwrite = false;
+    }
+    return ret;
+}
+
+
+uint8_t *ezRecordRing_Reserve(ezRecordRing *record_ring, ezRingBufferSize_t size)
+{
+    ezRingBufferRegion regions[EZ_RING_BUFFER_NUM_OF_REGIONS];
+    uint32_t footprint = 0U;
+    ezRingBufferSize_t pad = 0U;
+    uint8_t *payload = NULL;
+
+    record_ring->is_reserved = false;
+
+    /* Checked before the footprint is computed, which wraps around for
+     * sizes close to 4 GiB with 32-bit sizes */
+    if(record_ring->ring.capacity < EZ_RECORD_RING_HEADER_SIZE
+       || size > record_ring->ring.capacity - EZ_RECORD_RING_HEADER_SIZE)
+    {
+        return NULL;
+    }
+
+    footprint = ezRecordRing_Footprint(size);
+    if(footprint > record_ring->ring.capacity)
+    {
+        return NULL;
+    }
+
+    while(!ezRecordRing_FindSpace(record_ring, footprint, &pad))
+    {
+        if(!record_ring->overwrite || ezRingBuffer_IsEmpty(&record_ring->ring))
+        {
+            return NULL;
+        }
+
+        if(ezRecordRing_Consume(record_ring))
+        {
+            record_ring->dropped_records++;
+        }
+    }
+
+    (void)ezRingBuffer_Reserve(&record_ring->ring, regions);
+    payload = (pad > 0U) ? regions[1].data : regions[0].data;
+
+    record_ring->reserved_size = size;
+    record_ring->reserved_pad = pad;
+    record_ring->is_reserved = true;
+
+    return payload + EZ_RECORD_RING_HEADER_SIZE;
+}
+
+
+bool ezRecordRing_Commit(ezRecordRing *record_ring, ezRingBufferSize_t size)
+{
+    ezRingBufferRegion regions[EZ_RING_BUFFER_NUM_OF_REGIONS];
+    uint8_t *header = NULL;
+    bool ret = false;
+
+    if(record_ring->is_reserved && size <= record_ring->reserved_size)
+    {
+        (void)ezRingBuffer_Reserve(&record_ring->ring, regions);
+        header = regions[0].data;
+        if(record_ring->reserved_pad > 0U)
+        {
+            ezRecordRing_WriteHeader(regions[0].data, PADDING_MARKER);
+            header = regions[1].data;
+        }
+        ezRecordRing_WriteHeader(header, size);
+
+        ret = ezRingBuffer_Commit(&record_ring->ring,
+                                  (ezRingBufferSize_t)(record_ring->reserved_pad
+                                                       + ezRecordRing_Footprint(size)));
+        if(ret)
+        {
+            record_ring->num_of_records++;
+        }
+        record_ring->is_reserved = false;
+    }
+    return ret;
+}
+
+
+bool ezRecordRing_Push(ezRecordRing *record_ring, const uint8_t *data, ezRingBufferSize_t size)
+{
+    uint8_t *payload = ezRecordRing_Reserve(record_ring, size);
+
+    if(payload == NULL)
+    {
+        return false;
+    }
+
+    if(size > 0U)
+    {
+        memcpy(payload, data, size);
+    }
+    return ezRecordRing_Commit(record_ring, size);
+}
+
+
+bool ezRecordRing_Peek(ezRecordRing *record_ring, uint8_t **data, ezRingBufferSize_t *size)
+{
+    ezRingBufferRegion regions[EZ_RING_BUFFER_NUM_OF_REGIONS];
+
+    if(!ezRecordRing_SkipPadding(record_ring, regions))
+    {
+        return false;
+    }
+
+    *data = regions[0].data + EZ_RECORD_RING_HEADER_SIZE;
+    *size = (ezRingBufferSize_t)ezRecordRing_ReadHeader(regions[0].data);
+    return true;
+}
+
+
+bool ezRecordRing_Consume(ezRecordRing *record_ring)
+{
+    ezRingBufferRegion regions[EZ_RING_BUFFER_NUM_OF_REGIONS];
+    uint32_t size = 0U;
+
+    if(!ezRecordRing_SkipPadding(record_ring, regions))
+    {
+        return false;
+    }
+
+    size = ezRecordRing_ReadHeader(regions[0].data);
+    (void)ezRingBuffer_Consume(&record_ring->ring,
+                               (ezRingBufferSize_t)ezRecordRing_Footprint((ezRingBufferSize_t)size));
+    record_ring->num_of_records--;
+    return true;
+}
+
+
+bool ezRecordRing_Pop(ezRecordRing *record_ring, uint8_t *data, ezRingBufferSize_t *size)
+{
+    uint8_t *payload = NULL;
+    ezRingBufferSize_t record_size = 0U;
+
+    if(!ezRecordRing_Peek(record_ring, &payload, &record_size))
+    {
+        return false;
+    }
+
+    if(record_size > *size)
+    {
+        *size = record_size;
+        return false;
+    }
+
+    if(record_size > 0U)
+    {
+        memcpy(data, payload, record_size);
+    }
+    *size = record_size;
+    return ezRecordRing_Consume(record_ring);
+}
+
+
+uint32_t ezRecordRing_GetNumOfRecords(ezRecordRing *record_ring)
+{
+    return record_ring->num_of_records;
+}
+
+
+void ezRecordRing_Reset(ezRecordRing *record_ring)
+{
+    record_ring->ring.head_index = 0;
+    record_ring->ring.tail_index = 0;
+    record_ring->ring.written_byte_count = 0;
+    record_ring->num_of_records = 0;
+    record_ring->is_reserved = false;
+}
+
+
+void ezRecordRing_SetOverwrite(ezRecordRing *record_ring, bool enable)
+{
+    record_ring->overwrite = enable;
+}
+
+
+uint32_t ezRecordRing_GetDroppedRecords(ezRecordRing *record_ring)
+{
+    return record_ring->dropped_records;
+}
+
+
+void ezRecordRing_ResetDroppedRecords(ezRecordRing *record_ring)
+{
+    record_ring->dropped_records = 0;
+}
+
+
+/*****************************************************************************
+* Local functions
+*****************************************************************************/
+
+/******************************************************************************
+* Function : ezRecordRing_Footprint
+*//**
+* @Description: Return the number of bytes a record occupies in the storage
+*
+* @param    size: (IN)payload size
+* @return   header size + payload size rounded up to a multiple of 4
+*
+*******************************************************************************/
+static uint32_t ezRecordRing_Footprint(ezRingBufferSize_t size)
+{
+    return EZ_RECORD_RING_HEADER_SIZE + (((uint32_t)size + 3U) & ~3U);
+}
+
+
+/******************************************************************************
+* Function : ezRecordRing_FindSpace
+*//**
+* @Description: Check if a record fits contiguously, either at the head or
+*               at the start of the storage after padding up to the end
+*
+* @param    record_ring: (IN)pointer to the record ring
+* @param    footprint: (IN)bytes needed by the record
+* @param    pad: (OUT)padding needed in front of the record
+* @return   true if the record fits
+*
+*******************************************************************************/
+static bool ezRecordRing_FindSpace(ezRecordRing *record_ring,
+                                   uint32_t footprint,
+                                   ezRingBufferSize_t *pad)
+{
+    ezRingBufferRegion regions[EZ_RING_BUFFER_NUM_OF_REGIONS];
+
+    if(ezRingBuffer_IsEmpty(&record_ring->ring))
+    {
+        /* Start over at offset 0 so the whole storage is contiguous */
+        record_ring->ring.head_index = 0;
+        record_ring->ring.tail_index = 0;
+    }
+
+    (void)ezRingBuffer_Reserve(&record_ring->ring, regions);
+    if(regions[0].size >= footprint)
+    {
+        *pad = 0U;
+        return true;
+    }
+
+    if(regions[1].size >= footprint)
+    {
+        *pad = regions[0].size;
+        return true;
+    }
+
+    return false;
+}
+
+
+/******************************************************************************
+* Function : ezRecordRing_SkipPadding
+*//**
+* @Description: Drop padding at the tail and return the regions starting at
+*               the header of the oldest record
+*
+* @param    record_ring: (IN)pointer to the record ring
+* @param    regions: (OUT)regions of the stored data
+* @return   true if a record is available
+*
+*******************************************************************************/
+static bool ezRecordRing_SkipPadding(ezRecordRing *record_ring,
+                                     ezRingBufferRegion regions[EZ_RING_BUFFER_NUM_OF_REGIONS])
+{
+    if(ezRingBuffer_Peek(&record_ring->ring, regions) == 0U)
+    {
+        return false;
+    }
+
+    if(ezRecordRing_ReadHeader(regions[0].data) == PADDING_MARKER)
+    {
+        (void)ezRingBuffer_Consume(&record_ring->ring, regions[0].size);
+        if(ezRingBuffer_Peek(&record_ring->ring, regions) == 0U)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+/******************************************************************************
+* Function : ezRecordRing_ReadHeader
+*//**
+* @Description: Read a header, the storage may not be aligned
+*
+* @param    header: (IN)pointer to the header
+* @return   header value
+*
+*******************************************************************************/
+static uint32_t ezRecordRing_ReadHeader(const uint8_t *header)
+{
+    uint32_t value = 0U;
+    memcpy(&value, header, sizeof(value));
+    return value;
+}
+
+
+/******************************************************************************
+* Function : ezRecordRing_WriteHeader
+*//**
+* @Description: Write a header, the storage may not be aligned
+*
+* @param    header: (IN)pointer to the header
+* @param    value: (IN)header value
+* @return   None
+*
+*******************************************************************************/
+static void ezRecordRing_WriteHeader(uint8_t *header, uint32_t value)
+{
+    memcpy(header, &value, sizeof(value));
+}
+
+#endif /* EZ_RING_BUFFER == 1U */
+
+/* End of file */
@@ -32,7 +32,11 @@
 /*****************************************************************************
 * Component Preprocessor Macros
 *****************************************************************************/
-/* None */
+#if (EZ_RING_BUFFER_MIRROR == 1U)
+#define IS_MIRRORED(ring_buff)  ((ring_buff)->is_mirrored)
+#else
+#define IS_MIRRORED(ring_buff)  (false)
+#endif
 
 
 /*****************************************************************************
@@ -50,13 +54,21 @@
 /*****************************************************************************
 * Function Definitions
 *****************************************************************************/
-/* None */
+static ezRingBufferSize_t ezRingBuffer_FillRegions(RingBuffer *ring_buff,
+                                                   ezRingBufferSize_t start,
+                                                   ezRingBufferSize_t size,
+                                                   ezRingBufferRegion regions[EZ_RING_BUFFER_NUM_OF_REGIONS]);
+static ezRingBufferSize_t ezRingBuffer_Advance(RingBuffer *ring_buff,
+                                               ezRingBufferSize_t index,
+                                               ezRingBufferSize_t size);
+static ezRingBufferSize_t ezRingBuffer_Offset(RingBuffer *ring_buff, ezRingBufferSize_t index);
+static void ezRingBuffer_MakeRoom(RingBuffer *ring_buff, uint8_t **data, ezRingBufferSize_t *size);
 
 
 /*****************************************************************************
 * Public functions
 *****************************************************************************/
-bool ezRingBuffer_Init(RingBuffer *ring_buff, uint8_t *buff, uint16_t size)
+bool ezRingBuffer_Init(RingBuffer *ring_buff, uint8_t *buff, ezRingBufferSize_t size)
 {
     bool ret = false;
     if(buff != NULL && size > 0)
@@ -66,6 +78,16 @@ bool ezRingBuffer_Init(RingBuffer *ring_buff, uint8_t *buff, uint16_t size)
         ring_buff->written_byte_count = 0;
         ring_buff->buff = buff;
         ring_buff->capacity = size;
+        ring_buff->index_mask = 0;
+        ring_buff->dropped_bytes = 0;
+        ring_buff->overwrite = false;
+#if (EZ_RING_BUFFER_MIRROR == 1U)
+        ring_buff->is_mirrored = false;
+#endif
+        if((size > 1U) && ((size & (size - 1U)) == 0U))
+        {
+            ring_buff->index_mask = (ezRingBufferSize_t)(size - 1U);
+        }
         ret = true;
     }
     return ret;
@@ -84,72 +106,122 @@ bool ezRingBuffer_IsFull(RingBuffer * ring_buff)
 }
 
 
-uint16_t ezRingBuffer_Push(RingBuffer * ring_buff, uint8_t *data, uint16_t size)
+ezRingBufferSize_t ezRingBuffer_Push(RingBuffer * ring_buff, uint8_t *data, ezRingBufferSize_t size)
 {
-    uint16_t remain_byte_count = 0U;
-    uint16_t push_byte_count = ring_buff->capacity - ring_buff->written_byte_count;
+    ezRingBufferSize_t remain_byte_count = 0U;
+    ezRingBufferSize_t push_byte_count = 0U;
 
+    if(ring_buff->overwrite)
+    {
+        ezRingBuffer_MakeRoom(ring_buff, &data, &size);
+    }
+
+    push_byte_count = (ezRingBufferSize_t)(ring_buff->capacity - ring_buff->written_byte_count);
     if(push_byte_count >= size)
     {
         push_byte_count = size;
     }
 
-    if (ring_buff->capacity - ring_buff->head_index >= push_byte_count)
+    if(IS_MIRRORED(ring_buff))
+    {
+        /* The mapping continues past the end, one copy is enough */
+        memcpy(&ring_buff->buff[ezRingBuffer_Offset(ring_buff, ring_buff->head_index)], data, push_byte_count);
+        ring_buff->head_index = ezRingBuffer_Advance(ring_buff, ring_buff->head_index, push_byte_count);
+        ring_buff->written_byte_count = (ezRingBufferSize_t)(ring_buff->written_byte_count + push_byte_count);
+    }
+    else if(ring_buff->index_mask != 0U)
+    {
+        /* Power of two: free-running head, the offset is masked */
+        ezRingBufferSize_t offset = ring_buff->head_index & ring_buff->index_mask;
+        remain_byte_count = (ezRingBufferSize_t)(ring_buff->capacity - offset);
+        remain_byte_count = (remain_byte_count < push_byte_count) ? remain_byte_count : push_byte_count;
+
+        memcpy(&ring_buff->buff[offset], data, remain_byte_count);
+        if(remain_byte_count < push_byte_count)
+        {
+            memcpy(ring_buff->buff, data + remain_byte_count, (size_t)push_byte_count - remain_byte_count);
+        }
+        ring_buff->head_index = (ezRingBufferSize_t)(ring_buff->head_index + push_byte_count);
+        ring_buff->written_byte_count = (ezRingBufferSize_t)(ring_buff->written_byte_count + push_byte_count);
+    }
+    else if (ring_buff->capacity - ring_buff->head_index >= push_byte_count)
     {
         memcpy(&ring_buff->buff[ring_buff->head_index], data, push_byte_count);
-        ring_buff->head_index = ring_buff->head_index + push_byte_count;
-        ring_buff->written_byte_count = ring_buff->written_byte_count + push_byte_count;
+        ring_buff->head_index = (ezRingBufferSize_t)(ring_buff->head_index + push_byte_count);
+        ring_buff->written_byte_count = (ezRingBufferSize_t)(ring_buff->written_byte_count + push_byte_count);
     }
     else
     {
         /* Handle warpping */
-        remain_byte_count = ring_buff->capacity - ring_buff->head_index;
+        remain_byte_count = (ezRingBufferSize_t)(ring_buff->capacity - ring_buff->head_index);
         memcpy(&ring_buff->buff[ring_buff->head_index], data, remain_byte_count);
         ring_buff->head_index = 0;
-        ring_buff->written_byte_count = ring_buff->written_byte_count + remain_byte_count;
+        ring_buff->written_byte_count = (ezRingBufferSize_t)(ring_buff->written_byte_count + remain_byte_count);
         data = data + remain_byte_count;
 
-        remain_byte_count = push_byte_count - remain_byte_count;
+        remain_byte_count = (ezRingBufferSize_t)(push_byte_count - remain_byte_count);
         memcpy(&ring_buff->buff[ring_buff->head_index], data, remain_byte_count);
-        ring_buff->head_index = ring_buff->head_index + remain_byte_count;
-        ring_buff->written_byte_count = ring_buff->written_byte_count + remain_byte_count;
+        ring_buff->head_index = (ezRingBufferSize_t)(ring_buff->head_index + remain_byte_count);
+        ring_buff->written_byte_count = (ezRingBufferSize_t)(ring_buff->written_byte_count + remain_byte_count);
     }
 
     return push_byte_count;
 }
 
 
-uint16_t ezRingBuffer_Pop(RingBuffer *ring_buff, uint8_t *data, uint16_t size)
+ezRingBufferSize_t ezRingBuffer_Pop(RingBuffer *ring_buff, uint8_t *data, ezRingBufferSize_t size)
 {
 
-    uint16_t popped_byte_count = size;
-    uint16_t remained_byte_count = 0U;
+    ezRingBufferSize_t popped_byte_count = size;
+    ezRingBufferSize_t remained_byte_count = 0U;
 
     if(ring_buff->written_byte_count < popped_byte_count)
     {
         popped_byte_count = ring_buff->written_byte_count;
     }
 
-    if (ring_buff->capacity - ring_buff->tail_index >= popped_byte_count)
+    if(IS_MIRRORED(ring_buff))
+    {
+        /* The mapping continues past the end, one copy is enough */
+        memcpy(data, &ring_buff->buff[ezRingBuffer_Offset(ring_buff, ring_buff->tail_index)], popped_byte_count);
+        ring_buff->tail_index = ezRingBuffer_Advance(ring_buff, ring_buff->tail_index, popped_byte_count);
+        ring_buff->written_byte_count = (ezRingBufferSize_t)(ring_buff->written_byte_count - popped_byte_count);
+    }
+    else if(ring_buff->index_mask != 0U)
+    {
+        /* Power of two: free-running tail, the offset is masked */
+        ezRingBufferSize_t offset = ring_buff->tail_index & ring_buff->index_mask;
+        remained_byte_count = (ezRingBufferSize_t)(ring_buff->capacity - offset);
+        remained_byte_count = (remained_byte_count < popped_byte_count) ? remained_byte_count : popped_byte_count;
+
+        memcpy(data, &ring_buff->buff[offset], remained_byte_count);
+        if(remained_byte_count < popped_byte_count)
+        {
+            memcpy(data + remained_byte_count, ring_buff->buff, (size_t)popped_byte_count - remained_byte_count);
+        }
+        ring_buff->tail_index = (ezRingBufferSize_t)(ring_buff->tail_index + popped_byte_count);
+        ring_buff->written_byte_count = (ezRingBufferSize_t)(ring_buff->written_byte_count - popped_byte_count);
+    }
+    else if (ring_buff->capacity - ring_buff->tail_index >= popped_byte_count)
     {
         memcpy(data, &ring_buff->buff[ring_buff->tail_index], popped_byte_count);
-        ring_buff->tail_index = ring_buff->tail_index + popped_byte_count;
-        ring_buff->written_byte_count = ring_buff->written_byte_count - popped_byte_count;
+        ring_buff->tail_index = (ezRingBufferSize_t)(ring_buff->tail_index + popped_byte_count);
+        ring_buff->written_byte_count = (ezRingBufferSize_t)(ring_buff->written_byte_count - popped_byte_count);
     }
     else
     {
         /* Handle warpping */
-        remained_byte_count = ring_buff->capacity - ring_buff->tail_index;
+        remained_byte_count = (ezRingBufferSize_t)(ring_buff->capacity - ring_buff->tail_index);
         memcpy(data, &ring_buff->buff[ring_buff->tail_index], remained_byte_count);
         ring_buff->tail_index = 0;
-        ring_buff->written_byte_count = ring_buff->written_byte_count - remained_byte_count;
+        ring_buff->written_byte_count = (ezRingBufferSize_t)(ring_buff->written_byte_count - remained_byte_count);
 
         data = data + remained_byte_count;
 
-        remained_byte_count = popped_byte_count - remained_byte_count;
+        remained_byte_count = (ezRingBufferSize_t)(popped_byte_count - remained_byte_count);
         memcpy(data, &ring_buff->buff[ring_buff->tail_index], remained_byte_count);
-        ring_buff->tail_index = ring_buff->tail_index + remained_byte_count;
-        ring_buff->written_byte_count = ring_buff->written_byte_count - remained_byte_count;
+        ring_buff->tail_index = (ezRingBufferSize_t)(ring_buff->tail_index + remained_byte_count);
+        ring_buff->written_byte_count = (ezRingBufferSize_t)(ring_buff->written_byte_count - remained_byte_count);
     }
 
     return popped_byte_count;
@@ -165,9 +237,193 @@ void ezRingBuffer_Reset(RingBuffer * ring_buff)
 }
 
 
-uint16_t ezRingBuffer_GetAvailableMemory(RingBuffer *ring_buff)
+ezRingBufferSize_t ezRingBuffer_GetAvailableMemory(RingBuffer *ring_buff)
+{
+    return (ezRingBufferSize_t)(ring_buff->capacity - ring_buff->written_byte_count);
+}
+
+
+ezRingBufferSize_t ezRingBuffer_Reserve(RingBuffer *ring_buff,
+                                        ezRingBufferRegion regions[EZ_RING_BUFFER_NUM_OF_REGIONS])
+{
+    return ezRingBuffer_FillRegions(ring_buff,
+                                    ring_buff->head_index,
+                                    (ezRingBufferSize_t)(ring_buff->capacity - ring_buff->written_byte_count),
+                                    regions);
+}
+
+
+bool ezRingBuffer_Commit(RingBuffer *ring_buff, ezRingBufferSize_t size)
+{
+    bool ret = false;
+    if(size <= ring_buff->capacity - ring_buff->written_byte_count)
+    {
+        ring_buff->head_index = ezRingBuffer_Advance(ring_buff, ring_buff->head_index, size);
+        ring_buff->written_byte_count = (ezRingBufferSize_t)(ring_buff->written_byte_count + size);
+        ret = true;
+    }
+    return ret;
+}
+
+
+ezRingBufferSize_t ezRingBuffer_Peek(RingBuffer *ring_buff,
+                                     ezRingBufferRegion regions[EZ_RING_BUFFER_NUM_OF_REGIONS])
+{
+    return ezRingBuffer_FillRegions(ring_buff,
+                                    ring_buff->tail_index,
+                                    ring_buff->written_byte_count,
+                                    regions);
+}
+
+
+bool ezRingBuffer_Consume(RingBuffer *ring_buff, ezRingBufferSize_t size)
+{
+    bool ret = false;
+    if(size <= ring_buff->written_byte_count)
+    {
+        ring_buff->tail_index = ezRingBuffer_Advance(ring_buff, ring_buff->tail_index, size);
+        ring_buff->written_byte_count = (ezRingBufferSize_t)(ring_buff->written_byte_count - size);
+        ret = true;
+    }
+    return ret;
+}
+
+
+void ezRingBuffer_SetOverwrite(RingBuffer *ring_buff, bool enable)
 {
-    return ring_buff->capacity - ring_buff->written_byte_count;
+    ring_buff->overwrite = enable;
+}
+
+
+uint32_t ezRingBuffer_GetDroppedBytes(RingBuffer *ring_buff)
+{
+    return ring_buff->dropped_bytes;
+}
+
+
+void ezRingBuffer_ResetDroppedBytes(RingBuffer *ring_buff)
+{
+    ring_buff->dropped_bytes = 0;
+}
+
+
+/*****************************************************************************
+* Local functions
+*****************************************************************************/
+
+/******************************************************************************
+* Function : ezRingBuffer_MakeRoom
+*//**
+* @Description: Drop the oldest bytes so that size bytes fit into the buffer.
+*               If size exceeds the capacity, only the newest capacity bytes
+*               of data are kept
+*
+* @param    ring_buff: (IN)pointer to the ring buffer
+* @param    data: (IN/OUT)pointer to the data to be pushed
+* @param    size: (IN/OUT)number of bytes to be pushed
+* @return   None
+*
+*******************************************************************************/
+static void ezRingBuffer_MakeRoom(RingBuffer *ring_buff, uint8_t **data, ezRingBufferSize_t *size)
+{
+    ezRingBufferSize_t free_byte_count = 0U;
+
+    if(*size > ring_buff->capacity)
+    {
+        ring_buff->dropped_bytes += (uint32_t)(*size - ring_buff->capacity);
+        *data = *data + (*size - ring_buff->capacity);
+        *size = ring_buff->capacity;
+    }
+
+    free_byte_count = (ezRingBufferSize_t)(ring_buff->capacity - ring_buff->written_byte_count);
+    if(*size > free_byte_count)
+    {
+        (void)ezRingBuffer_Consume(ring_buff, (ezRingBufferSize_t)(*size - free_byte_count));
+        ring_buff->dropped_bytes += (uint32_t)(*size - free_byte_count);
+    }
+}
+
+
+/******************************************************************************
+* Function : ezRingBuffer_FillRegions
+*//**
+* @Description: Describe size bytes starting at index start as up to two
+*               contiguous regions of the storage
+*
+* @param    ring_buff: (IN)pointer to the ring buffer
+* @param    start: (IN)head or tail index
+* @param    size: (IN)number of bytes
+* @param    regions: (OUT)regions describing the bytes
+* @return   size
+*
+*******************************************************************************/
+static ezRingBufferSize_t ezRingBuffer_FillRegions(RingBuffer *ring_buff,
+                                                   ezRingBufferSize_t start,
+                                                   ezRingBufferSize_t size,
+                                                   ezRingBufferRegion regions[EZ_RING_BUFFER_NUM_OF_REGIONS])
+{
+    ezRingBufferSize_t first_part = size;
+
+    start = ezRingBuffer_Offset(ring_buff, start);
+    if(!IS_MIRRORED(ring_buff) && (ring_buff->capacity - start < size))
+    {
+        first_part = (ezRingBufferSize_t)(ring_buff->capacity - start);
+    }
+
+    regions[0].data = &ring_buff->buff[start];
+    regions[0].size = first_part;
+    regions[1].data = ring_buff->buff;
+    regions[1].size = (ezRingBufferSize_t)(size - first_part);
+
+    return size;
+}
+
+
+/******************************************************************************
+* Function : ezRingBuffer_Advance
+*//**
+* @Description: Move an index forward by size bytes. Free-running for power
+*               of two capacities, otherwise wrapping at capacity
+*
+* @param    ring_buff: (IN)pointer to the ring buffer
+* @param    index: (IN)current index
+* @param    size: (IN)number of bytes, at most capacity
+* @return   new index
+*
+*******************************************************************************/
+static ezRingBufferSize_t ezRingBuffer_Advance(RingBuffer *ring_buff,
+                                               ezRingBufferSize_t index,
+                                               ezRingBufferSize_t size)
+{
+    ezRingBufferSize_t remain = 0U;
+
+    if(ring_buff->index_mask != 0U)
+    {
+        return (ezRingBufferSize_t)(index + size);
+    }
+
+    remain = (ezRingBufferSize_t)(ring_buff->capacity - index);
+    return (size >= remain) ? (ezRingBufferSize_t)(size - remain) : (ezRingBufferSize_t)(index + size);
+}
+
+
+/******************************************************************************
+* Function : ezRingBuffer_Offset
+*//**
+* @Description: Convert a head or tail index into an offset in the storage
+*
+* @param    ring_buff: (IN)pointer to the ring buffer
+* @param    index: (IN)head or tail index
+* @return   offset in [0, capacity)
+*
+*******************************************************************************/
+static ezRingBufferSize_t ezRingBuffer_Offset(RingBuffer *ring_buff, ezRingBufferSize_t index)
+{
+    if(ring_buff->index_mask != 0U)
+    {
+        return index & ring_buff->index_mask;
+    }
+    return (index >= ring_buff->capacity) ? 0U : index;
 }
 
 #endif /* CONFIG_RING_BUFFER */
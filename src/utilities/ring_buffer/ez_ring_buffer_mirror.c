@@ -0,0 +1,140 @@
+/*****************************************************************************
+* Filename:         ez_ring_buffer_mirror.c
+* Author:           Hai Nguyen
+* Original Date:    16.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   ez_ring_buffer_mirror.c
+ *  @author Hai Nguyen
+ *  @date   16.10.2026
+ *  @brief  Mirrored virtual memory storage for the ring buffer (Linux)
+ *
+ *  @details One memfd is mapped twice into a reserved address range of
+ *  2 * capacity bytes. A copy or a region that runs past the end of the
+ *  first mapping continues in the second one, which aliases the start of
+ *  the storage.
+ */
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE     /* memfd_create */
+#endif
+
+#include "ez_ring_buffer.h"
+
+#if ((EZ_RING_BUFFER == 1U) && (EZ_RING_BUFFER_MIRROR == 1U))
+#include <stddef.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+#define MAX_CAPACITY    ((size_t)(ezRingBufferSize_t)~0U)  /**< largest capacity */
+
+
+/*****************************************************************************
+* Component Typedefs
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Component Variable Definitions
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Function Definitions
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Public functions
+*****************************************************************************/
+bool ezRingBuffer_InitMirrored(RingBuffer *ring_buff, ezRingBufferSize_t size)
+{
+    bool ret = false;
+    long page_size = sysconf(_SC_PAGESIZE);
+    size_t map_size = 0U;
+    uint8_t *base = MAP_FAILED;
+    int fd = -1;
+
+    if(ring_buff == NULL || size == 0U || page_size <= 0)
+    {
+        return false;
+    }
+
+    map_size = (((size_t)size + (size_t)page_size - 1U) / (size_t)page_size) * (size_t)page_size;
+    if(map_size > MAX_CAPACITY)
+    {
+        return false;
+    }
+
+    fd = memfd_create("ez_ring_buffer", MFD_CLOEXEC);
+    if(fd >= 0 && ftruncate(fd, (off_t)map_size) == 0)
+    {
+        /* Reserve the whole range first so that both halves are adjacent */
+        base = mmap(NULL, 2U * map_size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    }
+
+    if(base != MAP_FAILED)
+    {
+        ret = (mmap(base, map_size, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_FIXED, fd, 0) != MAP_FAILED)
+            && (mmap(base + map_size, map_size, PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_FIXED, fd, 0) != MAP_FAILED);
+
+        if(ret)
+        {
+            ret = ezRingBuffer_Init(ring_buff, base, (ezRingBufferSize_t)map_size);
+            ring_buff->is_mirrored = ret;
+        }
+
+        if(!ret)
+        {
+            (void)munmap(base, 2U * map_size);
+        }
+    }
+
+    if(fd >= 0)
+    {
+        /* The mappings keep the memory alive */
+        (void)close(fd);
+    }
+
+    return ret;
+}
+
+
+void ezRingBuffer_DeinitMirrored(RingBuffer *ring_buff)
+{
+    if(ring_buff != NULL && ring_buff->is_mirrored)
+    {
+        (void)munmap(ring_buff->buff, 2U * (size_t)ring_buff->capacity);
+        ring_buff->buff = NULL;
+        ring_buff->capacity = 0U;
+        ring_buff->head_index = 0U;
+        ring_buff->tail_index = 0U;
+        ring_buff->written_byte_count = 0U;
+        ring_buff->index_mask = 0U;
+        ring_buff->is_mirrored = false;
+    }
+}
+
+#endif /* (EZ_RING_BUFFER == 1U) && (EZ_RING_BUFFER_MIRROR == 1U) */
+
+/* End of file */
@@ -0,0 +1,227 @@
+/*****************************************************************************
+* Filename:         ez_spsc_ring_buffer.c
+* Author:           Hai Nguyen
+* Original Date:    16.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   ez_spsc_ring_buffer.c
+ *  @author Hai Nguyen
+ *  @date   16.10.2026
+ *  @brief  Implementation of the single-producer/single-consumer ring buffer
+ *
+ *  @details The producer publishes data with a release store of the head
+ *  index, the consumer observes it with an acquire load (and vice versa for
+ *  the tail index), so the data copy is always visible before the index that
+ *  covers it.
+ */
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include "ez_spsc_ring_buffer.h"
+
+#if (EZ_RING_BUFFER == 1U)
+#include <string.h>
+#include "ez_atomic.h"
+
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+#define MAX_CAPACITY    0x7FFFFFFFU  /**< indices run up to 2 * capacity */
+
+
+/*****************************************************************************
+* Component Typedefs
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Component Variable Definitions
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Function Definitions
+*****************************************************************************/
+static uint32_t ezSpscRingBuffer_Distance(uint32_t capacity, uint32_t head, uint32_t tail);
+static uint32_t ezSpscRingBuffer_Advance(uint32_t capacity, uint32_t index, uint32_t count);
+
+
+/*****************************************************************************
+* Public functions
+*****************************************************************************/
+bool ezSpscRingBuffer_Init(ezSpscRingBuffer *ring_buff, uint8_t *buff, uint32_t size)
+{
+    bool ret = false;
+    if(ring_buff != NULL && buff != NULL && size > 0 && size <= MAX_CAPACITY)
+    {
+        ring_buff->buff = buff;
+        ring_buff->capacity = size;
+        EZ_ATOMIC_STORE_RELAXED(&ring_buff->head_index, 0U);
+        EZ_ATOMIC_STORE_RELEASE(&ring_buff->tail_index, 0U);
+        ret = true;
+    }
+    return ret;
+}
+
+
+uint32_t ezSpscRingBuffer_Push(ezSpscRingBuffer *ring_buff, const uint8_t *data, uint32_t size)
+{
+    uint32_t head = EZ_ATOMIC_LOAD_RELAXED(&ring_buff->head_index);
+    uint32_t tail = EZ_ATOMIC_LOAD_ACQUIRE(&ring_buff->tail_index);
+    uint32_t capacity = ring_buff->capacity;
+    uint32_t push_byte_count = capacity - ezSpscRingBuffer_Distance(capacity, head, tail);
+    uint32_t offset = (head >= capacity) ? (head - capacity) : head;
+    uint32_t first_part = 0U;
+
+    if(push_byte_count > size)
+    {
+        push_byte_count = size;
+    }
+
+    if(push_byte_count > 0U)
+    {
+        first_part = capacity - offset;
+        if(first_part > push_byte_count)
+        {
+            first_part = push_byte_count;
+        }
+
+        memcpy(&ring_buff->buff[offset], data, first_part);
+        if(push_byte_count > first_part)
+        {
+            /* Handle wrapping */
+            memcpy(ring_buff->buff, data + first_part, push_byte_count - first_part);
+        }
+
+        EZ_ATOMIC_STORE_RELEASE(&ring_buff->head_index,
+                                ezSpscRingBuffer_Advance(capacity, head, push_byte_count));
+    }
+
+    return push_byte_count;
+}
+
+
+uint32_t ezSpscRingBuffer_Pop(ezSpscRingBuffer *ring_buff, uint8_t *data, uint32_t size)
+{
+    uint32_t tail = EZ_ATOMIC_LOAD_RELAXED(&ring_buff->tail_index);
+    uint32_t head = EZ_ATOMIC_LOAD_ACQUIRE(&ring_buff->head_index);
+    uint32_t capacity = ring_buff->capacity;
+    uint32_t popped_byte_count = ezSpscRingBuffer_Distance(capacity, head, tail);
+    uint32_t offset = (tail >= capacity) ? (tail - capacity) : tail;
+    uint32_t first_part = 0U;
+
+    if(popped_byte_count > size)
+    {
+        popped_byte_count = size;
+    }
+
+    if(popped_byte_count > 0U)
+    {
+        first_part = capacity - offset;
+        if(first_part > popped_byte_count)
+        {
+            first_part = popped_byte_count;
+        }
+
+        memcpy(data, &ring_buff->buff[offset], first_part);
+        if(popped_byte_count > first_part)
+        {
+            /* Handle wrapping */
+            memcpy(data + first_part, ring_buff->buff, popped_byte_count - first_part);
+        }
+
+        EZ_ATOMIC_STORE_RELEASE(&ring_buff->tail_index,
+                                ezSpscRingBuffer_Advance(capacity, tail, popped_byte_count));
+    }
+
+    return popped_byte_count;
+}
+
+
+uint32_t ezSpscRingBuffer_GetUsedMemory(ezSpscRingBuffer *ring_buff)
+{
+    return ezSpscRingBuffer_Distance(ring_buff->capacity,
+                                     EZ_ATOMIC_LOAD_ACQUIRE(&ring_buff->head_index),
+                                     EZ_ATOMIC_LOAD_ACQUIRE(&ring_buff->tail_index));
+}
+
+
+uint32_t ezSpscRingBuffer_GetAvailableMemory(ezSpscRingBuffer *ring_buff)
+{
+    return ring_buff->capacity - ezSpscRingBuffer_GetUsedMemory(ring_buff);
+}
+
+
+bool ezSpscRingBuffer_IsEmpty(ezSpscRingBuffer *ring_buff)
+{
+    return (0U == ezSpscRingBuffer_GetUsedMemory(ring_buff));
+}
+
+
+bool ezSpscRingBuffer_IsFull(ezSpscRingBuffer *ring_buff)
+{
+    return (ring_buff->capacity == ezSpscRingBuffer_GetUsedMemory(ring_buff));
+}
+
+
+void ezSpscRingBuffer_Reset(ezSpscRingBuffer *ring_buff)
+{
+    EZ_ATOMIC_STORE_RELAXED(&ring_buff->head_index, 0U);
+    EZ_ATOMIC_STORE_RELEASE(&ring_buff->tail_index, 0U);
+}
+
+
+/*****************************************************************************
+* Local functions
+*****************************************************************************/
+
+/******************************************************************************
+* Function : ezSpscRingBuffer_Distance
+*//**
+* @Description: Return the number of bytes between tail and head
+*
+* @param    capacity: (IN)capacity of the ring buffer
+* @param    head: (IN)head index
+* @param    tail: (IN)tail index
+* @return   number of stored bytes
+*
+*******************************************************************************/
+static uint32_t ezSpscRingBuffer_Distance(uint32_t capacity, uint32_t head, uint32_t tail)
+{
+    return (head >= tail) ? (head - tail) : ((2U * capacity - tail) + head);
+}
+
+
+/******************************************************************************
+* Function : ezSpscRingBuffer_Advance
+*//**
+* @Description: Move an index forward, wrapping at 2 * capacity
+*
+* @param    capacity: (IN)capacity of the ring buffer
+* @param    index: (IN)current index
+* @param    count: (IN)number of bytes to advance, at most capacity
+* @return   new index
+*
+*******************************************************************************/
+static uint32_t ezSpscRingBuffer_Advance(uint32_t capacity, uint32_t index, uint32_t count)
+{
+    uint32_t remain = 2U * capacity - index;
+
+    return (count >= remain) ? (count - remain) : (index + count);
+}
+
+#endif /* EZ_RING_BUFFER == 1U */
+
+/* End of file */
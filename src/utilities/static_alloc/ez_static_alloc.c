@@ -25,6 +25,7 @@
 * Includes
 *****************************************************************************/
 #include "ez_static_alloc.h"
+#include "ez_static_alloc_internal.h"
 
 #if (EZ_STATIC_ALLOC == 1U)
 #include "ez_hexdump.h"
@@ -59,8 +60,23 @@
 #define CONFIG_NUM_OF_MEM_BLOCK 128
 #endif /*CONFIG_NUM_OF_MEM_BLOCK*/
 
+#if (CONFIG_EZ_STATIC_ALLOC_COMPACTION == 1U)
+#define INIT_BLOCK(block, buff_ptr, size) {ezLinkedList_InitNode(&block->node);block->buff = buff_ptr;block->buff_size = size;block->handle = NULL; }
+#else
 #define INIT_BLOCK(block, buff_ptr, size) {ezLinkedList_InitNode(&block->node);block->buff = buff_ptr;block->buff_size = size; }
+#endif
 #define GET_LIST(x) ((struct MemList*)x)
+#if (CONFIG_EZ_STATIC_ALLOC_THREAD_SAFE == 1U)
+#define LOCK_LIST(list)     ezStaticAlloc_LockList(GET_LIST(list))
+#define UNLOCK_LIST(list)   ezStaticAlloc_UnlockList(GET_LIST(list))
+#define LOCK_SHARED_POOL()  do { if (shared_pool_lock != NULL) { shared_pool_lock->lock(shared_pool_lock->context); } } while (0)
+#define UNLOCK_SHARED_POOL() do { if (shared_pool_lock != NULL) { shared_pool_lock->unlock(shared_pool_lock->context); } } while (0)
+#else
+#define LOCK_LIST(list)
+#define UNLOCK_LIST(list)
+#define LOCK_SHARED_POOL()  do { } while (0)
+#define UNLOCK_SHARED_POOL() do { } while (0)
+#endif
 #define GET_BLOCK(node_ptr) (EZ_LINKEDLIST_GET_PARENT_OF(node_ptr, node, struct MemBlock))
 
 /*****************************************************************************
@@ -73,125 +89,282 @@
 * Component Variable Definitions
 *****************************************************************************/
 static struct MemBlock block_pool[CONFIG_NUM_OF_MEM_BLOCK] = { 0U };
+static struct MemBlock *shared_unused_blocks = NULL;
+static bool shared_pool_ready = false;
+#if (CONFIG_EZ_STATIC_ALLOC_THREAD_SAFE == 1U)
+static const ezStaticAllocLock *shared_pool_lock = NULL;
+#endif
 
 
 /*****************************************************************************
 * Function Definitions
 *****************************************************************************/
 static void ezStaticAlloc_ReturnHeaderToFreeList(struct Node *free_list_head, struct Node *free_node);
-static void ezmSmalloc_Merge(struct Node *free_list_head);
+static void ezmSmalloc_Merge(struct MemList *list, struct Node *free_node);
+static struct MemBlock* ezStaticAlloc_FindAllocBlock(struct MemList *list, void *addr);
+static bool ezStaticAlloc_InitLists(ezmMemList* mem_list, void* buff, uint32_t buff_size);
+static void ezStaticAlloc_LinkBlocks(struct MemBlock **unused_blocks, struct MemBlock *blocks, uint16_t num_of_blocks);
 
-struct Node* ezStaticAlloc_ReserveMemoryBlock(struct Node* free_list_head, uint16_t block_size_byte);
+struct Node* ezStaticAlloc_ReserveMemoryBlock(struct MemList* list, ezStaticAllocSize_t block_size_byte, uint32_t alignment);
 bool ezStaticAlloc_MoveBlock(struct Node* move_node, struct Node* from_list_head, struct Node* to_list_head);
-struct MemBlock* GetFreeBlock(void);
-void ReleaseBlock(struct MemBlock* block);
+static struct MemBlock* GetFreeBlock(struct MemList* list);
+static void ReleaseBlock(struct MemList* list, struct MemBlock* block);
+
+static void *ezStaticAlloc_MallocInternal(ezmMemList *mem_list, uint32_t alloc_size, uint32_t alignment);
+static void *ezStaticAlloc_ReallocInternal(struct MemList* list, void* alloc_addr, uint32_t new_size);
+static void *ezStaticAlloc_ResizeBlock(struct MemList* list, struct MemBlock* block, uint32_t new_size);
+static uint32_t ezStaticAlloc_NumOfAllocBlocks(struct MemList* list);
+static uint32_t ezStaticAlloc_NumOfFreeBlocks(struct MemList* list);
+
+static void ezStaticAlloc_CountMalloc(struct MemList* list, uint32_t alloc_size, void* alloc_addr, uint32_t block_size);
+static void ezStaticAlloc_CountFree(struct MemList* list, uint32_t block_size);
+static void ezStaticAlloc_CountResize(struct MemList* list, uint32_t old_block_size, uint32_t new_block_size);
+#if (CONFIG_EZ_STATIC_ALLOC_STATS == 1U)
+static void ezStaticAlloc_GetFreeInfo(struct MemList* list, uint32_t* free_bytes, uint32_t* largest_free_block);
+#endif
 
 
 /*****************************************************************************
 * Public functions
 *****************************************************************************/
-bool ezStaticAlloc_InitMemList(ezmMemList* mem_list, void* buff, uint16_t buff_size)
+bool ezStaticAlloc_InitMemList(ezmMemList* mem_list, void* buff, uint32_t buff_size)
 {
-    bool    is_success = true;
-    struct MemBlock *free_block = NULL;
-
     STCMEMPRINT("ezStaticAlloc_InitMemList()");
-    STCMEMPRINT1("size = %d", sizeof(struct MemList));
-    if (mem_list == NULL || buff == NULL || buff_size == 0)
+
+    if (mem_list == NULL)
     {
-        is_success = false;
+        return false;
     }
 
-    if (is_success)
+    LOCK_SHARED_POOL();
+    if (shared_pool_ready == false)
     {
-        GET_LIST(mem_list)->buff = buff;
-        GET_LIST(mem_list)->buff_size = buff_size;
-        ezLinkedList_InitNode(&GET_LIST(mem_list)->alloc_list_head);
-        ezLinkedList_InitNode(&GET_LIST(mem_list)->free_list_head);
+        ezStaticAlloc_LinkBlocks(&shared_unused_blocks, block_pool, CONFIG_NUM_OF_MEM_BLOCK);
+        shared_pool_ready = true;
+    }
+    UNLOCK_SHARED_POOL();
 
-        free_block = GetFreeBlock();
-        
-        if (NULL != free_block)
-        {
-            INIT_BLOCK(free_block, buff, buff_size);
+    GET_LIST(mem_list)->unused_blocks = NULL;
+    GET_LIST(mem_list)->is_shared_pool = true;
 
-            is_success = is_success && EZ_LINKEDLIST_ADD_HEAD(&GET_LIST(mem_list)->free_list_head, &free_block->node);
-        }
-        else
+    return ezStaticAlloc_InitLists(mem_list, buff, buff_size);
+}
+
+
+bool ezStaticAlloc_InitMemListWithBlocks(ezmMemList* mem_list,
+                                         void* buff,
+                                         uint32_t buff_size,
+                                         struct MemBlock* blocks,
+                                         uint16_t num_of_blocks)
+{
+    uint32_t carved_size = 0U;
+
+    STCMEMPRINT("ezStaticAlloc_InitMemListWithBlocks()");
+
+    if (mem_list == NULL || buff == NULL || num_of_blocks == 0U)
+    {
+        return false;
+    }
+
+    if (blocks == NULL)
+    {
+        /* Descriptors contain pointers, align them before carving */
+        carved_size = (uint32_t)((sizeof(void*) - ((uintptr_t)buff % sizeof(void*))) % sizeof(void*));
+        blocks = (struct MemBlock*)(void*)((uint8_t*)buff + carved_size);
+        carved_size += (uint32_t)(sizeof(struct MemBlock) * num_of_blocks);
+
+        if (carved_size >= buff_size)
         {
-            is_success = false;
+            return false;
         }
+
+        buff = (uint8_t*)buff + carved_size;
+        buff_size -= carved_size;
     }
 
-    ezStaticAlloc_PrintAllocList(mem_list);
-    ezStaticAlloc_PrintFreeList(mem_list);
-    return is_success;
+    GET_LIST(mem_list)->unused_blocks = NULL;
+    GET_LIST(mem_list)->is_shared_pool = false;
+    ezStaticAlloc_LinkBlocks(&GET_LIST(mem_list)->unused_blocks, blocks, num_of_blocks);
+
+    return ezStaticAlloc_InitLists(mem_list, buff, buff_size);
 }
 
 
-void *ezStaticAlloc_Malloc(ezmMemList *mem_list, uint16_t alloc_size)
+void *ezStaticAlloc_Malloc(ezmMemList *mem_list, uint32_t alloc_size)
 {
-    void    *alloc_addr = NULL;
-    bool    is_success = true;
-    struct Node  *reserved_node = NULL;
+    void *alloc_addr = NULL;
 
     STCMEMPRINT("ezStaticAlloc_Malloc()");
 
-    if (NULL == mem_list || 0U == alloc_size)
+    if (mem_list != NULL)
     {
-        is_success = false;
+        LOCK_LIST(mem_list);
+        alloc_addr = ezStaticAlloc_MallocInternal(mem_list, alloc_size, 1U);
+        UNLOCK_LIST(mem_list);
     }
 
-    if (is_success)
+    return alloc_addr;
+}
+
+
+void *ezStaticAlloc_MallocAligned(ezmMemList *mem_list, uint32_t alloc_size, uint32_t alignment)
+{
+    void *alloc_addr = NULL;
+
+    STCMEMPRINT("ezStaticAlloc_MallocAligned()");
+
+    if (mem_list != NULL && alignment != 0U && (alignment & (alignment - 1U)) == 0U)
     {
-        reserved_node = ezStaticAlloc_ReserveMemoryBlock(&GET_LIST(mem_list)->free_list_head, alloc_size);
+        LOCK_LIST(mem_list);
+        alloc_addr = ezStaticAlloc_MallocInternal(mem_list, alloc_size, alignment);
+        UNLOCK_LIST(mem_list);
     }
 
-    if (NULL != reserved_node)
+    return alloc_addr;
+}
+
+
+bool ezStaticAlloc_Free(ezmMemList *mem_list, void *alloc_addr)
+{
+    bool is_success = false;
+
+    STCMEMPRINT1("ezStaticAlloc_Free() - [address = %p]", alloc_addr);
+
+    if (mem_list != NULL && alloc_addr != NULL)
     {
-        is_success = is_success && ezStaticAlloc_MoveBlock(reserved_node, &GET_LIST(mem_list)->free_list_head, &GET_LIST(mem_list)->alloc_list_head);
+        LOCK_LIST(mem_list);
+        is_success = ezStaticAlloc_FreeUnlocked(GET_LIST(mem_list), alloc_addr);
+        UNLOCK_LIST(mem_list);
+    }
 
-        if (is_success)
+    return is_success;
+}
+
+
+uint32_t ezStaticAlloc_FreeBatch(ezmMemList *mem_list, void * const *alloc_addrs, uint32_t num_of_blocks)
+{
+    uint32_t num_of_freed = 0U;
+
+    STCMEMPRINT1("ezStaticAlloc_FreeBatch() - [num of blocks = %d]", num_of_blocks);
+
+    if (mem_list != NULL && alloc_addrs != NULL)
+    {
+        LOCK_LIST(mem_list);
+        for (uint32_t i = 0; i < num_of_blocks; i++)
         {
-            alloc_addr = GET_BLOCK(reserved_node)->buff;
+            if (alloc_addrs[i] != NULL
+                && ezStaticAlloc_FreeUnlocked(GET_LIST(mem_list), alloc_addrs[i]))
+            {
+                num_of_freed++;
+            }
         }
+        UNLOCK_LIST(mem_list);
     }
 
-    ezStaticAlloc_PrintFreeList(mem_list);
-    ezStaticAlloc_PrintAllocList(mem_list);
+    return num_of_freed;
+}
 
-    return alloc_addr;
+
+void *ezStaticAlloc_Realloc(ezmMemList *mem_list, void *alloc_addr, uint32_t new_size)
+{
+    void *new_addr = NULL;
+
+    STCMEMPRINT1("ezStaticAlloc_Realloc() - [address = %p]", alloc_addr);
+
+    if (mem_list == NULL)
+    {
+        return NULL;
+    }
+
+    if (alloc_addr == NULL)
+    {
+        return ezStaticAlloc_Malloc(mem_list, new_size);
+    }
+
+    if (new_size == 0U)
+    {
+        (void)ezStaticAlloc_Free(mem_list, alloc_addr);
+        return NULL;
+    }
+
+    LOCK_LIST(mem_list);
+    new_addr = ezStaticAlloc_ReallocInternal(GET_LIST(mem_list), alloc_addr, new_size);
+    UNLOCK_LIST(mem_list);
+
+    return new_addr;
 }
 
 
-bool ezStaticAlloc_Free(ezmMemList *mem_list, void *alloc_addr)
+#if (CONFIG_EZ_STATIC_ALLOC_COMPACTION == 1U)
+bool ezStaticAlloc_MallocMovable(ezmMemList *mem_list, void **handle, uint32_t alloc_size)
+{
+    STCMEMPRINT("ezStaticAlloc_MallocMovable()");
+
+    if (mem_list == NULL || handle == NULL
+        || EZ_STATIC_ALLOC_FIRST_FIT != GET_LIST(mem_list)->backend)
+    {
+        return false;
+    }
+
+    LOCK_LIST(mem_list);
+    *handle = ezStaticAlloc_MallocInternal(mem_list, alloc_size, 1U);
+    if (*handle != NULL)
+    {
+        /* The new block is added to the tail of the allocated list */
+        GET_BLOCK(GET_LIST(mem_list)->alloc_list_head.prev)->handle = handle;
+    }
+    UNLOCK_LIST(mem_list);
+
+    return (*handle != NULL);
+}
+
+
+uint32_t ezStaticAlloc_Compact(ezmMemList *mem_list)
 {
-    bool        is_success = false;
     struct Node* it_node = NULL;
+    struct MemBlock* free_block = NULL;
+    struct MemBlock* used_block = NULL;
+    uint8_t* free_start = NULL;
+    uint32_t num_of_moved = 0U;
 
-    STCMEMPRINT1("ezStaticAlloc_Free() - [address = %p]", alloc_addr);
+    STCMEMPRINT("ezStaticAlloc_Compact()");
 
-    if (mem_list != NULL && alloc_addr != NULL)
+    if (mem_list == NULL || EZ_STATIC_ALLOC_FIRST_FIT != GET_LIST(mem_list)->backend)
+    {
+        return 0U;
+    }
+
+    LOCK_LIST(mem_list);
+
+    /* Slide every movable block following a free block down to the start of
+     * the free block. The free block moves up and merges with the next free
+     * block, a pinned block stops it */
+    EZ_LINKEDLIST_FOR_EACH(it_node, &GET_LIST(mem_list)->free_list_head)
     {
-        EZ_LINKEDLIST_FOR_EACH(it_node, &GET_LIST(mem_list)->alloc_list_head)
+        free_block = GET_BLOCK(it_node);
+        used_block = ezStaticAlloc_FindAllocBlock(GET_LIST(mem_list), (uint8_t*)free_block->buff + free_block->buff_size);
+
+        while (used_block != NULL && used_block->handle != NULL)
         {
-            if (GET_BLOCK(it_node)->buff == (uint8_t*)alloc_addr)
-            {
-                EZ_LINKEDLIST_UNLINK_NODE(it_node);
-                ezStaticAlloc_ReturnHeaderToFreeList(&GET_LIST(mem_list)->free_list_head, it_node);
-                ezmSmalloc_Merge(&GET_LIST(mem_list)->free_list_head);
-                is_success = true;
-                STCMEMPRINT("Free OK");
-                break;
-            }
+            free_start = (uint8_t*)free_block->buff;
+            memmove(free_start, used_block->buff, used_block->buff_size);
+            free_block->buff = free_start + used_block->buff_size;
+            used_block->buff = free_start;
+            *used_block->handle = free_start;
+            num_of_moved++;
+
+            ezmSmalloc_Merge(GET_LIST(mem_list), it_node);
+            used_block = ezStaticAlloc_FindAllocBlock(GET_LIST(mem_list), (uint8_t*)free_block->buff + free_block->buff_size);
         }
     }
 
     ezStaticAlloc_PrintFreeList(mem_list);
     ezStaticAlloc_PrintAllocList(mem_list);
+    UNLOCK_LIST(mem_list);
 
-    return is_success;
+    return num_of_moved;
 }
+#endif /* CONFIG_EZ_STATIC_ALLOC_COMPACTION == 1U */
 
 
 bool ezStaticAlloc_IsMemListReady(ezmMemList *mem_list)
@@ -270,129 +443,876 @@ void ezStaticAlloc_PrintAllocList(ezmMemList * mem_list)
 }
 
 
-uint16_t ezStaticAlloc_GetNumOfAllocBlock(ezmMemList* mem_list)
+uint32_t ezStaticAlloc_GetNumOfAllocBlock(ezmMemList* mem_list)
+{
+    uint32_t num_of_blocks = 0U;
+
+    LOCK_LIST(mem_list);
+    num_of_blocks = ezStaticAlloc_NumOfAllocBlocks(GET_LIST(mem_list));
+    UNLOCK_LIST(mem_list);
+
+    return num_of_blocks;
+}
+
+
+uint32_t ezStaticAlloc_GetNumOfFreeBlock(ezmMemList* mem_list)
+{
+    uint32_t num_of_blocks = 0U;
+
+    LOCK_LIST(mem_list);
+    num_of_blocks = ezStaticAlloc_NumOfFreeBlocks(GET_LIST(mem_list));
+    UNLOCK_LIST(mem_list);
+
+    return num_of_blocks;
+}
+
+
+#if (CONFIG_EZ_STATIC_ALLOC_THREAD_SAFE == 1U)
+void ezStaticAlloc_SetLock(ezmMemList* mem_list, const ezStaticAllocLock* lock)
+{
+    if (mem_list != NULL)
+    {
+        GET_LIST(mem_list)->lock = (lock != NULL && lock->lock != NULL && lock->unlock != NULL) ? lock : NULL;
+    }
+}
+
+
+void ezStaticAlloc_SetSharedPoolLock(const ezStaticAllocLock* lock)
+{
+    shared_pool_lock = (lock != NULL && lock->lock != NULL && lock->unlock != NULL) ? lock : NULL;
+}
+#endif
+
+
+#if (CONFIG_EZ_STATIC_ALLOC_STATS == 1U)
+bool ezStaticAlloc_GetStats(ezmMemList* mem_list, ezStaticAllocStats* stats)
+{
+    if (mem_list == NULL || stats == NULL || ezStaticAlloc_IsMemListReady(mem_list) == false)
+    {
+        return false;
+    }
+
+    LOCK_LIST(mem_list);
+    stats->counters = GET_LIST(mem_list)->counters;
+    ezStaticAlloc_GetFreeInfo(GET_LIST(mem_list), &stats->free_bytes, &stats->largest_free_block);
+    stats->num_of_free_blocks = ezStaticAlloc_NumOfFreeBlocks(GET_LIST(mem_list));
+    stats->num_of_alloc_blocks = ezStaticAlloc_NumOfAllocBlocks(GET_LIST(mem_list));
+    UNLOCK_LIST(mem_list);
+    stats->fragmentation = 0U;
+    if (stats->free_bytes > 0U)
+    {
+        stats->fragmentation = (uint8_t)(100U - (uint32_t)(((uint64_t)stats->largest_free_block * 100U) / stats->free_bytes));
+    }
+
+    return true;
+}
+
+
+void ezStaticAlloc_ResetStats(ezmMemList* mem_list)
+{
+    ezStaticAllocCounters *counters = NULL;
+    ezStaticAllocCounters cleared = { 0U };
+
+    if (mem_list != NULL)
+    {
+        LOCK_LIST(mem_list);
+        counters = &GET_LIST(mem_list)->counters;
+        cleared.used_bytes = counters->used_bytes;
+        cleared.peak_used_bytes = counters->used_bytes;
+        cleared.failure_trace = counters->failure_trace;
+        cleared.failure_trace_size = counters->failure_trace_size;
+        *counters = cleared;
+        UNLOCK_LIST(mem_list);
+    }
+}
+
+
+void ezStaticAlloc_SetFailureTrace(ezmMemList* mem_list,
+                                   ezStaticAllocFailure* trace,
+                                   uint32_t trace_size)
 {
-    return ezLinkedList_GetListSize(&GET_LIST(mem_list)->alloc_list_head);
+    if (mem_list != NULL)
+    {
+        LOCK_LIST(mem_list);
+        GET_LIST(mem_list)->counters.failure_trace = (trace_size > 0U) ? trace : NULL;
+        GET_LIST(mem_list)->counters.failure_trace_size = (trace != NULL) ? trace_size : 0U;
+        UNLOCK_LIST(mem_list);
+    }
 }
 
 
-uint16_t ezStaticAlloc_GetNumOfFreeBlock(ezmMemList* mem_list)
+uint32_t ezStaticAlloc_GetFailures(ezmMemList* mem_list,
+                                   ezStaticAllocFailure* failures,
+                                   uint32_t max_failures)
 {
-    return ezLinkedList_GetListSize(&GET_LIST(mem_list)->free_list_head);
+    ezStaticAllocCounters *counters = NULL;
+    uint32_t count = 0U;
+
+    if (mem_list != NULL && failures != NULL)
+    {
+        /* The trace may be changed by ezStaticAlloc_SetFailureTrace */
+        LOCK_LIST(mem_list);
+        counters = &GET_LIST(mem_list)->counters;
+        if (counters->failure_trace != NULL)
+        {
+            count = (counters->num_of_failed < counters->failure_trace_size) ? counters->num_of_failed : counters->failure_trace_size;
+            count = (count < max_failures) ? count : max_failures;
+
+            /* Oldest first */
+            for (uint32_t i = 0; i < count; i++)
+            {
+                failures[i] = counters->failure_trace[(counters->num_of_failed - count + i) % counters->failure_trace_size];
+            }
+        }
+        UNLOCK_LIST(mem_list);
+    }
+
+    return count;
 }
+#endif /* CONFIG_EZ_STATIC_ALLOC_STATS == 1U */
+
+
 /**************************** Private function *******************************/
 
 /******************************************************************************
-* Function : ezStaticAlloc_ReturnHeaderToFreeList
+* Function : ezStaticAlloc_MallocInternal
 *//**
 * \b Description:
 *
-* This function returns the free memory header (and its buffer) to the free list
+* This function allocates a block starting at a multiple of alignment
 *
-* PRE-CONDITION: None
+* PRE-CONDITION: alignment is a power of two
 *
 * POST-CONDITION: None
 *
-* @param    *free_list      free list the the header will be returned
-* @param    *free_header    the header to be moved
+* @param    *mem_list       memory list
+* @param    alloc_size      number of bytes
+* @param    alignment       alignment of the block, 1 for none
 *
-* @return   None
+* @return   address of the block or NULL
 *
 *******************************************************************************/
-static void ezStaticAlloc_ReturnHeaderToFreeList(struct Node* free_list_head, struct Node* free_node)
+static void *ezStaticAlloc_MallocInternal(ezmMemList *mem_list, uint32_t alloc_size, uint32_t alignment)
 {
-    memset(GET_BLOCK(free_node)->buff, 0, GET_BLOCK(free_node)->buff_size);
-    struct Node* it_node = NULL;
+    void    *alloc_addr = NULL;
+    bool    is_success = true;
+    struct Node  *reserved_node = NULL;
+    uint32_t block_size = 0U;
 
-    if (free_list_head != NULL && free_node != NULL)
+    if (NULL == mem_list || 0U == alloc_size)
     {
-        if (IS_LIST_EMPTY(free_list_head))
-        {
-            EZ_LINKEDLIST_ADD_HEAD(free_list_head, free_node);
-        }
-        else
+        is_success = false;
+    }
+
+    /* Larger than the whole buffer, also guards the size arithmetic */
+    if (is_success
+        && (alloc_size > GET_LIST(mem_list)->buff_size || alignment > GET_LIST(mem_list)->buff_size))
+    {
+        STCMEMPRINT("allocation larger than the buffer");
+    }
+    else if (is_success && EZ_STATIC_ALLOC_TLSF == GET_LIST(mem_list)->backend)
+    {
+        alloc_addr = ezStaticAlloc_TlsfMallocAligned(GET_LIST(mem_list), alloc_size, alignment, &block_size);
+    }
+    else if (is_success)
+    {
+        reserved_node = ezStaticAlloc_ReserveMemoryBlock(GET_LIST(mem_list), (ezStaticAllocSize_t)alloc_size, alignment);
+    }
+
+    if (NULL != reserved_node)
+    {
+        is_success = is_success && ezStaticAlloc_MoveBlock(reserved_node, &GET_LIST(mem_list)->free_list_head, &GET_LIST(mem_list)->alloc_list_head);
+
+        if (is_success)
         {
-            /* tranverse the list to add the node, we aort the address in the order so merge operation will be easier*/
-            EZ_LINKEDLIST_FOR_EACH(it_node, free_list_head)
-            {
-                if (GET_BLOCK(free_node)->buff < GET_BLOCK(it_node)->buff)
-                {
-                    ezLinkedList_AppendNode(free_node, it_node->prev);
-                    break;
-                }
-                else if (GET_BLOCK(free_node)->buff > GET_BLOCK(it_node)->buff)
-                {
-                    ezLinkedList_AppendNode(free_node, it_node);
-                    break;
-                }
-                else
-                {
-                    /* do nothing, advance pointer */
-                }
-            }
+            alloc_addr = GET_BLOCK(reserved_node)->buff;
+            block_size = GET_BLOCK(reserved_node)->buff_size;
         }
     }
+
+    if (is_success)
+    {
+        ezStaticAlloc_CountMalloc(GET_LIST(mem_list), alloc_size, alloc_addr, block_size);
+    }
+
+    ezStaticAlloc_PrintFreeList(mem_list);
+    ezStaticAlloc_PrintAllocList(mem_list);
+
+    return alloc_addr;
 }
 
+
 /******************************************************************************
-* Function : ezmSmalloc_Merge
+* Function : ezStaticAlloc_ReallocInternal
 *//**
 * \b Description:
 *
-* This function tries to merge the adjacent free blocks into a bigger block
+* This function resizes a block in place if the backend can, otherwise moves
+* it to a new block
 *
-* PRE-CONDITION: None
+* PRE-CONDITION: new_size is not 0, the caller holds the lock
 *
 * POST-CONDITION: None
 *
-* @param    *free_list      free list the the header will be returned
+* @param    *list           memory list
+* @param    *alloc_addr     address of the block
+* @param    new_size        new size of the block
 *
-* @return   None
+* @return   address of the block, NULL if alloc_addr is not allocated from the
+*           list or not enough memory
 *
 *******************************************************************************/
-static void ezmSmalloc_Merge(struct Node* free_list_head)
+static void *ezStaticAlloc_ReallocInternal(struct MemList* list, void* alloc_addr, uint32_t new_size)
 {
-    //MemHdr* head = free_list->pstHead;
-    //MemHdr* next = head->pstNextNode;
+    struct MemBlock* block = NULL;
+    void* new_addr = NULL;
+    uint32_t old_size = 0U;
+    uint32_t block_size = 0U;
+
+    if (EZ_STATIC_ALLOC_TLSF == list->backend)
+    {
+        old_size = ezStaticAlloc_TlsfGetBlockSize(list, alloc_addr);
+        if (old_size != 0U && new_size <= list->buff_size)
+        {
+            new_addr = ezStaticAlloc_TlsfResize(list, alloc_addr, new_size, &block_size);
+        }
+    }
+    else
+    {
+        block = ezStaticAlloc_FindAllocBlock(list, alloc_addr);
+        if (block != NULL)
+        {
+            old_size = block->buff_size;
+            if (new_size <= list->buff_size)
+            {
+                new_addr = ezStaticAlloc_ResizeBlock(list, block, new_size);
+                block_size = block->buff_size;
+            }
+        }
+    }
 
-    struct Node* it_node = free_list_head->next;
-    struct Node* it_next = it_node->next;
-    while (it_next != free_list_head &&
-        ((uint8_t*)GET_BLOCK(it_node)->buff + GET_BLOCK(it_node)->buff_size) == (uint8_t*)GET_BLOCK(it_next)->buff)
+    if (old_size == 0U)
     {
+        return NULL;
+    }
 
-        STCMEMPRINT("Next adjacent block is free");
-        GET_BLOCK(it_node)->buff_size += GET_BLOCK(it_next)->buff_size;
-        EZ_LINKEDLIST_UNLINK_NODE(it_next);
-        ReleaseBlock(GET_BLOCK(it_next));
-        it_next = it_node->next;
+    if (new_addr != NULL)
+    {
+        ezStaticAlloc_CountResize(list, old_size, block_size);
+        return new_addr;
     }
-}
 
-struct MemBlock* GetFreeBlock(void)
-{
-    struct MemBlock* free_block = NULL;
-    for (uint16_t i = 0; i < CONFIG_NUM_OF_MEM_BLOCK; i++)
+    /* Last resort, the neighbours are too small */
+    new_addr = ezStaticAlloc_MallocInternal(list, new_size, 1U);
+    if (new_addr != NULL)
     {
-        if (block_pool[i].buff == NULL)
+        memcpy(new_addr, alloc_addr, (old_size < new_size) ? old_size : new_size);
+#if (CONFIG_EZ_STATIC_ALLOC_COMPACTION == 1U)
+        if (block != NULL && block->handle != NULL)
         {
-            free_block = &block_pool[i];
-            ezLinkedList_InitNode(&free_block->node);
-            break;
+            /* The new block is added to the tail of the allocated list */
+            GET_BLOCK(list->alloc_list_head.prev)->handle = block->handle;
+            *block->handle = new_addr;
+            block->handle = NULL;
         }
+#endif
+        (void)ezStaticAlloc_FreeUnlocked(list, alloc_addr);
     }
-    return free_block;
+
+    return new_addr;
 }
 
-void ReleaseBlock(struct MemBlock* block)
-{
+
+/******************************************************************************
+* Function : ezStaticAlloc_ResizeBlock
+*//**
+* \b Description:
+*
+* This function resizes a block of the first fit backend using its free
+* neighbours. The block grows into the next free block first, so the data
+* stays in place, then into the previous free block, so the data moves down
+*
+* PRE-CONDITION: block is allocated, new_size is not 0 and not larger than
+* the buffer
+*
+* POST-CONDITION: None
+*
+* @param    *list           memory list
+* @param    *block          descriptor of the block
+* @param    new_size        new size of the block
+*
+* @return   address of the block, NULL if the neighbours are too small
+*
+*******************************************************************************/
+static void *ezStaticAlloc_ResizeBlock(struct MemList* list, struct MemBlock* block, uint32_t new_size)
+{
+    struct Node* it_node = NULL;
+    struct MemBlock* prev_free = NULL;
+    struct MemBlock* next_free = NULL;
+    struct MemBlock* tail = NULL;
+    uint8_t* block_end = (uint8_t*)block->buff + block->buff_size;
+    uint8_t* new_start = NULL;
+    uint32_t total_size = block->buff_size;
+
+    if (new_size <= block->buff_size)
+    {
+        /* Without a descriptor for the tail the block keeps its size */
+        if (new_size < block->buff_size)
+        {
+            tail = GetFreeBlock(list);
+        }
+
+        if (tail != NULL)
+        {
+            tail->buff = (uint8_t*)block->buff + new_size;
+            tail->buff_size = (ezStaticAllocSize_t)(block->buff_size - new_size);
+            block->buff_size = (ezStaticAllocSize_t)new_size;
+            ezStaticAlloc_ReturnHeaderToFreeList(&list->free_list_head, &tail->node);
+            ezmSmalloc_Merge(list, &tail->node);
+        }
+        return block->buff;
+    }
+
+    /* The free list is sorted by address */
+    EZ_LINKEDLIST_FOR_EACH(it_node, &list->free_list_head)
+    {
+        if ((uint8_t*)GET_BLOCK(it_node)->buff > block_end)
+        {
+            break;
+        }
+        else if ((uint8_t*)GET_BLOCK(it_node)->buff == block_end)
+        {
+            next_free = GET_BLOCK(it_node);
+            total_size += next_free->buff_size;
+            break;
+        }
+        else if ((uint8_t*)GET_BLOCK(it_node)->buff + GET_BLOCK(it_node)->buff_size == (uint8_t*)block->buff)
+        {
+            prev_free = GET_BLOCK(it_node);
+        }
+    }
+
+    if (next_free != NULL && total_size >= new_size)
+    {
+        if (total_size == new_size)
+        {
+            EZ_LINKEDLIST_UNLINK_NODE(&next_free->node);
+            ReleaseBlock(list, next_free);
+        }
+        else
+        {
+            next_free->buff = (uint8_t*)block->buff + new_size;
+            next_free->buff_size = (ezStaticAllocSize_t)(total_size - new_size);
+        }
+        block->buff_size = (ezStaticAllocSize_t)new_size;
+        return block->buff;
+    }
+
+    if (prev_free == NULL || total_size + prev_free->buff_size < new_size)
+    {
+        return NULL;
+    }
+
+    new_start = (uint8_t*)prev_free->buff;
+    total_size += prev_free->buff_size;
+    memmove(new_start, block->buff, block->buff_size);
+
+    if (next_free != NULL)
+    {
+        EZ_LINKEDLIST_UNLINK_NODE(&next_free->node);
+        ReleaseBlock(list, next_free);
+    }
+
+    /* The descriptor of the previous block keeps the rest, free memory is
+     * cleared like on free */
+    if (total_size == new_size)
+    {
+        EZ_LINKEDLIST_UNLINK_NODE(&prev_free->node);
+        ReleaseBlock(list, prev_free);
+    }
+    else
+    {
+        prev_free->buff = new_start + new_size;
+        prev_free->buff_size = (ezStaticAllocSize_t)(total_size - new_size);
+        memset(prev_free->buff, 0, prev_free->buff_size);
+    }
+
+    block->buff = new_start;
+    block->buff_size = (ezStaticAllocSize_t)new_size;
+#if (CONFIG_EZ_STATIC_ALLOC_COMPACTION == 1U)
+    if (block->handle != NULL)
+    {
+        *block->handle = new_start;
+    }
+#endif
+
+    return new_start;
+}
+
+
+/******************************************************************************
+* Function : ezStaticAlloc_FreeUnlocked
+*//**
+* \b Description:
+*
+* This function frees a block without taking the lock of the list
+*
+* PRE-CONDITION: list and alloc_addr are not NULL, the caller holds the lock
+*
+* POST-CONDITION: None
+*
+* @param    *list           memory list
+* @param    *alloc_addr     address of the block
+*
+* @return   true if the block was allocated from the list
+*
+*******************************************************************************/
+bool ezStaticAlloc_FreeUnlocked(struct MemList* list, void* alloc_addr)
+{
+    bool        is_success = false;
+    struct MemBlock* block = NULL;
+    uint32_t    block_size = 0U;
+
+    if (EZ_STATIC_ALLOC_TLSF == list->backend)
+    {
+        is_success = ezStaticAlloc_TlsfFree(list, alloc_addr, &block_size);
+    }
+    else
+    {
+        block = ezStaticAlloc_FindAllocBlock(list, alloc_addr);
+        if (block != NULL)
+        {
+            block_size = block->buff_size;
+#if (CONFIG_EZ_STATIC_ALLOC_COMPACTION == 1U)
+            if (block->handle != NULL)
+            {
+                *block->handle = NULL;
+                block->handle = NULL;
+            }
+#endif
+            EZ_LINKEDLIST_UNLINK_NODE(&block->node);
+            ezStaticAlloc_ReturnHeaderToFreeList(&list->free_list_head, &block->node);
+            ezmSmalloc_Merge(list, &block->node);
+            is_success = true;
+            STCMEMPRINT("Free OK");
+        }
+    }
+
+    if (is_success)
+    {
+        ezStaticAlloc_CountFree(list, block_size);
+    }
+
+    ezStaticAlloc_PrintFreeList(list);
+    ezStaticAlloc_PrintAllocList(list);
+
+    return is_success;
+}
+
+
+/******************************************************************************
+* Function : ezStaticAlloc_NumOfAllocBlocks
+*//**
+* \b Description:
+*
+* This function counts the allocated blocks without taking the lock
+*
+* PRE-CONDITION: None
+*
+* POST-CONDITION: None
+*
+* @param    *list           memory list
+*
+* @return   number of allocated blocks
+*
+*******************************************************************************/
+static uint32_t ezStaticAlloc_NumOfAllocBlocks(struct MemList* list)
+{
+    if (EZ_STATIC_ALLOC_TLSF == list->backend)
+    {
+        return ezStaticAlloc_TlsfGetNumOfAllocBlock(list);
+    }
+    return ezLinkedList_GetListSize(&list->alloc_list_head);
+}
+
+
+/******************************************************************************
+* Function : ezStaticAlloc_NumOfFreeBlocks
+*//**
+* \b Description:
+*
+* This function counts the free blocks without taking the lock
+*
+* PRE-CONDITION: None
+*
+* POST-CONDITION: None
+*
+* @param    *list           memory list
+*
+* @return   number of free blocks
+*
+*******************************************************************************/
+static uint32_t ezStaticAlloc_NumOfFreeBlocks(struct MemList* list)
+{
+    if (EZ_STATIC_ALLOC_TLSF == list->backend)
+    {
+        return ezStaticAlloc_TlsfGetNumOfFreeBlock(list);
+    }
+    return ezLinkedList_GetListSize(&list->free_list_head);
+}
+
+
+#if (CONFIG_EZ_STATIC_ALLOC_THREAD_SAFE == 1U)
+/******************************************************************************
+* Function : ezStaticAlloc_LockList
+*//**
+* \b Description:
+*
+* This function takes the lock of the list, if one is set
+*
+* PRE-CONDITION: None
+*
+* POST-CONDITION: None
+*
+* @param    *list           memory list
+*
+* @return   None
+*
+*******************************************************************************/
+void ezStaticAlloc_LockList(struct MemList* list)
+{
+    if (list->lock != NULL)
+    {
+        list->lock->lock(list->lock->context);
+    }
+}
+
+
+/******************************************************************************
+* Function : ezStaticAlloc_UnlockList
+*//**
+* \b Description:
+*
+* This function releases the lock of the list, if one is set
+*
+* PRE-CONDITION: the lock is held by the caller
+*
+* POST-CONDITION: None
+*
+* @param    *list           memory list
+*
+* @return   None
+*
+*******************************************************************************/
+void ezStaticAlloc_UnlockList(struct MemList* list)
+{
+    if (list->lock != NULL)
+    {
+        list->lock->unlock(list->lock->context);
+    }
+}
+#endif /* CONFIG_EZ_STATIC_ALLOC_THREAD_SAFE == 1U */
+
+/******************************************************************************
+* Function : ezStaticAlloc_ReturnHeaderToFreeList
+*//**
+* \b Description:
+*
+* This function returns the free memory header (and its buffer) to the free list
+*
+* PRE-CONDITION: None
+*
+* POST-CONDITION: None
+*
+* @param    *free_list      free list the the header will be returned
+* @param    *free_header    the header to be moved
+*
+* @return   None
+*
+*******************************************************************************/
+static void ezStaticAlloc_ReturnHeaderToFreeList(struct Node* free_list_head, struct Node* free_node)
+{
+    memset(GET_BLOCK(free_node)->buff, 0, GET_BLOCK(free_node)->buff_size);
+    struct Node* it_node = NULL;
+
+    if (free_list_head != NULL && free_node != NULL)
+    {
+        if (IS_LIST_EMPTY(free_list_head))
+        {
+            EZ_LINKEDLIST_ADD_HEAD(free_list_head, free_node);
+        }
+        else
+        {
+            /* Keep the list sorted by address, so the neighbours of a block
+             * in memory are its neighbours in the list */
+            EZ_LINKEDLIST_FOR_EACH(it_node, free_list_head)
+            {
+                if ((uint8_t*)GET_BLOCK(free_node)->buff < (uint8_t*)GET_BLOCK(it_node)->buff)
+                {
+                    break;
+                }
+            }
+            ezLinkedList_AppendNode(free_node, it_node->prev);
+        }
+    }
+}
+
+/******************************************************************************
+* Function : ezmSmalloc_Merge
+*//**
+* \b Description:
+*
+* This function merges a free block with its free neighbours in memory
+*
+* PRE-CONDITION: the free list is sorted by address
+*
+* POST-CONDITION: None
+*
+* @param    *list           memory list owning the free list
+* @param    *free_node      node of the free block
+*
+* @return   None
+*
+*******************************************************************************/
+static void ezmSmalloc_Merge(struct MemList* list, struct Node* free_node)
+{
+    struct Node* free_list_head = &list->free_list_head;
+    struct Node* it_prev = free_node->prev;
+    struct Node* it_next = free_node->next;
+
+    if (it_prev != free_list_head &&
+        ((uint8_t*)GET_BLOCK(it_prev)->buff + GET_BLOCK(it_prev)->buff_size) == (uint8_t*)GET_BLOCK(free_node)->buff)
+    {
+        STCMEMPRINT("Previous adjacent block is free");
+        GET_BLOCK(it_prev)->buff_size += GET_BLOCK(free_node)->buff_size;
+        EZ_LINKEDLIST_UNLINK_NODE(free_node);
+        ReleaseBlock(list, GET_BLOCK(free_node));
+        free_node = it_prev;
+    }
+
+    if (it_next != free_list_head &&
+        ((uint8_t*)GET_BLOCK(free_node)->buff + GET_BLOCK(free_node)->buff_size) == (uint8_t*)GET_BLOCK(it_next)->buff)
+    {
+        STCMEMPRINT("Next adjacent block is free");
+        GET_BLOCK(free_node)->buff_size += GET_BLOCK(it_next)->buff_size;
+        EZ_LINKEDLIST_UNLINK_NODE(it_next);
+        ReleaseBlock(list, GET_BLOCK(it_next));
+    }
+}
+
+/******************************************************************************
+* Function : ezStaticAlloc_FindAllocBlock
+*//**
+* \b Description:
+*
+* This function searches the allocated block starting at an address
+*
+* PRE-CONDITION: None
+*
+* POST-CONDITION: None
+*
+* @param    *list           memory list
+* @param    *addr           start address of the block
+*
+* @return   descriptor of the block or NULL if not allocated
+*
+*******************************************************************************/
+static struct MemBlock* ezStaticAlloc_FindAllocBlock(struct MemList* list, void* addr)
+{
+    struct Node* it_node = NULL;
+
+    EZ_LINKEDLIST_FOR_EACH(it_node, &list->alloc_list_head)
+    {
+        if ((uint8_t*)GET_BLOCK(it_node)->buff == (uint8_t*)addr)
+        {
+            return GET_BLOCK(it_node);
+        }
+    }
+
+    return NULL;
+}
+
+/******************************************************************************
+* Function : ezStaticAlloc_InitLists
+*//**
+* \b Description:
+*
+* This function initializes the free and allocated lists. The whole buffer
+* becomes one free block
+*
+* PRE-CONDITION: descriptors of the list are linked
+*
+* POST-CONDITION: None
+*
+* @param    *mem_list       memory list
+* @param    *buff           buffer to be managed
+* @param    buff_size       size of the buffer
+*
+* @return   true if success
+*
+*******************************************************************************/
+static bool ezStaticAlloc_InitLists(ezmMemList* mem_list, void* buff, uint32_t buff_size)
+{
+    bool    is_success = true;
+    struct MemBlock *free_block = NULL;
+
+    STCMEMPRINT1("size = %d", sizeof(struct MemList));
+    if (buff == NULL || buff_size == 0 || buff_size > EZ_STATIC_ALLOC_MAX_SIZE)
+    {
+        is_success = false;
+    }
+
+    if (is_success)
+    {
+        GET_LIST(mem_list)->buff = buff;
+        GET_LIST(mem_list)->buff_size = (ezStaticAllocSize_t)buff_size;
+        GET_LIST(mem_list)->backend = EZ_STATIC_ALLOC_FIRST_FIT;
+#if (CONFIG_EZ_STATIC_ALLOC_THREAD_SAFE == 1U)
+        GET_LIST(mem_list)->lock = NULL;
+#endif
+#if (CONFIG_EZ_STATIC_ALLOC_STATS == 1U)
+        memset(&GET_LIST(mem_list)->counters, 0, sizeof(GET_LIST(mem_list)->counters));
+#endif
+        ezLinkedList_InitNode(&GET_LIST(mem_list)->alloc_list_head);
+        ezLinkedList_InitNode(&GET_LIST(mem_list)->free_list_head);
+
+        free_block = GetFreeBlock(GET_LIST(mem_list));
+        
+        if (NULL != free_block)
+        {
+            INIT_BLOCK(free_block, buff, (ezStaticAllocSize_t)buff_size);
+
+            is_success = is_success && EZ_LINKEDLIST_ADD_HEAD(&GET_LIST(mem_list)->free_list_head, &free_block->node);
+        }
+        else
+        {
+            is_success = false;
+        }
+    }
+
+    ezStaticAlloc_PrintAllocList(mem_list);
+    ezStaticAlloc_PrintFreeList(mem_list);
+    return is_success;
+}
+
+/******************************************************************************
+* Function : ezStaticAlloc_LinkBlocks
+*//**
+* \b Description:
+*
+* This function pushes an array of descriptors to a list of unused
+* descriptors. The first descriptor of the array is handed out first
+*
+* PRE-CONDITION: None
+*
+* POST-CONDITION: None
+*
+* @param    **unused_blocks head of the unused descriptors
+* @param    *blocks         array of descriptors
+* @param    num_of_blocks   number of descriptors
+*
+* @return   None
+*
+*******************************************************************************/
+static void ezStaticAlloc_LinkBlocks(struct MemBlock **unused_blocks, struct MemBlock *blocks, uint16_t num_of_blocks)
+{
+    for (uint16_t i = num_of_blocks; i > 0U; i--)
+    {
+        INIT_BLOCK((&blocks[i - 1U]), NULL, 0U);
+        blocks[i - 1U].node.next = (*unused_blocks != NULL) ? &(*unused_blocks)->node : NULL;
+        *unused_blocks = &blocks[i - 1U];
+    }
+}
+
+/******************************************************************************
+* Function : GetFreeBlock
+*//**
+* \b Description:
+*
+* This function takes an unused descriptor of the list in O(1)
+*
+* PRE-CONDITION: None
+*
+* POST-CONDITION: None
+*
+* @param    *list           memory list
+*
+* @return   descriptor or NULL if all of them are in use
+*
+*******************************************************************************/
+static struct MemBlock* GetFreeBlock(struct MemList* list)
+{
+    struct MemBlock **unused_blocks = list->is_shared_pool ? &shared_unused_blocks : &list->unused_blocks;
+    struct MemBlock* free_block = NULL;
+
+    /* The shared pool is used by lists with different locks */
+    if (list->is_shared_pool)
+    {
+        LOCK_SHARED_POOL();
+    }
+
+    free_block = *unused_blocks;
+    if (free_block != NULL)
+    {
+        *unused_blocks = (free_block->node.next != NULL) ? GET_BLOCK(free_block->node.next) : NULL;
+    }
+
+    if (list->is_shared_pool)
+    {
+        UNLOCK_SHARED_POOL();
+    }
+
+    if (free_block != NULL)
+    {
+        ezLinkedList_InitNode(&free_block->node);
+    }
+    return free_block;
+}
+
+/******************************************************************************
+* Function : ReleaseBlock
+*//**
+* \b Description:
+*
+* This function gives a descriptor back to the list in O(1)
+*
+* PRE-CONDITION: block is not linked in the free or allocated list
+*
+* POST-CONDITION: None
+*
+* @param    *list           memory list
+* @param    *block          descriptor to be released
+*
+* @return   None
+*
+*******************************************************************************/
+static void ReleaseBlock(struct MemList* list, struct MemBlock* block)
+{
+    struct MemBlock **unused_blocks = list->is_shared_pool ? &shared_unused_blocks : &list->unused_blocks;
+
     INIT_BLOCK(block, NULL, 0U);
+
+    if (list->is_shared_pool)
+    {
+        LOCK_SHARED_POOL();
+    }
+
+    block->node.next = (*unused_blocks != NULL) ? &(*unused_blocks)->node : NULL;
+    *unused_blocks = block;
+
+    if (list->is_shared_pool)
+    {
+        UNLOCK_SHARED_POOL();
+    }
 }
 
-struct Node* ezStaticAlloc_ReserveMemoryBlock(struct Node* free_list_head, uint16_t block_size_byte)
+struct Node* ezStaticAlloc_ReserveMemoryBlock(struct MemList* list, ezStaticAllocSize_t block_size_byte, uint32_t alignment)
 {
+    struct Node* free_list_head = &list->free_list_head;
     struct MemBlock* remain_block = NULL;
+    struct MemBlock* front_block = NULL;
     struct Node* iterate_Node = NULL;
+    ezStaticAllocSize_t padding = 0U;
     bool success = false;
 
     STCMEMPRINT("ezStaticAlloc_ReserveMemoryBlock()");
@@ -405,23 +1325,44 @@ struct Node* ezStaticAlloc_ReserveMemoryBlock(struct Node* free_list_head, uint1
             {
                 break;
             }
-            
-            if (GET_BLOCK(iterate_Node)->buff_size >= block_size_byte)
+
+            padding = (ezStaticAllocSize_t)((alignment - ((uintptr_t)GET_BLOCK(iterate_Node)->buff % alignment)) % alignment);
+
+            if (GET_BLOCK(iterate_Node)->buff_size >= block_size_byte
+                && GET_BLOCK(iterate_Node)->buff_size - block_size_byte >= padding)
             {
+                /* The padding in front of an aligned block stays free */
+                if (padding > 0U)
+                {
+                    front_block = GetFreeBlock(list);
+                    if (front_block == NULL)
+                    {
+                        /* A later block may be aligned already and need none */
+                        continue;
+                    }
+
+                    front_block->buff = GET_BLOCK(iterate_Node)->buff;
+                    front_block->buff_size = padding;
+                    ezLinkedList_AppendNode(&front_block->node, iterate_Node->prev);
+                    GET_BLOCK(iterate_Node)->buff = (uint8_t*)GET_BLOCK(iterate_Node)->buff + padding;
+                    GET_BLOCK(iterate_Node)->buff_size -= padding;
+                }
+
                 if (GET_BLOCK(iterate_Node)->buff_size > block_size_byte)
                 {
-                    remain_block = GetFreeBlock();
+                    remain_block = GetFreeBlock(list);
                 }
 
+                /* Without a descriptor for the remainder, hand out the whole block */
                 if (remain_block)
                 {
                     remain_block->buff_size = GET_BLOCK(iterate_Node)->buff_size - block_size_byte;
                     remain_block->buff = (uint8_t*)GET_BLOCK(iterate_Node)->buff + block_size_byte;
-                    EZ_LINKEDLIST_ADD_TAIL(free_list_head, &remain_block->node);
+                    /* The remainder directly follows, the list stays sorted */
+                    ezLinkedList_AppendNode(&remain_block->node, iterate_Node);
+                    GET_BLOCK(iterate_Node)->buff_size = block_size_byte;
                 }
 
-                GET_BLOCK(iterate_Node)->buff_size = block_size_byte;
-
                 success = true;
                 break;
             }
@@ -451,5 +1392,168 @@ bool ezStaticAlloc_MoveBlock(struct Node* move_node, struct Node* from_list_head
 
     return is_success;
 }
+/******************************************************************************
+* Function : ezStaticAlloc_CountMalloc
+*//**
+* \b Description:
+*
+* This function updates the counters after an allocation
+*
+* PRE-CONDITION: None
+*
+* POST-CONDITION: None
+*
+* @param    *list           memory list
+* @param    alloc_size      requested size
+* @param    *alloc_addr     allocated memory, NULL if the allocation failed
+* @param    block_size      size of the allocated block
+*
+* @return   None
+*
+*******************************************************************************/
+static void ezStaticAlloc_CountMalloc(struct MemList* list, uint32_t alloc_size, void* alloc_addr, uint32_t block_size)
+{
+#if (CONFIG_EZ_STATIC_ALLOC_STATS == 1U)
+    ezStaticAllocCounters *counters = &list->counters;
+    ezStaticAllocFailure *failure = NULL;
+    uint32_t size_class = 0U;
+
+    if (alloc_addr != NULL)
+    {
+        counters->num_of_malloc++;
+        counters->used_bytes += block_size;
+        if (counters->used_bytes > counters->peak_used_bytes)
+        {
+            counters->peak_used_bytes = counters->used_bytes;
+        }
+        return;
+    }
+
+    while (size_class < EZ_STATIC_ALLOC_NUM_OF_SIZE_CLASSES - 1U
+           && alloc_size > (16U << size_class))
+    {
+        size_class++;
+    }
+    counters->failed_by_class[size_class]++;
+
+    if (counters->failure_trace != NULL)
+    {
+        failure = &counters->failure_trace[counters->num_of_failed % counters->failure_trace_size];
+        failure->size = alloc_size;
+        ezStaticAlloc_GetFreeInfo(list, &failure->free_bytes, &failure->largest_free_block);
+    }
+    counters->num_of_failed++;
+#else
+    (void)list;
+    (void)alloc_size;
+    (void)alloc_addr;
+    (void)block_size;
+#endif
+}
+
+/******************************************************************************
+* Function : ezStaticAlloc_CountFree
+*//**
+* \b Description:
+*
+* This function updates the counters after a free
+*
+* PRE-CONDITION: None
+*
+* POST-CONDITION: None
+*
+* @param    *list           memory list
+* @param    block_size      size of the freed block
+*
+* @return   None
+*
+*******************************************************************************/
+static void ezStaticAlloc_CountFree(struct MemList* list, uint32_t block_size)
+{
+#if (CONFIG_EZ_STATIC_ALLOC_STATS == 1U)
+    list->counters.num_of_free++;
+    list->counters.used_bytes -= block_size;
+#else
+    (void)list;
+    (void)block_size;
+#endif
+}
+
+/******************************************************************************
+* Function : ezStaticAlloc_CountResize
+*//**
+* \b Description:
+*
+* This function updates the counters after a block was resized without a new
+* allocation
+*
+* PRE-CONDITION: None
+*
+* POST-CONDITION: None
+*
+* @param    *list           memory list
+* @param    old_block_size  size of the block before
+* @param    new_block_size  size of the block after
+*
+* @return   None
+*
+*******************************************************************************/
+static void ezStaticAlloc_CountResize(struct MemList* list, uint32_t old_block_size, uint32_t new_block_size)
+{
+#if (CONFIG_EZ_STATIC_ALLOC_STATS == 1U)
+    list->counters.num_of_resized++;
+    list->counters.used_bytes = list->counters.used_bytes - old_block_size + new_block_size;
+    if (list->counters.used_bytes > list->counters.peak_used_bytes)
+    {
+        list->counters.peak_used_bytes = list->counters.used_bytes;
+    }
+#else
+    (void)list;
+    (void)old_block_size;
+    (void)new_block_size;
+#endif
+}
+
+#if (CONFIG_EZ_STATIC_ALLOC_STATS == 1U)
+/******************************************************************************
+* Function : ezStaticAlloc_GetFreeInfo
+*//**
+* \b Description:
+*
+* This function returns the free bytes and the largest free block
+*
+* PRE-CONDITION: None
+*
+* POST-CONDITION: None
+*
+* @param    *list               memory list
+* @param    *free_bytes         bytes in free blocks
+* @param    *largest_free_block size of the largest free block
+*
+* @return   None
+*
+*******************************************************************************/
+static void ezStaticAlloc_GetFreeInfo(struct MemList* list, uint32_t* free_bytes, uint32_t* largest_free_block)
+{
+    struct Node* it_node = NULL;
+
+    if (EZ_STATIC_ALLOC_TLSF == list->backend)
+    {
+        ezStaticAlloc_TlsfGetFreeInfo(list, free_bytes, largest_free_block);
+        return;
+    }
+
+    *free_bytes = 0U;
+    *largest_free_block = 0U;
+    EZ_LINKEDLIST_FOR_EACH(it_node, &list->free_list_head)
+    {
+        *free_bytes += GET_BLOCK(it_node)->buff_size;
+        if (GET_BLOCK(it_node)->buff_size > *largest_free_block)
+        {
+            *largest_free_block = GET_BLOCK(it_node)->buff_size;
+        }
+    }
+}
+#endif /* CONFIG_EZ_STATIC_ALLOC_STATS == 1U */
 #endif /* CONFIG_STCMEM */
 /* End of file */
@@ -0,0 +1,236 @@
+/*****************************************************************************
+* Filename:         ez_static_alloc_cache.c
+* Author:           Hai Nguyen
+* Original Date:    16.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+
+/** @file   ez_static_alloc_cache.c
+ *  @author Hai Nguyen
+ *  @date   16.10.2026
+ *  @brief  Per-task magazine cache of a memory list
+ *
+ *  @details A cache is owned by one task and never locked. Magazine i is a
+ *  stack of free blocks of 16 << i bytes, which stay allocated in the memory
+ *  list while they are cached. Only a miss, an overflow or a flush reaches
+ *  the memory list and takes its lock. An overflow returns half of the
+ *  magazine, so a task alternating around the limit does not take the lock
+ *  on every free.
+ */
+
+/*****************************************************************************
+* Includes
+*****************************************************************************/
+#include "ez_static_alloc.h"
+#include "ez_static_alloc_internal.h"
+
+#if (EZ_STATIC_ALLOC == 1U) && (CONFIG_EZ_STATIC_ALLOC_THREAD_SAFE == 1U)
+#include <stddef.h>
+
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+#define SMALLEST_CLASS_SIZE     16U
+#define LARGEST_CLASS_SIZE      (SMALLEST_CLASS_SIZE << (CONFIG_EZ_STATIC_ALLOC_CACHE_CLASSES - 1U))
+
+
+/*****************************************************************************
+* Component Typedefs
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Component Variable Definitions
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Function Definitions
+*****************************************************************************/
+static uint32_t ezStaticAlloc_GetCacheClass(uint32_t alloc_size);
+static void ezStaticAlloc_ReleaseBlocks(ezStaticAllocCache *cache,
+                                        ezStaticAllocMagazine *magazine,
+                                        uint32_t num_of_blocks);
+
+
+/*****************************************************************************
+* Public functions
+*****************************************************************************/
+bool ezStaticAlloc_InitCache(ezStaticAllocCache *cache, ezmMemList *mem_list)
+{
+    if(cache == NULL || mem_list == NULL || !ezStaticAlloc_IsMemListReady(mem_list))
+    {
+        return false;
+    }
+
+    cache->mem_list = mem_list;
+    cache->num_of_hits = 0U;
+    cache->num_of_misses = 0U;
+    for(uint32_t i = 0; i < CONFIG_EZ_STATIC_ALLOC_CACHE_CLASSES; i++)
+    {
+        cache->magazines[i].count = 0U;
+    }
+
+    return true;
+}
+
+
+void *ezStaticAlloc_CacheMalloc(ezStaticAllocCache *cache, uint32_t alloc_size)
+{
+    ezStaticAllocMagazine *magazine = NULL;
+    uint32_t cache_class = 0U;
+    void *alloc_addr = NULL;
+
+    if(cache == NULL || alloc_size == 0U)
+    {
+        return NULL;
+    }
+
+    if(alloc_size > LARGEST_CLASS_SIZE)
+    {
+        return ezStaticAlloc_Malloc(cache->mem_list, alloc_size);
+    }
+
+    cache_class = ezStaticAlloc_GetCacheClass(alloc_size);
+    magazine = &cache->magazines[cache_class];
+    if(magazine->count > 0U)
+    {
+        cache->num_of_hits++;
+        magazine->count--;
+        return magazine->blocks[magazine->count];
+    }
+
+    cache->num_of_misses++;
+    alloc_addr = ezStaticAlloc_Malloc(cache->mem_list, SMALLEST_CLASS_SIZE << cache_class);
+    if(alloc_addr == NULL)
+    {
+        /* The cached blocks of the other classes may be what is missing */
+        ezStaticAlloc_CacheFlush(cache);
+        alloc_addr = ezStaticAlloc_Malloc(cache->mem_list, SMALLEST_CLASS_SIZE << cache_class);
+    }
+
+    return alloc_addr;
+}
+
+
+bool ezStaticAlloc_CacheFree(ezStaticAllocCache *cache, void *alloc_addr, uint32_t alloc_size)
+{
+    ezStaticAllocMagazine *magazine = NULL;
+
+    if(cache == NULL || alloc_addr == NULL || alloc_size == 0U)
+    {
+        return false;
+    }
+
+    if(alloc_size > LARGEST_CLASS_SIZE)
+    {
+        return ezStaticAlloc_Free(cache->mem_list, alloc_addr);
+    }
+
+    magazine = &cache->magazines[ezStaticAlloc_GetCacheClass(alloc_size)];
+    if(magazine->count >= CONFIG_EZ_STATIC_ALLOC_MAGAZINE_SIZE)
+    {
+        ezStaticAlloc_ReleaseBlocks(cache, magazine, (CONFIG_EZ_STATIC_ALLOC_MAGAZINE_SIZE + 1U) / 2U);
+    }
+
+    magazine->blocks[magazine->count] = alloc_addr;
+    magazine->count++;
+
+    return true;
+}
+
+
+void ezStaticAlloc_CacheFlush(ezStaticAllocCache *cache)
+{
+    if(cache == NULL)
+    {
+        return;
+    }
+
+    ezStaticAlloc_LockList(cache->mem_list);
+    for(uint32_t i = 0; i < CONFIG_EZ_STATIC_ALLOC_CACHE_CLASSES; i++)
+    {
+        while(cache->magazines[i].count > 0U)
+        {
+            cache->magazines[i].count--;
+            (void)ezStaticAlloc_FreeUnlocked(cache->mem_list,
+                                             cache->magazines[i].blocks[cache->magazines[i].count]);
+        }
+    }
+    ezStaticAlloc_UnlockList(cache->mem_list);
+}
+
+
+/*****************************************************************************
+* Local functions
+*****************************************************************************/
+
+/******************************************************************************
+* Function : ezStaticAlloc_GetCacheClass
+*//**
+* @Description: Return the smallest size class holding alloc_size bytes
+*
+* @param    alloc_size: (IN)1 to LARGEST_CLASS_SIZE bytes
+* @return   size class
+*
+*******************************************************************************/
+static uint32_t ezStaticAlloc_GetCacheClass(uint32_t alloc_size)
+{
+    uint32_t cache_class = 0U;
+
+    while((SMALLEST_CLASS_SIZE << cache_class) < alloc_size)
+    {
+        cache_class++;
+    }
+
+    return cache_class;
+}
+
+
+/******************************************************************************
+* Function : ezStaticAlloc_ReleaseBlocks
+*//**
+* @Description: Return the oldest blocks of a magazine to the memory list
+*               under one acquisition of the lock
+*
+* @param    cache: (IN)pointer to the cache
+* @param    magazine: (IN)magazine of the cache
+* @param    num_of_blocks: (IN)number of blocks, at most the blocks in the
+*                          magazine
+* @return   None
+*
+*******************************************************************************/
+static void ezStaticAlloc_ReleaseBlocks(ezStaticAllocCache *cache,
+                                        ezStaticAllocMagazine *magazine,
+                                        uint32_t num_of_blocks)
+{
+    ezStaticAlloc_LockList(cache->mem_list);
+    for(uint32_t i = 0; i < num_of_blocks; i++)
+    {
+        (void)ezStaticAlloc_FreeUnlocked(cache->mem_list, magazine->blocks[i]);
+    }
+    ezStaticAlloc_UnlockList(cache->mem_list);
+
+    /* Keep the most recently freed blocks, they are likely still in the
+     * data cache */
+    for(uint32_t i = num_of_blocks; i < magazine->count; i++)
+    {
+        magazine->blocks[i - num_of_blocks] = magazine->blocks[i];
+    }
+    magazine->count -= num_of_blocks;
+}
+
+#endif /* (EZ_STATIC_ALLOC == 1U) && (CONFIG_EZ_STATIC_ALLOC_THREAD_SAFE == 1U) */
+
+/* End of file */
@@ -0,0 +1,209 @@
+/*****************************************************************************
+* Filename:         ez_static_alloc_heap.c
+* Author:           Hai Nguyen
+* Original Date:    16.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+
+/** @file   ez_static_alloc_heap.c
+ *  @author Hai Nguyen
+ *  @date   16.10.2026
+ *  @brief  Heap spanning several memory lists
+ *
+ *  @details Every region is a memory list managing one memory bank. The
+ *  regions are kept sorted fastest first, so the placement only selects the
+ *  direction in which they are tried. Free finds the region from the address
+ *  range of its buffer.
+ */
+
+/*****************************************************************************
+* Includes
+*****************************************************************************/
+#include "ez_static_alloc.h"
+
+#if (EZ_STATIC_ALLOC == 1U)
+#include <stddef.h>
+
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Component Typedefs
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Component Variable Definitions
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Function Definitions
+*****************************************************************************/
+static bool ezStaticAlloc_IsSlowFirst(ezStaticAllocHeap *heap,
+                                      uint32_t alloc_size,
+                                      ezStaticAllocPlacement placement);
+
+
+/*****************************************************************************
+* Public functions
+*****************************************************************************/
+bool ezStaticAlloc_InitHeap(ezStaticAllocHeap *heap, uint32_t large_threshold)
+{
+    if(heap == NULL)
+    {
+        return false;
+    }
+
+    heap->num_of_regions = 0U;
+    heap->large_threshold = large_threshold;
+
+    return true;
+}
+
+
+bool ezStaticAlloc_AddRegion(ezStaticAllocHeap *heap, ezmMemList *mem_list, uint8_t speed)
+{
+    uint32_t pos = 0U;
+
+    if(heap == NULL || mem_list == NULL
+       || heap->num_of_regions >= CONFIG_EZ_STATIC_ALLOC_MAX_REGIONS
+       || !ezStaticAlloc_IsMemListReady(mem_list))
+    {
+        return false;
+    }
+
+    for(uint32_t i = 0; i < heap->num_of_regions; i++)
+    {
+        if(heap->regions[i].mem_list == mem_list)
+        {
+            return false;
+        }
+    }
+
+    /* Insert behind all regions of the same or a higher speed */
+    pos = heap->num_of_regions;
+    while(pos > 0U && heap->regions[pos - 1U].speed < speed)
+    {
+        heap->regions[pos] = heap->regions[pos - 1U];
+        pos--;
+    }
+
+    heap->regions[pos].mem_list = mem_list;
+    heap->regions[pos].speed = speed;
+    heap->num_of_regions++;
+
+    return true;
+}
+
+
+void *ezStaticAlloc_HeapMalloc(ezStaticAllocHeap *heap,
+                               uint32_t alloc_size,
+                               ezStaticAllocPlacement placement)
+{
+    void *alloc_addr = NULL;
+    uint32_t index = 0U;
+    bool slow_first = false;
+
+    if(heap == NULL || alloc_size == 0U)
+    {
+        return NULL;
+    }
+
+    slow_first = ezStaticAlloc_IsSlowFirst(heap, alloc_size, placement);
+    for(uint32_t i = 0; i < heap->num_of_regions && alloc_addr == NULL; i++)
+    {
+        index = slow_first ? (heap->num_of_regions - 1U - i) : i;
+        alloc_addr = ezStaticAlloc_Malloc(heap->regions[index].mem_list, alloc_size);
+    }
+
+    return alloc_addr;
+}
+
+
+bool ezStaticAlloc_HeapFree(ezStaticAllocHeap *heap, void *alloc_addr)
+{
+    ezmMemList *mem_list = ezStaticAlloc_HeapGetRegion(heap, alloc_addr);
+
+    if(mem_list == NULL)
+    {
+        return false;
+    }
+
+    return ezStaticAlloc_Free(mem_list, alloc_addr);
+}
+
+
+ezmMemList *ezStaticAlloc_HeapGetRegion(ezStaticAllocHeap *heap, void *addr)
+{
+    ezmMemList *mem_list = NULL;
+
+    if(heap == NULL || addr == NULL)
+    {
+        return NULL;
+    }
+
+    for(uint32_t i = 0; i < heap->num_of_regions; i++)
+    {
+        mem_list = heap->regions[i].mem_list;
+        if((uint8_t *)addr >= mem_list->buff
+           && (uint8_t *)addr < mem_list->buff + mem_list->buff_size)
+        {
+            return mem_list;
+        }
+    }
+
+    return NULL;
+}
+
+
+/*****************************************************************************
+* Local functions
+*****************************************************************************/
+
+/******************************************************************************
+* Function : ezStaticAlloc_IsSlowFirst
+*//**
+* @Description: Return the direction in which the regions are tried
+*
+* @param    heap: (IN)pointer to the heap
+* @param    alloc_size: (IN)requested size
+* @param    placement: (IN)placement hint of the caller
+* @return   true: slowest region first, false: fastest region first
+*
+*******************************************************************************/
+static bool ezStaticAlloc_IsSlowFirst(ezStaticAllocHeap *heap,
+                                      uint32_t alloc_size,
+                                      ezStaticAllocPlacement placement)
+{
+    switch(placement)
+    {
+    case EZ_STATIC_ALLOC_SLOW_FIRST:
+        return true;
+
+    case EZ_STATIC_ALLOC_BY_SIZE:
+        return alloc_size >= heap->large_threshold;
+
+    case EZ_STATIC_ALLOC_FAST_FIRST:
+    default:
+        return false;
+    }
+}
+
+#endif /* EZ_STATIC_ALLOC == 1U */
+
+/* End of file */
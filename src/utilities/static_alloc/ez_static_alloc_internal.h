@@ -0,0 +1,70 @@
+/*****************************************************************************
+* Filename:         ez_static_alloc_internal.h
+* Author:           Hai Nguyen
+* Original Date:    16.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+
+/** @file   ez_static_alloc_internal.h
+ *  @author Hai Nguyen
+ *  @date   16.10.2026
+ *  @brief  Functions shared between the source files of the static
+ *          allocator. Not part of the public API
+ *
+ *  @details The core of the memory list (ez_static_alloc.c), the TLSF
+ *  backend (ez_static_alloc_tlsf.c) and the per-task cache
+ *  (ez_static_alloc_cache.c) call each other through these functions.
+ */
+
+#ifndef _EZ_STATIC_ALLOC_INTERNAL_H
+#define _EZ_STATIC_ALLOC_INTERNAL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*****************************************************************************
+* Includes
+*****************************************************************************/
+#include "ez_static_alloc.h"
+
+#if (EZ_STATIC_ALLOC == 1U)
+
+/*****************************************************************************
+* Function Prototypes
+*****************************************************************************/
+
+/* Core of the memory list, see ez_static_alloc.c */
+bool ezStaticAlloc_FreeUnlocked(struct MemList *list, void *alloc_addr);
+#if (CONFIG_EZ_STATIC_ALLOC_THREAD_SAFE == 1U)
+void ezStaticAlloc_LockList(struct MemList *list);
+void ezStaticAlloc_UnlockList(struct MemList *list);
+#endif
+
+/* TLSF backend, see ez_static_alloc_tlsf.c. The caller holds the lock */
+void *ezStaticAlloc_TlsfMalloc(struct MemList *list, uint32_t alloc_size, uint32_t *block_size);
+void *ezStaticAlloc_TlsfMallocAligned(struct MemList *list, uint32_t alloc_size, uint32_t alignment, uint32_t *block_size);
+bool ezStaticAlloc_TlsfFree(struct MemList *list, void *alloc_addr, uint32_t *block_size);
+uint32_t ezStaticAlloc_TlsfGetBlockSize(struct MemList *list, void *alloc_addr);
+void *ezStaticAlloc_TlsfResize(struct MemList *list, void *alloc_addr, uint32_t new_size, uint32_t *block_size);
+void ezStaticAlloc_TlsfGetFreeInfo(struct MemList *list, uint32_t *free_bytes, uint32_t *largest_free_block);
+uint32_t ezStaticAlloc_TlsfGetNumOfAllocBlock(struct MemList *list);
+uint32_t ezStaticAlloc_TlsfGetNumOfFreeBlock(struct MemList *list);
+
+#endif /* EZ_STATIC_ALLOC == 1U */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _EZ_STATIC_ALLOC_INTERNAL_H */
+
+/* End of file */
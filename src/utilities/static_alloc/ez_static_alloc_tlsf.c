@@ -0,0 +1,720 @@
+/*****************************************************************************
+* Filename:         ez_static_alloc_tlsf.c
+* Author:           Hai Nguyen
+* Original Date:    16.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+
+/** @file   ez_static_alloc_tlsf.c
+ *  @author Hai Nguyen
+ *  @date   16.10.2026
+ *  @brief  Two-Level Segregated Fit backend of the static allocation
+ *
+ *  @details Layout of the buffer:
+ *  | control | hdr | payload | hdr | payload | ... | sentinel hdr |
+ *  Free blocks are kept in lists indexed by a first level (power of two
+ *  range) and a second level (linear subdivision of the range). Two bitmaps
+ *  tell which lists are not empty, so a suitable block is found with two
+ *  count-trailing-zeros. Every header links to the previous block in memory
+ *  and flags if the previous block is free, so neighbours are merged
+ *  immediately on free.
+ */
+
+/*****************************************************************************
+* Includes
+*****************************************************************************/
+#include "ez_static_alloc.h"
+#include "ez_static_alloc_internal.h"
+
+#if (EZ_STATIC_ALLOC == 1U)
+#include <stddef.h>
+#include <string.h>
+
+
+/*****************************************************************************
+* Component Preprocessor Macros
+*****************************************************************************/
+#define ALIGN_SIZE      sizeof(void*)
+#define ALIGN_LOG2      ((sizeof(void*) == 8U) ? 3U : 2U)
+#define SL_LOG2         CONFIG_EZ_STATIC_ALLOC_TLSF_SL_LOG2
+#define SL_COUNT        (1U << SL_LOG2)
+#define FL_SHIFT        (SL_LOG2 + ALIGN_LOG2)
+#define SMALL_SIZE      (1U << FL_SHIFT)    /**< sizes below are in first level 0 */
+
+#define BLOCK_FREE      0x1U                /**< flag: block is free */
+#define BLOCK_PREV_FREE 0x2U                /**< flag: previous block is free */
+#define BLOCK_FLAGS     (BLOCK_FREE | BLOCK_PREV_FREE)
+
+#define MAX_BUFF_SIZE   0x80000000U         /**< 2 GiB, keeps the size mapping in 32 bits */
+
+#define HDR_SIZE        offsetof(TlsfBlock, next_free)
+#define MIN_PAYLOAD     (sizeof(TlsfBlock) - HDR_SIZE)
+
+#define GET_CONTROL(list)   ((TlsfControl*)(void*)(list)->buff)
+#define SIZE_OF(block)      ((block)->size & ~(size_t)BLOCK_FLAGS)
+#define PAYLOAD_OF(block)   ((uint8_t*)(block) + HDR_SIZE)
+
+
+/*****************************************************************************
+* Component Typedefs
+*****************************************************************************/
+
+/** @brief Header of a block. The free list links only exist in free blocks
+ *  and overlay the payload
+ */
+typedef struct TlsfBlock
+{
+    struct TlsfBlock *prev_phys;    /**< previous block in memory */
+    size_t size;                    /**< payload size and flags */
+    struct TlsfBlock *next_free;    /**< next block in the same free list */
+    struct TlsfBlock *prev_free;    /**< previous block in the same free list */
+}TlsfBlock;
+
+
+/** @brief Control structure at the beginning of the buffer
+ */
+typedef struct
+{
+    uint32_t fl_bitmap;     /**< bit set if a first level has free blocks */
+    uint32_t fl_count;      /**< number of first levels */
+    uint32_t *sl_bitmap;    /**< bit set if a second level list is not empty */
+    TlsfBlock **heads;      /**< heads of the free lists, fl_count * SL_COUNT */
+    TlsfBlock *first;       /**< first block in memory */
+    TlsfBlock *sentinel;    /**< zero sized used block at the end */
+    uint32_t free_bytes;    /**< sum of the payload sizes of the free blocks */
+    uint32_t num_of_alloc;  /**< number of allocated blocks */
+    uint32_t num_of_free;   /**< number of free blocks */
+}TlsfControl;
+
+
+/*****************************************************************************
+* Component Variable Definitions
+*****************************************************************************/
+/* None */
+
+
+/*****************************************************************************
+* Function Definitions
+*****************************************************************************/
+static uint32_t ezStaticAlloc_TlsfFls(uint32_t value);
+static uint32_t ezStaticAlloc_TlsfFfs(uint32_t value);
+static void ezStaticAlloc_TlsfMapping(size_t size, uint32_t *fl, uint32_t *sl);
+static TlsfBlock *ezStaticAlloc_TlsfNextPhys(TlsfBlock *block);
+static void ezStaticAlloc_TlsfInsert(TlsfControl *control, TlsfBlock *block);
+static void ezStaticAlloc_TlsfRemove(TlsfControl *control, TlsfBlock *block);
+static TlsfBlock *ezStaticAlloc_TlsfSplitUsed(TlsfControl *control, TlsfBlock *block, size_t size);
+static TlsfBlock *ezStaticAlloc_TlsfGetUsedBlock(TlsfControl *control, void *alloc_addr);
+static void ezStaticAlloc_TlsfTrimUsed(struct MemList *list, TlsfBlock *block, size_t size);
+
+
+/*****************************************************************************
+* Public functions
+*****************************************************************************/
+bool ezStaticAlloc_InitMemListTlsf(ezmMemList* mem_list, void* buff, uint32_t buff_size)
+{
+    TlsfControl *control = NULL;
+    uint8_t *heap = NULL;
+    uintptr_t start = 0U;
+    uintptr_t end = 0U;
+    size_t control_size = 0U;
+    uint32_t fl = 0U;
+    uint32_t sl = 0U;
+
+    if (mem_list == NULL || buff == NULL
+        || buff_size > EZ_STATIC_ALLOC_MAX_SIZE || buff_size > MAX_BUFF_SIZE)
+    {
+        return false;
+    }
+
+    start = ((uintptr_t)buff + ALIGN_SIZE - 1U) & ~(uintptr_t)(ALIGN_SIZE - 1U);
+    end = ((uintptr_t)buff + buff_size) & ~(uintptr_t)(ALIGN_SIZE - 1U);
+
+    /* The largest block is smaller than the buffer, it bounds the levels */
+    ezStaticAlloc_TlsfMapping(buff_size, &fl, &sl);
+    control_size = sizeof(TlsfControl)
+                 + ((fl + 1U) * SL_COUNT * sizeof(TlsfBlock*))
+                 + ((fl + 1U) * sizeof(uint32_t));
+    control_size = (control_size + ALIGN_SIZE - 1U) & ~(size_t)(ALIGN_SIZE - 1U);
+
+    if (end < start
+        || (size_t)(end - start) < control_size + (2U * HDR_SIZE) + MIN_PAYLOAD)
+    {
+        return false;
+    }
+
+    control = (TlsfControl*)start;
+    memset(control, 0, control_size);
+    control->fl_count = fl + 1U;
+    control->heads = (TlsfBlock**)(void*)(control + 1);
+    control->sl_bitmap = (uint32_t*)(void*)(control->heads + (control->fl_count * SL_COUNT));
+
+    heap = (uint8_t*)start + control_size;
+    control->first = (TlsfBlock*)(void*)heap;
+    control->first->prev_phys = NULL;
+    control->first->size = ((size_t)((uint8_t*)end - heap) - (2U * HDR_SIZE)) | BLOCK_FREE;
+
+    control->sentinel = ezStaticAlloc_TlsfNextPhys(control->first);
+    control->sentinel->prev_phys = control->first;
+    control->sentinel->size = BLOCK_PREV_FREE;
+
+    ezStaticAlloc_TlsfInsert(control, control->first);
+
+    mem_list->buff = (uint8_t*)start;
+    mem_list->buff_size = (ezStaticAllocSize_t)(end - start);
+    mem_list->unused_blocks = NULL;
+    mem_list->is_shared_pool = false;
+    mem_list->backend = EZ_STATIC_ALLOC_TLSF;
+#if (CONFIG_EZ_STATIC_ALLOC_THREAD_SAFE == 1U)
+    mem_list->lock = NULL;
+#endif
+#if (CONFIG_EZ_STATIC_ALLOC_STATS == 1U)
+    memset(&mem_list->counters, 0, sizeof(mem_list->counters));
+#endif
+    ezLinkedList_InitNode(&mem_list->alloc_list_head);
+    ezLinkedList_InitNode(&mem_list->free_list_head);
+
+    return true;
+}
+
+
+void *ezStaticAlloc_TlsfMalloc(struct MemList *list, uint32_t alloc_size, uint32_t *block_size)
+{
+    TlsfControl *control = GET_CONTROL(list);
+    TlsfBlock *block = NULL;
+    TlsfBlock *remain = NULL;
+    size_t size = ((size_t)alloc_size + ALIGN_SIZE - 1U) & ~(size_t)(ALIGN_SIZE - 1U);
+    size_t search_size = 0U;
+    uint32_t fl = 0U;
+    uint32_t sl = 0U;
+    uint32_t map = 0U;
+
+    if (size < MIN_PAYLOAD)
+    {
+        size = MIN_PAYLOAD;
+    }
+
+    /* Round up to the next list so that any block found there is big enough */
+    search_size = size;
+    if (search_size >= SMALL_SIZE)
+    {
+        search_size += ((size_t)1U << (ezStaticAlloc_TlsfFls((uint32_t)search_size) - SL_LOG2)) - 1U;
+    }
+
+    ezStaticAlloc_TlsfMapping(search_size, &fl, &sl);
+    if (fl >= control->fl_count)
+    {
+        return NULL;
+    }
+
+    map = control->sl_bitmap[fl] & (~0U << sl);
+    if (map == 0U)
+    {
+        map = control->fl_bitmap & (~0U << (fl + 1U));
+        if (map == 0U)
+        {
+            return NULL;
+        }
+
+        fl = ezStaticAlloc_TlsfFfs(map);
+        map = control->sl_bitmap[fl];
+    }
+    sl = ezStaticAlloc_TlsfFfs(map);
+
+    block = control->heads[(fl * SL_COUNT) + sl];
+    ezStaticAlloc_TlsfRemove(control, block);
+
+    if (SIZE_OF(block) >= size + HDR_SIZE + MIN_PAYLOAD)
+    {
+        remain = (TlsfBlock*)(void*)(PAYLOAD_OF(block) + size);
+        remain->prev_phys = block;
+        remain->size = (SIZE_OF(block) - size - HDR_SIZE) | BLOCK_FREE;
+        ezStaticAlloc_TlsfNextPhys(remain)->prev_phys = remain;
+        block->size = size | (block->size & BLOCK_PREV_FREE);
+        ezStaticAlloc_TlsfInsert(control, remain);
+    }
+    else
+    {
+        ezStaticAlloc_TlsfNextPhys(block)->size &= ~(size_t)BLOCK_PREV_FREE;
+    }
+
+    block->size &= ~(size_t)BLOCK_FREE;
+    control->num_of_alloc++;
+    *block_size = (uint32_t)SIZE_OF(block);
+
+    return PAYLOAD_OF(block);
+}
+
+
+void *ezStaticAlloc_TlsfMallocAligned(struct MemList *list, uint32_t alloc_size, uint32_t alignment, uint32_t *block_size)
+{
+    TlsfControl *control = GET_CONTROL(list);
+    TlsfBlock *block = NULL;
+    TlsfBlock *aligned_block = NULL;
+    uint8_t *payload = NULL;
+    size_t size = ((size_t)alloc_size + ALIGN_SIZE - 1U) & ~(size_t)(ALIGN_SIZE - 1U);
+    size_t gap = 0U;
+    uint32_t unused_size = 0U;
+
+    if (alignment <= ALIGN_SIZE)
+    {
+        return ezStaticAlloc_TlsfMalloc(list, alloc_size, block_size);
+    }
+
+    /* The split tail below must leave a block of at least MIN_PAYLOAD */
+    if (size < MIN_PAYLOAD)
+    {
+        size = MIN_PAYLOAD;
+    }
+
+    /* Room for the worst case gap, which must hold a free block or be 0 */
+    payload = (uint8_t*)ezStaticAlloc_TlsfMalloc(list,
+                                                 (uint32_t)(size + alignment + HDR_SIZE + MIN_PAYLOAD),
+                                                 &unused_size);
+    if (payload == NULL)
+    {
+        return NULL;
+    }
+
+    block = (TlsfBlock*)(void*)(payload - HDR_SIZE);
+    gap = (size_t)((alignment - ((uintptr_t)payload % alignment)) % alignment);
+    while (gap != 0U && gap < HDR_SIZE + MIN_PAYLOAD)
+    {
+        gap += alignment;
+    }
+
+    aligned_block = block;
+    if (gap != 0U)
+    {
+        /* Give the gap in front back as a free block */
+        aligned_block = ezStaticAlloc_TlsfSplitUsed(control, block, gap - HDR_SIZE);
+        (void)ezStaticAlloc_TlsfFree(list, PAYLOAD_OF(block), &unused_size);
+    }
+
+    if (SIZE_OF(aligned_block) >= size + HDR_SIZE + MIN_PAYLOAD)
+    {
+        block = ezStaticAlloc_TlsfSplitUsed(control, aligned_block, size);
+        (void)ezStaticAlloc_TlsfFree(list, PAYLOAD_OF(block), &unused_size);
+    }
+
+    *block_size = (uint32_t)SIZE_OF(aligned_block);
+    return PAYLOAD_OF(aligned_block);
+}
+
+
+bool ezStaticAlloc_TlsfFree(struct MemList *list, void *alloc_addr, uint32_t *block_size)
+{
+    TlsfControl *control = GET_CONTROL(list);
+    TlsfBlock *block = ezStaticAlloc_TlsfGetUsedBlock(control, alloc_addr);
+    TlsfBlock *neighbour = NULL;
+
+    if (block == NULL)
+    {
+        return false;
+    }
+
+    block->size |= BLOCK_FREE;
+    control->num_of_alloc--;
+    *block_size = (uint32_t)SIZE_OF(block);
+
+    if ((block->size & BLOCK_PREV_FREE) != 0U)
+    {
+        neighbour = block->prev_phys;
+        ezStaticAlloc_TlsfRemove(control, neighbour);
+        neighbour->size += HDR_SIZE + SIZE_OF(block);
+        block = neighbour;
+    }
+
+    neighbour = ezStaticAlloc_TlsfNextPhys(block);
+    if ((neighbour->size & BLOCK_FREE) != 0U)
+    {
+        ezStaticAlloc_TlsfRemove(control, neighbour);
+        block->size += HDR_SIZE + SIZE_OF(neighbour);
+    }
+
+    neighbour = ezStaticAlloc_TlsfNextPhys(block);
+    neighbour->prev_phys = block;
+    neighbour->size |= BLOCK_PREV_FREE;
+    ezStaticAlloc_TlsfInsert(control, block);
+
+    return true;
+}
+
+
+uint32_t ezStaticAlloc_TlsfGetBlockSize(struct MemList *list, void *alloc_addr)
+{
+    TlsfBlock *block = ezStaticAlloc_TlsfGetUsedBlock(GET_CONTROL(list), alloc_addr);
+
+    return (block != NULL) ? (uint32_t)SIZE_OF(block) : 0U;
+}
+
+
+void *ezStaticAlloc_TlsfResize(struct MemList *list, void *alloc_addr, uint32_t new_size, uint32_t *block_size)
+{
+    TlsfControl *control = GET_CONTROL(list);
+    TlsfBlock *block = (TlsfBlock*)(void*)((uint8_t*)alloc_addr - HDR_SIZE);
+    TlsfBlock *prev = NULL;
+    TlsfBlock *next = ezStaticAlloc_TlsfNextPhys(block);
+    size_t size = ((size_t)new_size + ALIGN_SIZE - 1U) & ~(size_t)(ALIGN_SIZE - 1U);
+    size_t next_size = 0U;
+
+    if (size < MIN_PAYLOAD)
+    {
+        size = MIN_PAYLOAD;
+    }
+
+    if ((next->size & BLOCK_FREE) != 0U)
+    {
+        next_size = HDR_SIZE + SIZE_OF(next);
+    }
+
+    if (size <= SIZE_OF(block) + next_size)
+    {
+        /* Shrink, or grow into the next block. The payload stays in place */
+        if (size > SIZE_OF(block))
+        {
+            ezStaticAlloc_TlsfRemove(control, next);
+            block->size += next_size;
+            next = ezStaticAlloc_TlsfNextPhys(block);
+            next->prev_phys = block;
+            next->size &= ~(size_t)BLOCK_PREV_FREE;
+        }
+    }
+    else if ((block->size & BLOCK_PREV_FREE) != 0U
+             && size <= HDR_SIZE + SIZE_OF(block->prev_phys) + SIZE_OF(block) + next_size)
+    {
+        /* Grow into the previous block, the payload moves down */
+        prev = block->prev_phys;
+        ezStaticAlloc_TlsfRemove(control, prev);
+        if (next_size != 0U)
+        {
+            ezStaticAlloc_TlsfRemove(control, next);
+        }
+
+        /* The header of the block is overwritten by the move */
+        prev->size = (HDR_SIZE + SIZE_OF(prev) + SIZE_OF(block) + next_size) | (prev->size & BLOCK_PREV_FREE);
+        memmove(PAYLOAD_OF(prev), PAYLOAD_OF(block), SIZE_OF(block));
+        block = prev;
+        next = ezStaticAlloc_TlsfNextPhys(block);
+        next->prev_phys = block;
+        next->size &= ~(size_t)BLOCK_PREV_FREE;
+    }
+    else
+    {
+        return NULL;
+    }
+
+    ezStaticAlloc_TlsfTrimUsed(list, block, size);
+    *block_size = (uint32_t)SIZE_OF(block);
+
+    return PAYLOAD_OF(block);
+}
+
+
+void ezStaticAlloc_TlsfGetFreeInfo(struct MemList *list, uint32_t *free_bytes, uint32_t *largest_free_block)
+{
+    TlsfControl *control = GET_CONTROL(list);
+    TlsfBlock *block = NULL;
+    uint32_t fl = 0U;
+    uint32_t sl = 0U;
+
+    *free_bytes = control->free_bytes;
+    *largest_free_block = 0U;
+
+    if (control->fl_bitmap != 0U)
+    {
+        /* The largest block is in the highest non empty list */
+        fl = ezStaticAlloc_TlsfFls(control->fl_bitmap);
+        sl = ezStaticAlloc_TlsfFls(control->sl_bitmap[fl]);
+        for (block = control->heads[(fl * SL_COUNT) + sl]; block != NULL; block = block->next_free)
+        {
+            if (SIZE_OF(block) > *largest_free_block)
+            {
+                *largest_free_block = (uint32_t)SIZE_OF(block);
+            }
+        }
+    }
+}
+
+
+uint32_t ezStaticAlloc_TlsfGetNumOfAllocBlock(struct MemList *list)
+{
+    return GET_CONTROL(list)->num_of_alloc;
+}
+
+
+uint32_t ezStaticAlloc_TlsfGetNumOfFreeBlock(struct MemList *list)
+{
+    return GET_CONTROL(list)->num_of_free;
+}
+
+
+/*****************************************************************************
+* Local functions
+*****************************************************************************/
+
+/******************************************************************************
+* Function : ezStaticAlloc_TlsfFls
+*//**
+* @Description: Return the index of the most significant set bit
+*
+* @param    value: (IN)value, must not be 0
+* @return   bit index
+*
+*******************************************************************************/
+static uint32_t ezStaticAlloc_TlsfFls(uint32_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return 31U - (uint32_t)__builtin_clz(value);
+#else
+    uint32_t index = 0U;
+    while (value > 1U)
+    {
+        value >>= 1U;
+        index++;
+    }
+    return index;
+#endif
+}
+
+
+/******************************************************************************
+* Function : ezStaticAlloc_TlsfFfs
+*//**
+* @Description: Return the index of the least significant set bit
+*
+* @param    value: (IN)value, must not be 0
+* @return   bit index
+*
+*******************************************************************************/
+static uint32_t ezStaticAlloc_TlsfFfs(uint32_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return (uint32_t)__builtin_ctz(value);
+#else
+    uint32_t index = 0U;
+    while ((value & 1U) == 0U)
+    {
+        value >>= 1U;
+        index++;
+    }
+    return index;
+#endif
+}
+
+
+/******************************************************************************
+* Function : ezStaticAlloc_TlsfMapping
+*//**
+* @Description: Return the free list of a block size
+*
+* @param    size: (IN)payload size
+* @param    fl: (OUT)first level index
+* @param    sl: (OUT)second level index
+* @return   None
+*
+*******************************************************************************/
+static void ezStaticAlloc_TlsfMapping(size_t size, uint32_t *fl, uint32_t *sl)
+{
+    uint32_t msb = 0U;
+
+    if (size < SMALL_SIZE)
+    {
+        *fl = 0U;
+        *sl = (uint32_t)size >> ALIGN_LOG2;
+    }
+    else
+    {
+        msb = ezStaticAlloc_TlsfFls((uint32_t)size);
+        *fl = msb - FL_SHIFT + 1U;
+        *sl = ((uint32_t)size >> (msb - SL_LOG2)) - SL_COUNT;
+    }
+}
+
+
+/******************************************************************************
+* Function : ezStaticAlloc_TlsfNextPhys
+*//**
+* @Description: Return the next block in memory
+*
+* @param    block: (IN)block, must not be the sentinel
+* @return   next block
+*
+*******************************************************************************/
+static TlsfBlock *ezStaticAlloc_TlsfNextPhys(TlsfBlock *block)
+{
+    return (TlsfBlock*)(void*)(PAYLOAD_OF(block) + SIZE_OF(block));
+}
+
+
+/******************************************************************************
+* Function : ezStaticAlloc_TlsfInsert
+*//**
+* @Description: Push a free block to the head of its free list
+*
+* @param    control: (IN)control structure
+* @param    block: (IN)free block
+* @return   None
+*
+*******************************************************************************/
+static void ezStaticAlloc_TlsfInsert(TlsfControl *control, TlsfBlock *block)
+{
+    uint32_t fl = 0U;
+    uint32_t sl = 0U;
+    TlsfBlock **head = NULL;
+
+    ezStaticAlloc_TlsfMapping(SIZE_OF(block), &fl, &sl);
+    head = &control->heads[(fl * SL_COUNT) + sl];
+
+    block->prev_free = NULL;
+    block->next_free = *head;
+    if (*head != NULL)
+    {
+        (*head)->prev_free = block;
+    }
+    *head = block;
+
+    control->sl_bitmap[fl] |= (1U << sl);
+    control->fl_bitmap |= (1U << fl);
+    control->free_bytes += (uint32_t)SIZE_OF(block);
+    control->num_of_free++;
+}
+
+
+/******************************************************************************
+* Function : ezStaticAlloc_TlsfRemove
+*//**
+* @Description: Unlink a free block from its free list
+*
+* @param    control: (IN)control structure
+* @param    block: (IN)free block
+* @return   None
+*
+*******************************************************************************/
+static void ezStaticAlloc_TlsfRemove(TlsfControl *control, TlsfBlock *block)
+{
+    uint32_t fl = 0U;
+    uint32_t sl = 0U;
+    TlsfBlock **head = NULL;
+
+    ezStaticAlloc_TlsfMapping(SIZE_OF(block), &fl, &sl);
+    head = &control->heads[(fl * SL_COUNT) + sl];
+
+    if (block->next_free != NULL)
+    {
+        block->next_free->prev_free = block->prev_free;
+    }
+
+    if (block->prev_free != NULL)
+    {
+        block->prev_free->next_free = block->next_free;
+    }
+    else
+    {
+        *head = block->next_free;
+        if (*head == NULL)
+        {
+            control->sl_bitmap[fl] &= ~(1U << sl);
+            if (control->sl_bitmap[fl] == 0U)
+            {
+                control->fl_bitmap &= ~(1U << fl);
+            }
+        }
+    }
+
+    control->free_bytes -= (uint32_t)SIZE_OF(block);
+    control->num_of_free--;
+}
+
+
+/******************************************************************************
+* Function : ezStaticAlloc_TlsfSplitUsed
+*//**
+* @Description: Split an allocated block into an allocated block of the given
+*               payload size and an allocated remainder, which the caller
+*               normally frees to merge it with its free neighbour
+*
+* @param    control: (IN)control structure
+* @param    block: (IN)allocated block, at least size + HDR_SIZE + MIN_PAYLOAD
+* @param    size: (IN)payload size of the first part, aligned
+* @return   remainder
+*
+*******************************************************************************/
+static TlsfBlock *ezStaticAlloc_TlsfSplitUsed(TlsfControl *control, TlsfBlock *block, size_t size)
+{
+    TlsfBlock *remain = (TlsfBlock*)(void*)(PAYLOAD_OF(block) + size);
+
+    remain->prev_phys = block;
+    remain->size = SIZE_OF(block) - size - HDR_SIZE;
+    ezStaticAlloc_TlsfNextPhys(remain)->prev_phys = remain;
+    block->size = size | (block->size & BLOCK_PREV_FREE);
+    control->num_of_alloc++;
+
+    return remain;
+}
+
+
+/******************************************************************************
+* Function : ezStaticAlloc_TlsfGetUsedBlock
+*//**
+* @Description: Return the header of an allocated block
+*
+* @param    control: (IN)control structure
+* @param    alloc_addr: (IN)address returned by an allocation
+* @return   header, NULL if alloc_addr is not an allocated block of the buffer
+*
+*******************************************************************************/
+static TlsfBlock *ezStaticAlloc_TlsfGetUsedBlock(TlsfControl *control, void *alloc_addr)
+{
+    TlsfBlock *block = NULL;
+
+    if ((uint8_t*)alloc_addr < PAYLOAD_OF(control->first)
+        || (uint8_t*)alloc_addr >= (uint8_t*)control->sentinel
+        || ((uintptr_t)alloc_addr & (ALIGN_SIZE - 1U)) != 0U)
+    {
+        return NULL;
+    }
+
+    block = (TlsfBlock*)(void*)((uint8_t*)alloc_addr - HDR_SIZE);
+    if ((block->size & BLOCK_FREE) != 0U)
+    {
+        return NULL;
+    }
+
+    return block;
+}
+
+
+/******************************************************************************
+* Function : ezStaticAlloc_TlsfTrimUsed
+*//**
+* @Description: Give the tail of an allocated block back to the free lists if
+*               it can hold a free block
+*
+* @param    list: (IN)memory list
+* @param    block: (IN)allocated block
+* @param    size: (IN)payload size to keep, aligned, at least MIN_PAYLOAD
+* @return   None
+*
+*******************************************************************************/
+static void ezStaticAlloc_TlsfTrimUsed(struct MemList *list, TlsfBlock *block, size_t size)
+{
+    TlsfBlock *remain = NULL;
+    uint32_t unused_size = 0U;
+
+    if (SIZE_OF(block) >= size + HDR_SIZE + MIN_PAYLOAD)
+    {
+        remain = ezStaticAlloc_TlsfSplitUsed(GET_CONTROL(list), block, size);
+        (void)ezStaticAlloc_TlsfFree(list, PAYLOAD_OF(remain), &unused_size);
+    }
+}
+
+#endif /* EZ_STATIC_ALLOC == 1U */
+/* End of file */
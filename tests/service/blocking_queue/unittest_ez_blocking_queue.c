@@ -0,0 +1,501 @@
+/*****************************************************************************
+* Filename:         unittest_ez_blocking_queue.c
+* Author:           Hai Nguyen
+* Original Date:    16.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   unittest_ez_blocking_queue.c
+ *  @author Hai Nguyen
+ *  @date   16.10.2026
+ *  @brief  Unit tests of the blocking queue component
+ *
+ *  @details The OSAL is ported to pthreads in this file, one tick is one
+ *  millisecond. Events are cleared when a wait returns, as in FreeRTOS.
+ */
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <pthread.h>
+#include "unity.h"
+#include "unity_fixture.h"
+#include "ez_blocking_queue.h"
+
+TEST_GROUP(ez_blocking_queue);
+
+/******************************************************************************
+* Module Preprocessor Macros
+*******************************************************************************/
+#define BUFF_SIZE           512U
+#define CAPACITY            4U
+#define NUM_OF_MESSAGES     1000U
+#define WAIT_FOREVER        0xFFFFFFFFU
+
+
+/******************************************************************************
+* Module Typedefs
+*******************************************************************************/
+typedef struct
+{
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    uint32_t count;
+    uint32_t max_count;
+}PosixSemaphore;
+
+typedef struct
+{
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    uint32_t bits;
+}PosixEvent;
+
+
+/******************************************************************************
+* Module Variable Definitions
+*******************************************************************************/
+static uint8_t buff[BUFF_SIZE];
+static ezBlockingQueue queue;
+static EZ_OSAL_DEFINE_SEMAPHORE_HANDLE(lock, 1, NULL);
+static EZ_OSAL_DEFINE_EVENT_HANDLE(event, NULL);
+static uint32_t received_sum = 0U;
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+static void RunAllTests(void);
+static void *Consumer(void *arg);
+static void GetDeadline(struct timespec *deadline, uint32_t timeout_ticks);
+static bool WaitCond(pthread_cond_t *cond, pthread_mutex_t *mutex,
+                     const struct timespec *deadline, uint32_t timeout_ticks);
+static unsigned long Posix_TaskGetTickCount(void);
+static ezSTATUS Posix_SemaphoreCreate(ezOsal_SemaphoreHandle_t *handle);
+static ezSTATUS Posix_SemaphoreDelete(ezOsal_SemaphoreHandle_t *handle);
+static ezSTATUS Posix_SemaphoreTake(ezOsal_SemaphoreHandle_t *handle, uint32_t timeout_ticks);
+static ezSTATUS Posix_SemaphoreGive(ezOsal_SemaphoreHandle_t *handle);
+static ezSTATUS Posix_EventCreate(ezOsal_EventHandle_t *handle);
+static ezSTATUS Posix_EventDelete(ezOsal_EventHandle_t *handle);
+static int Posix_EventWait(ezOsal_EventHandle_t *handle, uint32_t event_mask, uint32_t timeout_ticks);
+static ezSTATUS Posix_EventSet(ezOsal_EventHandle_t *handle, uint32_t event_mask);
+static ezSTATUS Posix_EventClear(ezOsal_EventHandle_t *handle, uint32_t event_mask);
+
+static const ezOsal_Interfaces_t posix_interface = {
+    .TaskGetTickCount = Posix_TaskGetTickCount,
+    .SemaphoreCreate = Posix_SemaphoreCreate,
+    .SemaphoreDelete = Posix_SemaphoreDelete,
+    .SemaphoreTake = Posix_SemaphoreTake,
+    .SemaphoreGive = Posix_SemaphoreGive,
+    .EventCreate = Posix_EventCreate,
+    .EventDelete = Posix_EventDelete,
+    .EventWait = Posix_EventWait,
+    .EventSet = Posix_EventSet,
+    .EventClear = Posix_EventClear,
+};
+
+
+/******************************************************************************
+* External functions
+*******************************************************************************/
+int main(int argc, const char *argv[])
+{
+    return UnityMain(argc, argv, RunAllTests);
+}
+
+
+TEST_SETUP(ez_blocking_queue)
+{
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezOsal_SetInterface(&posix_interface));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezBlockingQueue_Create(&queue, buff, BUFF_SIZE,
+                                                        CAPACITY, &lock, &event));
+}
+
+
+TEST_TEAR_DOWN(ez_blocking_queue)
+{
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezBlockingQueue_Delete(&queue));
+}
+
+
+TEST_GROUP_RUNNER(ez_blocking_queue)
+{
+    RUN_TEST_CASE(ez_blocking_queue, InvalidArguments);
+    RUN_TEST_CASE(ez_blocking_queue, PopEmptyTimeout);
+    RUN_TEST_CASE(ez_blocking_queue, PushPopInOrder);
+    RUN_TEST_CASE(ez_blocking_queue, PopBufferTooSmall);
+    RUN_TEST_CASE(ez_blocking_queue, PushFullTimeout);
+    RUN_TEST_CASE(ez_blocking_queue, PushTooLarge);
+    RUN_TEST_CASE(ez_blocking_queue, ProducerConsumer);
+}
+
+
+TEST(ez_blocking_queue, InvalidArguments)
+{
+    uint32_t value = 0U;
+    uint32_t size = sizeof(value);
+
+    TEST_ASSERT_EQUAL(ezSTATUS_ARG_INVALID, ezBlockingQueue_Create(NULL, buff, BUFF_SIZE,
+                                                                   CAPACITY, &lock, &event));
+    TEST_ASSERT_EQUAL(ezSTATUS_ARG_INVALID, ezBlockingQueue_Create(&queue, buff, BUFF_SIZE,
+                                                                   CAPACITY, NULL, &event));
+    TEST_ASSERT_EQUAL(ezSTATUS_ARG_INVALID, ezBlockingQueue_PushTimeout(&queue, NULL, 4U, 0U));
+    TEST_ASSERT_EQUAL(ezSTATUS_ARG_INVALID, ezBlockingQueue_PushTimeout(&queue, &value, 0U, 0U));
+    TEST_ASSERT_EQUAL(ezSTATUS_ARG_INVALID, ezBlockingQueue_PopTimeout(&queue, &value, NULL, 0U));
+    TEST_ASSERT_EQUAL(ezSTATUS_ARG_INVALID, ezBlockingQueue_PopTimeout(NULL, &value, &size, 0U));
+    TEST_ASSERT_EQUAL(0U, ezBlockingQueue_GetNumOfElement(NULL));
+}
+
+
+TEST(ez_blocking_queue, PopEmptyTimeout)
+{
+    uint32_t value = 0U;
+    uint32_t size = sizeof(value);
+    unsigned long start = 0U;
+
+    TEST_ASSERT_EQUAL(ezSTATUS_TIMEOUT,
+                      ezBlockingQueue_PopTimeout(&queue, &value, &size, EZ_BLOCKING_QUEUE_NO_WAIT));
+
+    start = Posix_TaskGetTickCount();
+    TEST_ASSERT_EQUAL(ezSTATUS_TIMEOUT, ezBlockingQueue_PopTimeout(&queue, &value, &size, 20U));
+    TEST_ASSERT_TRUE(Posix_TaskGetTickCount() - start >= 20U);
+    TEST_ASSERT_EQUAL(sizeof(value), size);
+}
+
+
+TEST(ez_blocking_queue, PushPopInOrder)
+{
+    uint32_t value = 0U;
+    uint32_t size = 0U;
+
+    for(uint32_t i = 0; i < CAPACITY; i++)
+    {
+        value = 100U + i;
+        TEST_ASSERT_EQUAL(ezSUCCESS, ezBlockingQueue_PushTimeout(&queue, &value, sizeof(value),
+                                                                 EZ_BLOCKING_QUEUE_NO_WAIT));
+    }
+    TEST_ASSERT_EQUAL(CAPACITY, ezBlockingQueue_GetNumOfElement(&queue));
+
+    for(uint32_t i = 0; i < CAPACITY; i++)
+    {
+        size = sizeof(value);
+        TEST_ASSERT_EQUAL(ezSUCCESS, ezBlockingQueue_PopTimeout(&queue, &value, &size,
+                                                                EZ_BLOCKING_QUEUE_NO_WAIT));
+        TEST_ASSERT_EQUAL(sizeof(value), size);
+        TEST_ASSERT_EQUAL_UINT32(100U + i, value);
+    }
+    TEST_ASSERT_EQUAL(0U, ezBlockingQueue_GetNumOfElement(&queue));
+}
+
+
+TEST(ez_blocking_queue, PopBufferTooSmall)
+{
+    uint8_t data[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    uint8_t out[8] = { 0 };
+    uint32_t size = 4U;
+
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezBlockingQueue_PushTimeout(&queue, data, sizeof(data), 0U));
+
+    TEST_ASSERT_EQUAL(ezSTATUS_ARG_INVALID, ezBlockingQueue_PopTimeout(&queue, out, &size, 0U));
+    TEST_ASSERT_EQUAL(sizeof(data), size);
+    TEST_ASSERT_EQUAL(1U, ezBlockingQueue_GetNumOfElement(&queue));
+
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezBlockingQueue_PopTimeout(&queue, out, &size, 0U));
+    TEST_ASSERT_EQUAL_MEMORY(data, out, sizeof(data));
+}
+
+
+TEST(ez_blocking_queue, PushFullTimeout)
+{
+    uint32_t value = 0U;
+    uint32_t size = sizeof(value);
+
+    for(uint32_t i = 0; i < CAPACITY; i++)
+    {
+        TEST_ASSERT_EQUAL(ezSUCCESS, ezBlockingQueue_PushTimeout(&queue, &value, sizeof(value), 0U));
+    }
+
+    TEST_ASSERT_EQUAL(ezSTATUS_TIMEOUT, ezBlockingQueue_PushTimeout(&queue, &value, sizeof(value),
+                                                                    EZ_BLOCKING_QUEUE_NO_WAIT));
+    TEST_ASSERT_EQUAL(ezSTATUS_TIMEOUT, ezBlockingQueue_PushTimeout(&queue, &value, sizeof(value), 10U));
+    TEST_ASSERT_EQUAL(CAPACITY, ezBlockingQueue_GetNumOfElement(&queue));
+
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezBlockingQueue_PopTimeout(&queue, &value, &size, 0U));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezBlockingQueue_PushTimeout(&queue, &value, sizeof(value), 0U));
+
+    for(uint32_t i = 0; i < CAPACITY; i++)
+    {
+        TEST_ASSERT_EQUAL(ezSUCCESS, ezBlockingQueue_PopTimeout(&queue, &value, &size, 0U));
+    }
+}
+
+
+TEST(ez_blocking_queue, PushTooLarge)
+{
+    static uint8_t data[BUFF_SIZE];
+
+    TEST_ASSERT_EQUAL(ezFAIL, ezBlockingQueue_PushTimeout(&queue, data, sizeof(data),
+                                                          EZ_BLOCKING_QUEUE_WAIT_FOREVER));
+    TEST_ASSERT_EQUAL(0U, ezBlockingQueue_GetNumOfElement(&queue));
+}
+
+
+TEST(ez_blocking_queue, ProducerConsumer)
+{
+    pthread_t consumer;
+    uint32_t expected_sum = 0U;
+
+    received_sum = 0U;
+    TEST_ASSERT_EQUAL(0, pthread_create(&consumer, NULL, Consumer, NULL));
+
+    /* The queue holds CAPACITY elements, the producer blocks most of the time */
+    for(uint32_t i = 1U; i <= NUM_OF_MESSAGES; i++)
+    {
+        TEST_ASSERT_EQUAL(ezSUCCESS, ezBlockingQueue_PushTimeout(&queue, &i, sizeof(i),
+                                                                 EZ_BLOCKING_QUEUE_WAIT_FOREVER));
+        TEST_ASSERT_TRUE(ezBlockingQueue_GetNumOfElement(&queue) <= CAPACITY);
+        expected_sum += i;
+    }
+
+    TEST_ASSERT_EQUAL(0, pthread_join(consumer, NULL));
+    TEST_ASSERT_EQUAL_UINT32(expected_sum, received_sum);
+    TEST_ASSERT_EQUAL(0U, ezBlockingQueue_GetNumOfElement(&queue));
+}
+
+
+/******************************************************************************
+* Internal functions
+*******************************************************************************/
+static void RunAllTests(void)
+{
+    RUN_TEST_GROUP(ez_blocking_queue);
+}
+
+
+static void *Consumer(void *arg)
+{
+    uint32_t value = 0U;
+    uint32_t size = 0U;
+    uint32_t expected = 1U;
+
+    (void)arg;
+    while(expected <= NUM_OF_MESSAGES)
+    {
+        size = sizeof(value);
+        if(ezBlockingQueue_PopTimeout(&queue, &value, &size, 1000U) != ezSUCCESS
+           || value != expected)
+        {
+            break;
+        }
+        received_sum += value;
+        expected++;
+    }
+
+    return NULL;
+}
+
+
+static void GetDeadline(struct timespec *deadline, uint32_t timeout_ticks)
+{
+    clock_gettime(CLOCK_REALTIME, deadline);
+    deadline->tv_sec += (time_t)(timeout_ticks / 1000U);
+    deadline->tv_nsec += (long)(timeout_ticks % 1000U) * 1000000L;
+    if(deadline->tv_nsec >= 1000000000L)
+    {
+        deadline->tv_sec++;
+        deadline->tv_nsec -= 1000000000L;
+    }
+}
+
+
+static bool WaitCond(pthread_cond_t *cond, pthread_mutex_t *mutex,
+                     const struct timespec *deadline, uint32_t timeout_ticks)
+{
+    if(timeout_ticks == WAIT_FOREVER)
+    {
+        return pthread_cond_wait(cond, mutex) == 0;
+    }
+
+    return pthread_cond_timedwait(cond, mutex, deadline) != ETIMEDOUT;
+}
+
+
+static unsigned long Posix_TaskGetTickCount(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned long)now.tv_sec * 1000UL + (unsigned long)now.tv_nsec / 1000000UL;
+}
+
+
+static ezSTATUS Posix_SemaphoreCreate(ezOsal_SemaphoreHandle_t *handle)
+{
+    PosixSemaphore *sem = malloc(sizeof(PosixSemaphore));
+
+    if(sem == NULL)
+    {
+        return ezFAIL;
+    }
+
+    pthread_mutex_init(&sem->mutex, NULL);
+    pthread_cond_init(&sem->cond, NULL);
+    sem->count = handle->initial_count;
+    sem->max_count = handle->max_count;
+    handle->handle = sem;
+
+    return ezSUCCESS;
+}
+
+
+static ezSTATUS Posix_SemaphoreDelete(ezOsal_SemaphoreHandle_t *handle)
+{
+    PosixSemaphore *sem = (PosixSemaphore *)handle->handle;
+
+    pthread_mutex_destroy(&sem->mutex);
+    pthread_cond_destroy(&sem->cond);
+    free(sem);
+    handle->handle = NULL;
+
+    return ezSUCCESS;
+}
+
+
+static ezSTATUS Posix_SemaphoreTake(ezOsal_SemaphoreHandle_t *handle, uint32_t timeout_ticks)
+{
+    PosixSemaphore *sem = (PosixSemaphore *)handle->handle;
+    ezSTATUS status = ezSUCCESS;
+    struct timespec deadline;
+
+    GetDeadline(&deadline, timeout_ticks);
+    pthread_mutex_lock(&sem->mutex);
+    while(sem->count == 0U && status == ezSUCCESS)
+    {
+        if(timeout_ticks == 0U || !WaitCond(&sem->cond, &sem->mutex, &deadline, timeout_ticks))
+        {
+            status = ezSTATUS_TIMEOUT;
+        }
+    }
+
+    if(status == ezSUCCESS)
+    {
+        sem->count--;
+    }
+    pthread_mutex_unlock(&sem->mutex);
+
+    return status;
+}
+
+
+static ezSTATUS Posix_SemaphoreGive(ezOsal_SemaphoreHandle_t *handle)
+{
+    PosixSemaphore *sem = (PosixSemaphore *)handle->handle;
+    ezSTATUS status = ezFAIL;
+
+    pthread_mutex_lock(&sem->mutex);
+    if(sem->count < sem->max_count)
+    {
+        sem->count++;
+        pthread_cond_signal(&sem->cond);
+        status = ezSUCCESS;
+    }
+    pthread_mutex_unlock(&sem->mutex);
+
+    return status;
+}
+
+
+static ezSTATUS Posix_EventCreate(ezOsal_EventHandle_t *handle)
+{
+    PosixEvent *ev = malloc(sizeof(PosixEvent));
+
+    if(ev == NULL)
+    {
+        return ezFAIL;
+    }
+
+    pthread_mutex_init(&ev->mutex, NULL);
+    pthread_cond_init(&ev->cond, NULL);
+    ev->bits = 0U;
+    handle->handle = ev;
+
+    return ezSUCCESS;
+}
+
+
+static ezSTATUS Posix_EventDelete(ezOsal_EventHandle_t *handle)
+{
+    PosixEvent *ev = (PosixEvent *)handle->handle;
+
+    pthread_mutex_destroy(&ev->mutex);
+    pthread_cond_destroy(&ev->cond);
+    free(ev);
+    handle->handle = NULL;
+
+    return ezSUCCESS;
+}
+
+
+static int Posix_EventWait(ezOsal_EventHandle_t *handle, uint32_t event_mask, uint32_t timeout_ticks)
+{
+    PosixEvent *ev = (PosixEvent *)handle->handle;
+    uint32_t bits = 0U;
+    struct timespec deadline;
+
+    GetDeadline(&deadline, timeout_ticks);
+    pthread_mutex_lock(&ev->mutex);
+    while((ev->bits & event_mask) == 0U && timeout_ticks != 0U)
+    {
+        if(!WaitCond(&ev->cond, &ev->mutex, &deadline, timeout_ticks))
+        {
+            break;
+        }
+    }
+
+    bits = ev->bits & event_mask;
+    ev->bits &= ~bits;
+    pthread_mutex_unlock(&ev->mutex);
+
+    return (int)bits;
+}
+
+
+static ezSTATUS Posix_EventSet(ezOsal_EventHandle_t *handle, uint32_t event_mask)
+{
+    PosixEvent *ev = (PosixEvent *)handle->handle;
+
+    pthread_mutex_lock(&ev->mutex);
+    ev->bits |= event_mask;
+    pthread_cond_broadcast(&ev->cond);
+    pthread_mutex_unlock(&ev->mutex);
+
+    return ezSUCCESS;
+}
+
+
+static ezSTATUS Posix_EventClear(ezOsal_EventHandle_t *handle, uint32_t event_mask)
+{
+    PosixEvent *ev = (PosixEvent *)handle->handle;
+
+    pthread_mutex_lock(&ev->mutex);
+    ev->bits &= ~event_mask;
+    pthread_mutex_unlock(&ev->mutex);
+
+    return ezSUCCESS;
+}
+
+
+/* End of file */
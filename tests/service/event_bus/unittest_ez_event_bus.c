@@ -58,6 +58,8 @@ static ezEventListener_t listener2;
 
 static uint32_t listener1_notiffy_code;
 static uint32_t listener2_notiffy_code;
+static size_t listener1_data_size;
+static const void *listener1_data;
 
 static uint8_t buff[1024];
 static TestData_t data1;
@@ -92,6 +94,8 @@ TEST_SETUP(ez_event_bus)
     {
         listener1_notiffy_code = 0;
         listener2_notiffy_code = 0;
+        listener1_data_size = 0;
+        listener1_data = NULL;
         success &= (ezSUCCESS == ezEventBus_Listen(&test_subject, &listener1));
         success &= (ezSUCCESS == ezEventBus_Listen(&test_subject, &listener2));
     }
@@ -110,6 +114,8 @@ TEST_GROUP_RUNNER(ez_event_bus)
     RUN_TEST_CASE(ez_event_bus, UnsubscribeFromSubject);
     RUN_TEST_CASE(ez_event_bus, ResetBus);
     RUN_TEST_CASE(ez_event_bus, NotifyEvent1);
+    RUN_TEST_CASE(ez_event_bus, OneElementPerEvent);
+    RUN_TEST_CASE(ez_event_bus, ZeroLengthEvent);
 }
 
 
@@ -161,6 +167,44 @@ TEST(ez_event_bus, NotifyEvent1)
 }
 
 
+TEST(ez_event_bus, OneElementPerEvent)
+{
+    TestData_t test_data = { .a = 30, .b = 40 };
+    uint8_t small_data = 0x5A;
+
+    TEST_ASSERT_TRUE(ezEventBus_SendEvent(&test_subject, 2U, &test_data, sizeof(test_data)));
+    TEST_ASSERT_TRUE(ezEventBus_SendEvent(&test_subject, 3U, &small_data, sizeof(small_data)));
+    TEST_ASSERT_EQUAL(2U, ezQueue_GetNumOfElement(&test_subject.event_queue));
+
+    /* events are delivered one per run, in the order they were sent */
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezEventBus_Run(&test_subject));
+    TEST_ASSERT_EQUAL(2U, listener1_notiffy_code);
+    TEST_ASSERT_EQUAL(sizeof(test_data), listener1_data_size);
+    TEST_ASSERT_EQUAL_MEMORY(&test_data, &data1, sizeof(test_data));
+
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezEventBus_Run(&test_subject));
+    TEST_ASSERT_EQUAL(3U, listener1_notiffy_code);
+    TEST_ASSERT_EQUAL(sizeof(small_data), listener1_data_size);
+    TEST_ASSERT_EQUAL(0U, ezQueue_GetNumOfElement(&test_subject.event_queue));
+}
+
+
+TEST(ez_event_bus, ZeroLengthEvent)
+{
+    TEST_ASSERT_FALSE(ezEventBus_SendEvent(&test_subject, 4U, NULL, 1U));
+    TEST_ASSERT_TRUE(ezEventBus_SendEvent(&test_subject, 4U, NULL, 0U));
+    TEST_ASSERT_EQUAL(1U, ezQueue_GetNumOfElement(&test_subject.event_queue));
+
+    listener1_data_size = 1U;
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezEventBus_Run(&test_subject));
+    TEST_ASSERT_EQUAL(4U, listener1_notiffy_code);
+    TEST_ASSERT_EQUAL(4U, listener2_notiffy_code);
+    TEST_ASSERT_EQUAL(0U, listener1_data_size);
+    TEST_ASSERT_NULL(listener1_data);
+    TEST_ASSERT_EQUAL(0U, ezQueue_GetNumOfElement(&test_subject.event_queue));
+}
+
+
 /******************************************************************************
 * Internal functions
 *******************************************************************************/
@@ -173,7 +217,12 @@ static void RunAllTests(void)
 int Listener1_Callback(uint32_t event_code, const void *data, size_t data_size)
 {
     listener1_notiffy_code = event_code;
-    memcpy(&data1, data, data_size);
+    listener1_data = data;
+    listener1_data_size = data_size;
+    if (data_size > 0U)
+    {
+        memcpy(&data1, data, data_size);
+    }
     return 0;
 }
 
@@ -181,7 +230,10 @@ int Listener1_Callback(uint32_t event_code, const void *data, size_t data_size)
 int Listener2_Callback(uint32_t event_code, const void *data, size_t data_size)
 {
     listener2_notiffy_code = event_code;
-    memcpy(&data2, data, data_size);
+    if (data_size > 0U)
+    {
+        memcpy(&data2, data, data_size);
+    }
     return 0;
 }
 
@@ -0,0 +1,211 @@
+/*****************************************************************************
+* Filename:         unittest_ez_arena.c
+* Author:           Hai Nguyen
+* Original Date:    16.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   unittest_ez_arena.c
+ *  @author Hai Nguyen
+ *  @date   16.10.2026
+ *  @brief  Unit test for the arena allocator
+ *
+ *  @details
+ */
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "unity.h"
+#include "unity_fixture.h"
+#include "ez_arena.h"
+
+TEST_GROUP(ez_arena);
+
+/******************************************************************************
+* Module Preprocessor Macros
+*******************************************************************************/
+#define BUFF_SIZE   256U
+
+
+/******************************************************************************
+* Module Typedefs
+*******************************************************************************/
+/* None */
+
+
+/******************************************************************************
+* Module Variable Definitions
+*******************************************************************************/
+static uint8_t arena_buff[BUFF_SIZE];
+static ezArena arena;
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+static void RunAllTests(void);
+
+
+/******************************************************************************
+* External functions
+*******************************************************************************/
+int main(int argc, const char *argv[])
+{
+    return UnityMain(argc, argv, RunAllTests);
+}
+
+
+TEST_SETUP(ez_arena)
+{
+    memset(&arena, 0, sizeof(arena));
+}
+
+
+TEST_TEAR_DOWN(ez_arena)
+{
+}
+
+
+TEST_GROUP_RUNNER(ez_arena)
+{
+    RUN_TEST_CASE(ez_arena, Init);
+    RUN_TEST_CASE(ez_arena, Alloc);
+    RUN_TEST_CASE(ez_arena, AllocAligned);
+    RUN_TEST_CASE(ez_arena, MarkRewind);
+    RUN_TEST_CASE(ez_arena, Reset);
+}
+
+
+TEST(ez_arena, Init)
+{
+    TEST_ASSERT_FALSE(ezArena_Init(NULL, arena_buff, BUFF_SIZE));
+    TEST_ASSERT_FALSE(ezArena_Init(&arena, NULL, BUFF_SIZE));
+    TEST_ASSERT_FALSE(ezArena_Init(&arena, arena_buff, 0));
+
+    TEST_ASSERT_TRUE(ezArena_Init(&arena, arena_buff, BUFF_SIZE));
+    TEST_ASSERT_EQUAL(BUFF_SIZE, ezArena_GetFreeSize(&arena));
+    TEST_ASSERT_EQUAL(0U, ezArena_GetPeak(&arena));
+}
+
+
+TEST(ez_arena, Alloc)
+{
+    uint8_t *first = NULL;
+    uint8_t *second = NULL;
+
+    /* start from an odd address, the arena aligns by itself */
+    TEST_ASSERT_TRUE(ezArena_Init(&arena, &arena_buff[1], BUFF_SIZE - 1U));
+    TEST_ASSERT_NULL(ezArena_Alloc(&arena, 0));
+
+    first = (uint8_t *)ezArena_Alloc(&arena, 3);
+    second = (uint8_t *)ezArena_Alloc(&arena, 10);
+    TEST_ASSERT_NOT_NULL(first);
+    TEST_ASSERT_NOT_NULL(second);
+    TEST_ASSERT_EQUAL(0U, (uintptr_t)first % CONFIG_EZ_ARENA_ALIGNMENT);
+    TEST_ASSERT_EQUAL(0U, (uintptr_t)second % CONFIG_EZ_ARENA_ALIGNMENT);
+    TEST_ASSERT_TRUE(second >= first + 3);
+    TEST_ASSERT_TRUE(second < first + 3 + CONFIG_EZ_ARENA_ALIGNMENT);
+
+    memset(first, 0xAA, 3);
+    memset(second, 0x55, 10);
+    TEST_ASSERT_EQUAL_UINT8(0xAA, first[2]);
+
+    /* the arena is full, but the last bytes can still be taken unaligned */
+    TEST_ASSERT_NULL(ezArena_Alloc(&arena, BUFF_SIZE));
+    TEST_ASSERT_NOT_NULL(ezArena_AllocAligned(&arena, ezArena_GetFreeSize(&arena), 1));
+    TEST_ASSERT_EQUAL(0U, ezArena_GetFreeSize(&arena));
+    TEST_ASSERT_NULL(ezArena_AllocAligned(&arena, 1, 1));
+    TEST_ASSERT_EQUAL(BUFF_SIZE - 1U, ezArena_GetPeak(&arena));
+}
+
+
+TEST(ez_arena, AllocAligned)
+{
+    uint8_t *mem = NULL;
+
+    TEST_ASSERT_TRUE(ezArena_Init(&arena, arena_buff, BUFF_SIZE));
+    TEST_ASSERT_NULL(ezArena_AllocAligned(&arena, 8, 0));
+    TEST_ASSERT_NULL(ezArena_AllocAligned(&arena, 8, 24));
+    TEST_ASSERT_EQUAL(BUFF_SIZE, ezArena_GetFreeSize(&arena));
+
+    TEST_ASSERT_NOT_NULL(ezArena_AllocAligned(&arena, 1, 1));
+    for (uint32_t alignment = 2; alignment <= 64U; alignment *= 2U)
+    {
+        mem = (uint8_t *)ezArena_AllocAligned(&arena, 1, alignment);
+        TEST_ASSERT_NOT_NULL(mem);
+        TEST_ASSERT_EQUAL(0U, (uintptr_t)mem % alignment);
+    }
+}
+
+
+TEST(ez_arena, MarkRewind)
+{
+    ezArenaMark outer = 0U;
+    ezArenaMark inner = 0U;
+    uint8_t *msg = NULL;
+    uint8_t *scratch = NULL;
+
+    TEST_ASSERT_TRUE(ezArena_Init(&arena, arena_buff, BUFF_SIZE));
+    msg = (uint8_t *)ezArena_Alloc(&arena, 16);
+    TEST_ASSERT_NOT_NULL(msg);
+    memset(msg, 0x11, 16);
+
+    outer = ezArena_GetMark(&arena);
+    TEST_ASSERT_NOT_NULL(ezArena_Alloc(&arena, 32));
+    inner = ezArena_GetMark(&arena);
+    scratch = (uint8_t *)ezArena_Alloc(&arena, 64);
+    TEST_ASSERT_NOT_NULL(scratch);
+
+    /* rewinding to the inner mark reuses the same memory */
+    TEST_ASSERT_TRUE(ezArena_Rewind(&arena, inner));
+    TEST_ASSERT_EQUAL_PTR(scratch, ezArena_Alloc(&arena, 64));
+
+    /* rewinding to the outer mark also releases the inner allocations */
+    TEST_ASSERT_TRUE(ezArena_Rewind(&arena, outer));
+    TEST_ASSERT_EQUAL(BUFF_SIZE - outer, ezArena_GetFreeSize(&arena));
+    TEST_ASSERT_FALSE(ezArena_Rewind(&arena, inner));
+
+    /* allocations before the mark are untouched */
+    TEST_ASSERT_EQUAL_UINT8(0x11, msg[15]);
+    TEST_ASSERT_EQUAL((uint32_t)(scratch - arena_buff) + 64U, ezArena_GetPeak(&arena));
+}
+
+
+TEST(ez_arena, Reset)
+{
+    uint8_t *first = NULL;
+
+    TEST_ASSERT_TRUE(ezArena_Init(&arena, arena_buff, BUFF_SIZE));
+    first = (uint8_t *)ezArena_Alloc(&arena, 100);
+    TEST_ASSERT_NOT_NULL(first);
+    TEST_ASSERT_NOT_NULL(ezArena_Alloc(&arena, 100));
+    TEST_ASSERT_NULL(ezArena_Alloc(&arena, 100));
+
+    ezArena_Reset(&arena);
+    TEST_ASSERT_EQUAL(BUFF_SIZE, ezArena_GetFreeSize(&arena));
+    TEST_ASSERT_EQUAL_PTR(first, ezArena_Alloc(&arena, 200));
+    TEST_ASSERT_TRUE(ezArena_GetPeak(&arena) >= 200U);
+}
+
+
+/******************************************************************************
+* Internal functions
+*******************************************************************************/
+static void RunAllTests(void)
+{
+    RUN_TEST_GROUP(ez_arena);
+}
+
+
+/* End of file */
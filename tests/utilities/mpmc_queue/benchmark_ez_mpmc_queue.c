@@ -0,0 +1,155 @@
+/*****************************************************************************
+* Filename:         benchmark_ez_mpmc_queue.c
+* Author:           Hai Nguyen
+* Original Date:    16.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   benchmark_ez_mpmc_queue.c
+ *  @author Hai Nguyen
+ *  @date   16.10.2026
+ *  @brief  Scaling benchmark of the MPMC queue
+ *
+ *  @details Runs N producer and N consumer threads (N = 1..8) over one
+ *  queue and prints the number of transferred elements per second. Not part
+ *  of the unit test run, execute ez_mpmc_queue_benchmark manually.
+ */
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+#include "ez_mpmc_queue.h"
+
+
+/******************************************************************************
+* Module Preprocessor Macros
+*******************************************************************************/
+#define BENCH_NUM_OF_SLOTS      1024U
+#define BENCH_MAX_THREADS       8U
+#define BENCH_NUM_OF_ELEMENTS   (4U * 1024U * 1024U)
+
+
+/******************************************************************************
+* Module Typedefs
+*******************************************************************************/
+typedef struct
+{
+    uint64_t value;
+} BenchElement;
+
+
+/******************************************************************************
+* Module Variable Definitions
+*******************************************************************************/
+static uint32_t buffer[EZ_MPMC_QUEUE_BUFFER_WORDS(sizeof(BenchElement), BENCH_NUM_OF_SLOTS)];
+static ezMpmcQueue queue;
+static uint32_t items_per_thread = 0U;
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+static void *Producer(void *arg);
+static void *Consumer(void *arg);
+static double RunBenchmark(uint32_t num_of_threads);
+
+
+/******************************************************************************
+* External functions
+*******************************************************************************/
+int main(void)
+{
+    printf("%-10s %-10s %16s\n", "producers", "consumers", "elements/s");
+    for (uint32_t n = 1U; n <= BENCH_MAX_THREADS; n++)
+    {
+        printf("%-10u %-10u %16.0f\n", n, n, RunBenchmark(n));
+    }
+
+    return 0;
+}
+
+
+/******************************************************************************
+* Internal functions
+*******************************************************************************/
+static void *Producer(void *arg)
+{
+    BenchElement elem = { 0 };
+    (void)arg;
+
+    for (uint32_t i = 0; i < items_per_thread; i++)
+    {
+        elem.value = i;
+        while (!ezMpmcQueue_Enqueue(&queue, &elem))
+        {
+            (void)sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+
+static void *Consumer(void *arg)
+{
+    BenchElement elem;
+    (void)arg;
+
+    for (uint32_t i = 0; i < items_per_thread; i++)
+    {
+        while (!ezMpmcQueue_Dequeue(&queue, &elem))
+        {
+            (void)sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+
+static double RunBenchmark(uint32_t num_of_threads)
+{
+    pthread_t producers[BENCH_MAX_THREADS];
+    pthread_t consumers[BENCH_MAX_THREADS];
+    struct timespec start;
+    struct timespec stop;
+    double elapsed_s;
+
+    (void)ezMpmcQueue_Init(&queue, buffer, sizeof(buffer),
+                           sizeof(BenchElement), BENCH_NUM_OF_SLOTS);
+    items_per_thread = BENCH_NUM_OF_ELEMENTS / num_of_threads;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (uint32_t i = 0; i < num_of_threads; i++)
+    {
+        pthread_create(&consumers[i], NULL, Consumer, NULL);
+        pthread_create(&producers[i], NULL, Producer, NULL);
+    }
+    for (uint32_t i = 0; i < num_of_threads; i++)
+    {
+        pthread_join(producers[i], NULL);
+        pthread_join(consumers[i], NULL);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &stop);
+
+    elapsed_s = (double)(stop.tv_sec - start.tv_sec)
+        + (double)(stop.tv_nsec - start.tv_nsec) / 1e9;
+
+    return (double)(items_per_thread * num_of_threads) / elapsed_s;
+}
+
+
+/* End of file */
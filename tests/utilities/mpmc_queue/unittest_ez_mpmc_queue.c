@@ -0,0 +1,313 @@
+/*****************************************************************************
+* Filename:         unittest_ez_mpmc_queue.c
+* Author:           Hai Nguyen
+* Original Date:    16.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   unittest_ez_mpmc_queue.c
+ *  @author Hai Nguyen
+ *  @date   16.10.2026
+ *  @brief  Unit test for the multi-producer/multi-consumer queue
+ *
+ *  @details The stress test runs several producer and consumer threads and
+ *  checks that every element is received exactly once and that elements of
+ *  one producer are received in order by each consumer.
+ */
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include "unity.h"
+#include "unity_fixture.h"
+#include "ez_mpmc_queue.h"
+
+TEST_GROUP(ez_mpmc_queue);
+
+/******************************************************************************
+* Module Preprocessor Macros
+*******************************************************************************/
+#define NUM_OF_SLOTS            8U
+#define STRESS_NUM_OF_SLOTS     64U
+#define STRESS_NUM_OF_PRODUCERS 4U
+#define STRESS_NUM_OF_CONSUMERS 4U
+#define STRESS_ITEMS_PER_PRODUCER 50000U
+
+
+/******************************************************************************
+* Module Typedefs
+*******************************************************************************/
+typedef struct
+{
+    uint32_t producer;
+    uint32_t counter;
+    uint8_t payload[5];     /* odd size to exercise the slot padding */
+} TestElement;
+
+typedef struct
+{
+    uint32_t id;
+    uint32_t received;
+    uint32_t errors;
+    uint32_t last_counter[STRESS_NUM_OF_PRODUCERS];
+} ConsumerContext;
+
+
+/******************************************************************************
+* Module Variable Definitions
+*******************************************************************************/
+static uint32_t test_buffer[EZ_MPMC_QUEUE_BUFFER_WORDS(sizeof(TestElement), NUM_OF_SLOTS)];
+static uint32_t stress_buffer[EZ_MPMC_QUEUE_BUFFER_WORDS(sizeof(TestElement), STRESS_NUM_OF_SLOTS)];
+static ezMpmcQueue queue;
+static uint32_t total_received = 0U;
+static uint8_t seen[STRESS_NUM_OF_PRODUCERS][STRESS_ITEMS_PER_PRODUCER];
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+static void RunAllTests(void);
+static void *Producer(void *arg);
+static void *Consumer(void *arg);
+
+/******************************************************************************
+* External functions
+*******************************************************************************/
+int main(int argc, const char *argv[])
+{
+    return UnityMain(argc, argv, RunAllTests);
+}
+
+
+TEST_SETUP(ez_mpmc_queue)
+{
+    (void)ezMpmcQueue_Init(&queue, test_buffer, sizeof(test_buffer),
+                           sizeof(TestElement), NUM_OF_SLOTS);
+}
+
+
+TEST_TEAR_DOWN(ez_mpmc_queue)
+{
+}
+
+
+TEST_GROUP_RUNNER(ez_mpmc_queue)
+{
+    RUN_TEST_CASE(ez_mpmc_queue, Init);
+    RUN_TEST_CASE(ez_mpmc_queue, EnqueueDequeue);
+    RUN_TEST_CASE(ez_mpmc_queue, FullAndEmpty);
+    RUN_TEST_CASE(ez_mpmc_queue, Wrapping);
+    RUN_TEST_CASE(ez_mpmc_queue, StressMultiThread);
+}
+
+
+TEST(ez_mpmc_queue, Init)
+{
+    TEST_ASSERT_FALSE(ezMpmcQueue_Init(NULL, test_buffer, sizeof(test_buffer),
+                                       sizeof(TestElement), NUM_OF_SLOTS));
+    TEST_ASSERT_FALSE(ezMpmcQueue_Init(&queue, NULL, sizeof(test_buffer),
+                                       sizeof(TestElement), NUM_OF_SLOTS));
+    TEST_ASSERT_FALSE(ezMpmcQueue_Init(&queue, test_buffer, sizeof(test_buffer),
+                                       0, NUM_OF_SLOTS));
+    /* Not a power of two */
+    TEST_ASSERT_FALSE(ezMpmcQueue_Init(&queue, test_buffer, sizeof(test_buffer),
+                                       sizeof(TestElement), 6));
+    /* Buffer too small */
+    TEST_ASSERT_FALSE(ezMpmcQueue_Init(&queue, test_buffer, sizeof(test_buffer) - 1,
+                                       sizeof(TestElement), NUM_OF_SLOTS));
+    /* Misaligned buffer */
+    TEST_ASSERT_FALSE(ezMpmcQueue_Init(&queue, (uint8_t *)test_buffer + 1, sizeof(test_buffer) - 4,
+                                       sizeof(uint8_t), 2));
+
+    TEST_ASSERT_TRUE(ezMpmcQueue_Init(&queue, test_buffer, sizeof(test_buffer),
+                                      sizeof(TestElement), NUM_OF_SLOTS));
+    TEST_ASSERT_EQUAL(0, ezMpmcQueue_GetNumOfElements(&queue));
+}
+
+
+TEST(ez_mpmc_queue, EnqueueDequeue)
+{
+    TestElement in = { 1, 2, { 3, 4, 5, 6, 7 } };
+    TestElement out;
+
+    memset(&out, 0, sizeof(out));
+    TEST_ASSERT_TRUE(ezMpmcQueue_Enqueue(&queue, &in));
+    TEST_ASSERT_EQUAL(1, ezMpmcQueue_GetNumOfElements(&queue));
+
+    TEST_ASSERT_TRUE(ezMpmcQueue_Dequeue(&queue, &out));
+    TEST_ASSERT_EQUAL_MEMORY(&in, &out, sizeof(in));
+    TEST_ASSERT_EQUAL(0, ezMpmcQueue_GetNumOfElements(&queue));
+}
+
+
+TEST(ez_mpmc_queue, FullAndEmpty)
+{
+    TestElement elem = { 0 };
+
+    TEST_ASSERT_FALSE(ezMpmcQueue_Dequeue(&queue, &elem));
+
+    for (uint32_t i = 0; i < NUM_OF_SLOTS; i++)
+    {
+        elem.counter = i;
+        TEST_ASSERT_TRUE(ezMpmcQueue_Enqueue(&queue, &elem));
+    }
+    TEST_ASSERT_FALSE(ezMpmcQueue_Enqueue(&queue, &elem));
+    TEST_ASSERT_EQUAL(NUM_OF_SLOTS, ezMpmcQueue_GetNumOfElements(&queue));
+
+    for (uint32_t i = 0; i < NUM_OF_SLOTS; i++)
+    {
+        TEST_ASSERT_TRUE(ezMpmcQueue_Dequeue(&queue, &elem));
+        TEST_ASSERT_EQUAL(i, elem.counter);
+    }
+    TEST_ASSERT_FALSE(ezMpmcQueue_Dequeue(&queue, &elem));
+}
+
+
+TEST(ez_mpmc_queue, Wrapping)
+{
+    TestElement elem = { 0 };
+
+    for (uint32_t i = 0; i < 10 * NUM_OF_SLOTS; i++)
+    {
+        elem.counter = i;
+        TEST_ASSERT_TRUE(ezMpmcQueue_Enqueue(&queue, &elem));
+        elem.counter = i + 1;
+        TEST_ASSERT_TRUE(ezMpmcQueue_Enqueue(&queue, &elem));
+
+        TEST_ASSERT_TRUE(ezMpmcQueue_Dequeue(&queue, &elem));
+        TEST_ASSERT_EQUAL(i, elem.counter);
+        TEST_ASSERT_TRUE(ezMpmcQueue_Dequeue(&queue, &elem));
+        TEST_ASSERT_EQUAL(i + 1, elem.counter);
+    }
+}
+
+
+TEST(ez_mpmc_queue, StressMultiThread)
+{
+    pthread_t producers[STRESS_NUM_OF_PRODUCERS];
+    pthread_t consumers[STRESS_NUM_OF_CONSUMERS];
+    uint32_t producer_ids[STRESS_NUM_OF_PRODUCERS];
+    ConsumerContext contexts[STRESS_NUM_OF_CONSUMERS];
+    uint32_t errors = 0U;
+
+    memset(seen, 0, sizeof(seen));
+    memset(contexts, 0, sizeof(contexts));
+    total_received = 0U;
+    TEST_ASSERT_TRUE(ezMpmcQueue_Init(&queue, stress_buffer, sizeof(stress_buffer),
+                                      sizeof(TestElement), STRESS_NUM_OF_SLOTS));
+
+    for (uint32_t i = 0; i < STRESS_NUM_OF_CONSUMERS; i++)
+    {
+        contexts[i].id = i;
+        TEST_ASSERT_EQUAL(0, pthread_create(&consumers[i], NULL, Consumer, &contexts[i]));
+    }
+    for (uint32_t i = 0; i < STRESS_NUM_OF_PRODUCERS; i++)
+    {
+        producer_ids[i] = i;
+        TEST_ASSERT_EQUAL(0, pthread_create(&producers[i], NULL, Producer, &producer_ids[i]));
+    }
+
+    for (uint32_t i = 0; i < STRESS_NUM_OF_PRODUCERS; i++)
+    {
+        TEST_ASSERT_EQUAL(0, pthread_join(producers[i], NULL));
+    }
+    for (uint32_t i = 0; i < STRESS_NUM_OF_CONSUMERS; i++)
+    {
+        TEST_ASSERT_EQUAL(0, pthread_join(consumers[i], NULL));
+        errors += contexts[i].errors;
+    }
+
+    TEST_ASSERT_EQUAL(0, errors);
+    for (uint32_t p = 0; p < STRESS_NUM_OF_PRODUCERS; p++)
+    {
+        for (uint32_t n = 0; n < STRESS_ITEMS_PER_PRODUCER; n++)
+        {
+            TEST_ASSERT_EQUAL(1, seen[p][n]);
+        }
+    }
+    TEST_ASSERT_EQUAL(0, ezMpmcQueue_GetNumOfElements(&queue));
+}
+
+
+/******************************************************************************
+* Internal functions
+*******************************************************************************/
+static void RunAllTests(void)
+{
+    RUN_TEST_GROUP(ez_mpmc_queue);
+}
+
+
+static void *Producer(void *arg)
+{
+    TestElement elem;
+
+    memset(&elem, 0, sizeof(elem));
+    elem.producer = *(uint32_t *)arg;
+
+    for (uint32_t n = 0; n < STRESS_ITEMS_PER_PRODUCER; n++)
+    {
+        elem.counter = n;
+        elem.payload[0] = (uint8_t)n;
+        while (!ezMpmcQueue_Enqueue(&queue, &elem))
+        {
+            (void)sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+
+static void *Consumer(void *arg)
+{
+    ConsumerContext *ctx = (ConsumerContext *)arg;
+    const uint32_t total = STRESS_NUM_OF_PRODUCERS * STRESS_ITEMS_PER_PRODUCER;
+    TestElement elem;
+
+    while (__atomic_load_n(&total_received, __ATOMIC_RELAXED) < total)
+    {
+        if (!ezMpmcQueue_Dequeue(&queue, &elem))
+        {
+            (void)sched_yield();
+            continue;
+        }
+
+        if (elem.producer >= STRESS_NUM_OF_PRODUCERS
+            || elem.counter >= STRESS_ITEMS_PER_PRODUCER
+            || elem.payload[0] != (uint8_t)elem.counter)
+        {
+            ctx->errors++;
+            continue;
+        }
+
+        /* Each consumer must see the elements of one producer in order */
+        if (ctx->received > 0U && elem.counter != 0U
+            && elem.counter <= ctx->last_counter[elem.producer])
+        {
+            ctx->errors++;
+        }
+        ctx->last_counter[elem.producer] = elem.counter;
+        ctx->received++;
+
+        seen[elem.producer][elem.counter]++;
+        (void)__atomic_fetch_add(&total_received, 1U, __ATOMIC_RELAXED);
+    }
+
+    return NULL;
+}
+
+
+/* End of file */
@@ -0,0 +1,337 @@
+/*****************************************************************************
+* Filename:         unittest_ez_pool.c
+* Author:           Hai Nguyen
+* Original Date:    16.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   unittest_ez_pool.c
+ *  @author Hai Nguyen
+ *  @date   16.10.2026
+ *  @brief  Unit test for the fixed-size object pool
+ *
+ *  @details The stress test runs several threads allocating and freeing
+ *  from one lock-free pool. Each thread stamps its objects and checks the
+ *  stamp before freeing, so an object handed out twice is detected.
+ */
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include "unity.h"
+#include "unity_fixture.h"
+#include "ez_pool.h"
+
+TEST_GROUP(ez_pool);
+
+/******************************************************************************
+* Module Preprocessor Macros
+*******************************************************************************/
+#define NUM_OF_OBJS             40U     /* more than one bitmap word */
+#define STRESS_NUM_OF_OBJS      16U
+#define NUM_OF_PTR_OBJS         70U     /* three bitmap words */
+#define STRESS_NUM_OF_THREADS   4U
+#define STRESS_NUM_OF_ROUNDS    20000U
+#define STRESS_HOLD             3U
+
+
+/******************************************************************************
+* Module Typedefs
+*******************************************************************************/
+typedef struct
+{
+    uint32_t link;          /* overwritten by the pool while free */
+    uint32_t owner;
+    uint8_t payload[3];     /* odd size to exercise the rounding */
+} TestObject;
+
+typedef struct
+{
+    void *next;
+    uint64_t stamp;
+    uint8_t flag;
+} PtrObject;
+
+
+/******************************************************************************
+* Module Variable Definitions
+*******************************************************************************/
+static uint32_t test_buffer[EZ_POOL_BUFFER_WORDS(sizeof(TestObject), NUM_OF_OBJS)];
+static uint32_t stress_buffer[EZ_POOL_BUFFER_WORDS(sizeof(TestObject), STRESS_NUM_OF_OBJS)];
+static uint32_t ptr_buffer[EZ_POOL_BUFFER_WORDS(sizeof(PtrObject), NUM_OF_PTR_OBJS) + 1U];
+static ezPool pool;
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+static void RunAllTests(void);
+static void *Worker(void *arg);
+
+/******************************************************************************
+* External functions
+*******************************************************************************/
+int main(int argc, const char *argv[])
+{
+    return UnityMain(argc, argv, RunAllTests);
+}
+
+
+TEST_SETUP(ez_pool)
+{
+    memset(&pool, 0, sizeof(pool));
+}
+
+
+TEST_TEAR_DOWN(ez_pool)
+{
+}
+
+
+TEST_GROUP_RUNNER(ez_pool)
+{
+    RUN_TEST_CASE(ez_pool, Init);
+    RUN_TEST_CASE(ez_pool, BitmapAllocFree);
+    RUN_TEST_CASE(ez_pool, BitmapInvalidFree);
+    RUN_TEST_CASE(ez_pool, AlignedObjects);
+    RUN_TEST_CASE(ez_pool, LockFreeAllocFree);
+    RUN_TEST_CASE(ez_pool, StressLockFree);
+}
+
+
+TEST(ez_pool, Init)
+{
+    TEST_ASSERT_FALSE(ezPool_Init(NULL, test_buffer, sizeof(test_buffer), sizeof(TestObject), NUM_OF_OBJS, false));
+    TEST_ASSERT_FALSE(ezPool_Init(&pool, NULL, sizeof(test_buffer), sizeof(TestObject), NUM_OF_OBJS, false));
+    TEST_ASSERT_FALSE(ezPool_Init(&pool, test_buffer, sizeof(test_buffer), 0, NUM_OF_OBJS, false));
+    TEST_ASSERT_FALSE(ezPool_Init(&pool, test_buffer, sizeof(test_buffer), sizeof(TestObject), 0, false));
+    TEST_ASSERT_FALSE(ezPool_Init(&pool, test_buffer, sizeof(test_buffer) - 1U, sizeof(TestObject), NUM_OF_OBJS, false));
+    TEST_ASSERT_FALSE(ezPool_Init(&pool, (uint8_t *)test_buffer + 1, sizeof(test_buffer) - 4U, sizeof(TestObject), 4, false));
+    TEST_ASSERT_FALSE(ezPool_Init(&pool, test_buffer, sizeof(test_buffer), 1, EZ_POOL_LOCK_FREE_MAX_OBJS + 1U, true));
+
+    TEST_ASSERT_TRUE(ezPool_Init(&pool, test_buffer, sizeof(test_buffer), sizeof(TestObject), NUM_OF_OBJS, false));
+    TEST_ASSERT_EQUAL(NUM_OF_OBJS, ezPool_GetNumOfFree(&pool));
+}
+
+
+TEST(ez_pool, BitmapAllocFree)
+{
+    TestObject *objs[NUM_OF_OBJS];
+
+    TEST_ASSERT_TRUE(ezPool_Init(&pool, test_buffer, sizeof(test_buffer), sizeof(TestObject), NUM_OF_OBJS, false));
+
+    /* objects are handed out lowest address first */
+    for (uint32_t i = 0; i < NUM_OF_OBJS; i++)
+    {
+        objs[i] = (TestObject *)ezPool_Alloc(&pool);
+        TEST_ASSERT_NOT_NULL(objs[i]);
+        TEST_ASSERT_EQUAL(0U, (uintptr_t)objs[i] % sizeof(uint32_t));
+        if (i > 0U)
+        {
+            TEST_ASSERT_EQUAL_PTR((uint8_t *)objs[i - 1U] + EZ_POOL_OBJ_SIZE(sizeof(TestObject)), objs[i]);
+        }
+        memset(objs[i], (int)i, sizeof(TestObject));
+    }
+    TEST_ASSERT_NULL(ezPool_Alloc(&pool));
+    TEST_ASSERT_EQUAL(0U, ezPool_GetNumOfFree(&pool));
+
+    /* the lowest free object is reused, also across bitmap words */
+    TEST_ASSERT_TRUE(ezPool_Free(&pool, objs[35]));
+    TEST_ASSERT_TRUE(ezPool_Free(&pool, objs[3]));
+    TEST_ASSERT_EQUAL(2U, ezPool_GetNumOfFree(&pool));
+    TEST_ASSERT_EQUAL_PTR(objs[3], ezPool_Alloc(&pool));
+    TEST_ASSERT_EQUAL_PTR(objs[35], ezPool_Alloc(&pool));
+    TEST_ASSERT_NULL(ezPool_Alloc(&pool));
+
+    /* neighbours are untouched */
+    TEST_ASSERT_EQUAL_UINT8(2, ((uint8_t *)objs[2])[sizeof(TestObject) - 1U]);
+    TEST_ASSERT_EQUAL_UINT8(4, ((uint8_t *)objs[4])[0]);
+
+    for (uint32_t i = 0; i < NUM_OF_OBJS; i++)
+    {
+        TEST_ASSERT_TRUE(ezPool_Free(&pool, objs[i]));
+    }
+    TEST_ASSERT_EQUAL(NUM_OF_OBJS, ezPool_GetNumOfFree(&pool));
+}
+
+
+TEST(ez_pool, BitmapInvalidFree)
+{
+    TestObject local;
+    TestObject *obj = NULL;
+
+    TEST_ASSERT_TRUE(ezPool_Init(&pool, test_buffer, sizeof(test_buffer), sizeof(TestObject), NUM_OF_OBJS, false));
+    obj = (TestObject *)ezPool_Alloc(&pool);
+    TEST_ASSERT_NOT_NULL(obj);
+
+    TEST_ASSERT_FALSE(ezPool_Free(&pool, NULL));
+    TEST_ASSERT_FALSE(ezPool_Free(&pool, &local));
+    TEST_ASSERT_FALSE(ezPool_Free(&pool, (uint8_t *)obj + 1));
+    TEST_ASSERT_FALSE(ezPool_Free(&pool, test_buffer));
+    TEST_ASSERT_TRUE(ezPool_Free(&pool, obj));
+    TEST_ASSERT_FALSE(ezPool_Free(&pool, obj));
+    TEST_ASSERT_EQUAL(NUM_OF_OBJS, ezPool_GetNumOfFree(&pool));
+}
+
+
+TEST(ez_pool, AlignedObjects)
+{
+    PtrObject *objs[NUM_OF_PTR_OBJS];
+    PtrObject *prev = NULL;
+
+    /* a buffer starting at 4 mod 8, the pool has to align it itself */
+    uint32_t *buff = ((uintptr_t)ptr_buffer % 8U == 0U) ? &ptr_buffer[1] : &ptr_buffer[0];
+
+    for(uint32_t mode = 0; mode < 2U; mode++)
+    {
+        TEST_ASSERT_TRUE(ezPool_Init(&pool, buff,
+                                     EZ_POOL_BUFFER_WORDS(sizeof(PtrObject), NUM_OF_PTR_OBJS) * sizeof(uint32_t),
+                                     sizeof(PtrObject), NUM_OF_PTR_OBJS, mode == 1U));
+
+        prev = NULL;
+        for(uint32_t i = 0; i < NUM_OF_PTR_OBJS; i++)
+        {
+            objs[i] = (PtrObject *)ezPool_Alloc(&pool);
+            TEST_ASSERT_NOT_NULL(objs[i]);
+            TEST_ASSERT_EQUAL_UINT32(0U, (uint32_t)((uintptr_t)objs[i] % CONFIG_EZ_POOL_ALIGNMENT));
+            objs[i]->next = prev;
+            objs[i]->stamp = 0x0123456789ABCDEFULL + i;
+            objs[i]->flag = (uint8_t)i;
+            prev = objs[i];
+        }
+        TEST_ASSERT_NULL(ezPool_Alloc(&pool));
+
+        for(uint32_t i = NUM_OF_PTR_OBJS; i > 0U; i--)
+        {
+            TEST_ASSERT_EQUAL_PTR((i > 1U) ? objs[i - 2U] : NULL, objs[i - 1U]->next);
+            TEST_ASSERT_TRUE(objs[i - 1U]->stamp == 0x0123456789ABCDEFULL + (i - 1U));
+            TEST_ASSERT_TRUE(ezPool_Free(&pool, objs[i - 1U]));
+        }
+        TEST_ASSERT_EQUAL(NUM_OF_PTR_OBJS, ezPool_GetNumOfFree(&pool));
+    }
+}
+
+
+TEST(ez_pool, LockFreeAllocFree)
+{
+    TestObject *objs[NUM_OF_OBJS];
+
+    TEST_ASSERT_TRUE(ezPool_Init(&pool, test_buffer, sizeof(test_buffer), sizeof(TestObject), NUM_OF_OBJS, true));
+
+    for (uint32_t i = 0; i < NUM_OF_OBJS; i++)
+    {
+        objs[i] = (TestObject *)ezPool_Alloc(&pool);
+        TEST_ASSERT_NOT_NULL(objs[i]);
+        objs[i]->owner = i;
+    }
+    TEST_ASSERT_NULL(ezPool_Alloc(&pool));
+    TEST_ASSERT_EQUAL(0U, ezPool_GetNumOfFree(&pool));
+
+    for (uint32_t i = 0; i < NUM_OF_OBJS; i++)
+    {
+        TEST_ASSERT_EQUAL(i, objs[i]->owner);
+    }
+
+    /* last freed object is handed out first */
+    TEST_ASSERT_TRUE(ezPool_Free(&pool, objs[7]));
+    TEST_ASSERT_TRUE(ezPool_Free(&pool, objs[20]));
+    TEST_ASSERT_FALSE(ezPool_Free(&pool, (uint8_t *)objs[1] + 2));
+    TEST_ASSERT_EQUAL_PTR(objs[20], ezPool_Alloc(&pool));
+    TEST_ASSERT_EQUAL_PTR(objs[7], ezPool_Alloc(&pool));
+
+    for (uint32_t i = 0; i < NUM_OF_OBJS; i++)
+    {
+        TEST_ASSERT_TRUE(ezPool_Free(&pool, objs[i]));
+    }
+    TEST_ASSERT_EQUAL(NUM_OF_OBJS, ezPool_GetNumOfFree(&pool));
+}
+
+
+TEST(ez_pool, StressLockFree)
+{
+    pthread_t threads[STRESS_NUM_OF_THREADS];
+    uint32_t ids[STRESS_NUM_OF_THREADS];
+    uint32_t errors[STRESS_NUM_OF_THREADS];
+
+    TEST_ASSERT_TRUE(ezPool_Init(&pool, stress_buffer, sizeof(stress_buffer),
+                                 sizeof(TestObject), STRESS_NUM_OF_OBJS, true));
+
+    for (uint32_t i = 0; i < STRESS_NUM_OF_THREADS; i++)
+    {
+        ids[i] = i;
+        TEST_ASSERT_EQUAL(0, pthread_create(&threads[i], NULL, Worker, &ids[i]));
+    }
+
+    for (uint32_t i = 0; i < STRESS_NUM_OF_THREADS; i++)
+    {
+        void *result = NULL;
+        TEST_ASSERT_EQUAL(0, pthread_join(threads[i], &result));
+        errors[i] = (uint32_t)(uintptr_t)result;
+    }
+
+    for (uint32_t i = 0; i < STRESS_NUM_OF_THREADS; i++)
+    {
+        TEST_ASSERT_EQUAL(0U, errors[i]);
+    }
+    TEST_ASSERT_EQUAL(STRESS_NUM_OF_OBJS, ezPool_GetNumOfFree(&pool));
+}
+
+
+/******************************************************************************
+* Internal functions
+*******************************************************************************/
+static void RunAllTests(void)
+{
+    RUN_TEST_GROUP(ez_pool);
+}
+
+
+static void *Worker(void *arg)
+{
+    uint32_t id = *(uint32_t *)arg;
+    uintptr_t errors = 0U;
+    TestObject *held[STRESS_HOLD];
+
+    for (uint32_t round = 0; round < STRESS_NUM_OF_ROUNDS; round++)
+    {
+        for (uint32_t i = 0; i < STRESS_HOLD; i++)
+        {
+            while ((held[i] = (TestObject *)ezPool_Alloc(&pool)) == NULL)
+            {
+                (void)sched_yield();
+            }
+            held[i]->owner = id;
+            held[i]->payload[0] = (uint8_t)round;
+        }
+
+        /* Nobody else may have got the same objects */
+        for (uint32_t i = 0; i < STRESS_HOLD; i++)
+        {
+            if (held[i]->owner != id || held[i]->payload[0] != (uint8_t)round)
+            {
+                errors++;
+            }
+            if (!ezPool_Free(&pool, held[i]))
+            {
+                errors++;
+            }
+        }
+    }
+
+    return (void *)errors;
+}
+
+
+/* End of file */
@@ -0,0 +1,356 @@
+/*****************************************************************************
+* Filename:         unittest_ez_priority_queue.c
+* Author:           Hai Nguyen
+* Original Date:    16.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   unittest_ez_priority_queue.c
+ *  @author Hai Nguyen
+ *  @date   16.10.2026
+ *  @brief  Unit test for the priority queue
+ *
+ *  @details
+ */
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "unity.h"
+#include "unity_fixture.h"
+#include "ez_priority_queue.h"
+
+TEST_GROUP(ez_priority_queue);
+
+/******************************************************************************
+* Module Preprocessor Macros
+*******************************************************************************/
+#define CAPACITY        16U
+#define NUM_OF_RANDOM   2000U
+#define NUM_OF_PTR_JOBS 5U      /**< odd, the heap does not end aligned */
+
+
+/******************************************************************************
+* Module Typedefs
+*******************************************************************************/
+typedef struct
+{
+    uint32_t id;
+    uint8_t payload[5];
+}Job;
+
+typedef struct
+{
+    void *context;
+    uint64_t deadline;
+    uint8_t tag;
+}PtrJob;
+
+
+/******************************************************************************
+* Module Variable Definitions
+*******************************************************************************/
+static uint32_t pq_buff[EZ_PRIORITY_QUEUE_BUFFER_WORDS(sizeof(Job), CAPACITY)];
+static uint32_t ptr_buff[EZ_PRIORITY_QUEUE_BUFFER_WORDS(sizeof(PtrJob), NUM_OF_PTR_JOBS) + 1U];
+static ezPriorityQueue pq;
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+static void RunAllTests(void);
+static void PushJob(uint32_t id, uint32_t priority, ezPriorityQueueHandle *handle);
+
+
+/******************************************************************************
+* External functions
+*******************************************************************************/
+int main(int argc, const char *argv[])
+{
+    return UnityMain(argc, argv, RunAllTests);
+}
+
+
+TEST_SETUP(ez_priority_queue)
+{
+    TEST_ASSERT_TRUE(ezPriorityQueue_Init(&pq, pq_buff, sizeof(pq_buff), sizeof(Job), CAPACITY));
+}
+
+
+TEST_TEAR_DOWN(ez_priority_queue)
+{
+}
+
+
+TEST_GROUP_RUNNER(ez_priority_queue)
+{
+    RUN_TEST_CASE(ez_priority_queue, Init);
+    RUN_TEST_CASE(ez_priority_queue, PopInPriorityOrder);
+    RUN_TEST_CASE(ez_priority_queue, StableWithinPriority);
+    RUN_TEST_CASE(ez_priority_queue, Full);
+    RUN_TEST_CASE(ez_priority_queue, DecreaseKey);
+    RUN_TEST_CASE(ez_priority_queue, Random);
+    RUN_TEST_CASE(ez_priority_queue, AlignedElements);
+}
+
+
+TEST(ez_priority_queue, Init)
+{
+    Job job;
+
+    TEST_ASSERT_FALSE(ezPriorityQueue_Init(NULL, pq_buff, sizeof(pq_buff), sizeof(Job), CAPACITY));
+    TEST_ASSERT_FALSE(ezPriorityQueue_Init(&pq, NULL, sizeof(pq_buff), sizeof(Job), CAPACITY));
+    TEST_ASSERT_FALSE(ezPriorityQueue_Init(&pq, pq_buff, sizeof(pq_buff), 0U, CAPACITY));
+    TEST_ASSERT_FALSE(ezPriorityQueue_Init(&pq, pq_buff, sizeof(pq_buff), sizeof(Job), 0U));
+    TEST_ASSERT_FALSE(ezPriorityQueue_Init(&pq, pq_buff, sizeof(pq_buff) - 1U, sizeof(Job), CAPACITY));
+    TEST_ASSERT_FALSE(ezPriorityQueue_Init(&pq, (uint8_t *)pq_buff + 1, sizeof(pq_buff) - 4U, sizeof(Job), 4U));
+
+    TEST_ASSERT_TRUE(ezPriorityQueue_Init(&pq, pq_buff, sizeof(pq_buff), sizeof(Job), CAPACITY));
+    TEST_ASSERT_EQUAL(0U, ezPriorityQueue_GetNumOfElement(&pq));
+    TEST_ASSERT_EQUAL(0U, ezPriorityQueue_GetNumOfElement(NULL));
+    TEST_ASSERT_NULL(ezPriorityQueue_Peek(&pq, NULL));
+    TEST_ASSERT_FALSE(ezPriorityQueue_Pop(&pq, &job, NULL));
+    TEST_ASSERT_FALSE(ezPriorityQueue_Push(&pq, NULL, 0U, NULL));
+}
+
+
+TEST(ez_priority_queue, PopInPriorityOrder)
+{
+    static const uint32_t priorities[] = { 7U, 3U, 9U, 0U, 5U, 1U };
+    Job job;
+    uint32_t priority = 0U;
+    Job *front = NULL;
+
+    for(uint32_t i = 0; i < sizeof(priorities) / sizeof(priorities[0]); i++)
+    {
+        PushJob(i, priorities[i], NULL);
+    }
+    TEST_ASSERT_EQUAL(6U, ezPriorityQueue_GetNumOfElement(&pq));
+
+    front = (Job *)ezPriorityQueue_Peek(&pq, &priority);
+    TEST_ASSERT_NOT_NULL(front);
+    TEST_ASSERT_EQUAL_UINT32(0U, priority);
+    TEST_ASSERT_EQUAL_UINT32(3U, front->id);
+
+    TEST_ASSERT_TRUE(ezPriorityQueue_Pop(&pq, &job, &priority));
+    TEST_ASSERT_EQUAL_UINT32(3U, job.id);
+    TEST_ASSERT_EQUAL_UINT8(3U, job.payload[4]);
+    TEST_ASSERT_TRUE(ezPriorityQueue_Pop(&pq, &job, &priority));
+    TEST_ASSERT_EQUAL_UINT32(1U, priority);
+    TEST_ASSERT_TRUE(ezPriorityQueue_Pop(&pq, &job, &priority));
+    TEST_ASSERT_EQUAL_UINT32(3U, priority);
+    TEST_ASSERT_TRUE(ezPriorityQueue_Pop(&pq, &job, &priority));
+    TEST_ASSERT_EQUAL_UINT32(5U, priority);
+    TEST_ASSERT_TRUE(ezPriorityQueue_Pop(&pq, &job, &priority));
+    TEST_ASSERT_EQUAL_UINT32(7U, priority);
+    TEST_ASSERT_TRUE(ezPriorityQueue_Pop(&pq, &job, NULL));
+    TEST_ASSERT_EQUAL_UINT32(2U, job.id);
+    TEST_ASSERT_FALSE(ezPriorityQueue_Pop(&pq, &job, NULL));
+}
+
+
+TEST(ez_priority_queue, StableWithinPriority)
+{
+    Job job;
+
+    /* bulk work first, then urgent work, interleaved */
+    for(uint32_t i = 0; i < 10U; i++)
+    {
+        PushJob(i, (i % 2U == 0U) ? 5U : 1U, NULL);
+    }
+
+    for(uint32_t i = 1; i < 10U; i += 2U)
+    {
+        TEST_ASSERT_TRUE(ezPriorityQueue_Pop(&pq, &job, NULL));
+        TEST_ASSERT_EQUAL_UINT32(i, job.id);
+    }
+    for(uint32_t i = 0; i < 10U; i += 2U)
+    {
+        TEST_ASSERT_TRUE(ezPriorityQueue_Pop(&pq, &job, NULL));
+        TEST_ASSERT_EQUAL_UINT32(i, job.id);
+    }
+}
+
+
+TEST(ez_priority_queue, Full)
+{
+    Job job = { 0U, { 0U } };
+
+    for(uint32_t i = 0; i < CAPACITY; i++)
+    {
+        PushJob(i, CAPACITY - i, NULL);
+    }
+    TEST_ASSERT_FALSE(ezPriorityQueue_Push(&pq, &job, 0U, NULL));
+
+    /* a freed slot is reused */
+    TEST_ASSERT_TRUE(ezPriorityQueue_Pop(&pq, &job, NULL));
+    TEST_ASSERT_EQUAL_UINT32(CAPACITY - 1U, job.id);
+    PushJob(100U, 0U, NULL);
+    TEST_ASSERT_TRUE(ezPriorityQueue_Pop(&pq, &job, NULL));
+    TEST_ASSERT_EQUAL_UINT32(100U, job.id);
+    TEST_ASSERT_EQUAL(CAPACITY - 1U, ezPriorityQueue_GetNumOfElement(&pq));
+}
+
+
+TEST(ez_priority_queue, DecreaseKey)
+{
+    ezPriorityQueueHandle handles[4];
+    ezPriorityQueueHandle popped = 0U;
+    Job job;
+    uint32_t priority = 0U;
+
+    PushJob(0U, 2U, &handles[0]);
+    PushJob(1U, 2U, &handles[1]);
+    PushJob(2U, 8U, &handles[2]);
+    PushJob(3U, 9U, &handles[3]);
+
+    TEST_ASSERT_FALSE(ezPriorityQueue_DecreaseKey(NULL, handles[3], 1U));
+    TEST_ASSERT_FALSE(ezPriorityQueue_DecreaseKey(&pq, CAPACITY, 1U));
+    TEST_ASSERT_FALSE(ezPriorityQueue_DecreaseKey(&pq, handles[2], 9U));
+
+    /* job 3 becomes most urgent, job 2 joins priority 2 behind the older jobs */
+    TEST_ASSERT_TRUE(ezPriorityQueue_DecreaseKey(&pq, handles[3], 1U));
+    TEST_ASSERT_TRUE(ezPriorityQueue_DecreaseKey(&pq, handles[2], 2U));
+
+    TEST_ASSERT_TRUE(ezPriorityQueue_Pop(&pq, &job, &priority));
+    TEST_ASSERT_EQUAL_UINT32(3U, job.id);
+    TEST_ASSERT_EQUAL_UINT32(1U, priority);
+    popped = handles[3];
+    TEST_ASSERT_FALSE(ezPriorityQueue_DecreaseKey(&pq, popped, 0U));
+
+    for(uint32_t i = 0; i < 3U; i++)
+    {
+        TEST_ASSERT_TRUE(ezPriorityQueue_Pop(&pq, &job, &priority));
+        TEST_ASSERT_EQUAL_UINT32(i, job.id);
+        TEST_ASSERT_EQUAL_UINT32(2U, priority);
+    }
+}
+
+
+TEST(ez_priority_queue, Random)
+{
+    ezPriorityQueueHandle handles[CAPACITY];
+    uint32_t live = 0U;
+    uint32_t seed = 1U;
+    uint32_t last_priority = 0U;
+    uint32_t last_id = 0U;
+    uint32_t next_id = 0U;
+    uint32_t priority = 0U;
+    Job job;
+
+    for(uint32_t op = 0; op < NUM_OF_RANDOM; op++)
+    {
+        seed = seed * 1103515245U + 12345U;
+        if(live < CAPACITY && ((seed >> 16) % 3U) != 0U)
+        {
+            PushJob(next_id, (seed >> 8) % 8U, &handles[live]);
+            next_id++;
+            live++;
+        }
+        else if(live > 0U && ((seed >> 20) % 2U) == 0U)
+        {
+            /* decrease an element which may have been popped, the handle is
+             * then rejected or refers to a newer element */
+            (void)ezPriorityQueue_DecreaseKey(&pq, handles[(seed >> 4) % live], 0U);
+        }
+        else
+        {
+            live = ezPriorityQueue_GetNumOfElement(&pq);
+            if(live > 0U)
+            {
+                TEST_ASSERT_TRUE(ezPriorityQueue_Pop(&pq, &job, &priority));
+                live--;
+            }
+        }
+        live = ezPriorityQueue_GetNumOfElement(&pq);
+    }
+
+    /* drained in priority order, ids ascending within a priority */
+    last_priority = 0U;
+    last_id = 0U;
+    while(ezPriorityQueue_Pop(&pq, &job, &priority))
+    {
+        TEST_ASSERT_TRUE(priority >= last_priority);
+        if(priority == last_priority)
+        {
+            TEST_ASSERT_TRUE(job.id >= last_id);
+        }
+        last_priority = priority;
+        last_id = job.id;
+    }
+}
+
+
+TEST(ez_priority_queue, AlignedElements)
+{
+    PtrJob job;
+    PtrJob *peeked = NULL;
+    uint32_t priority = 0U;
+
+    /* a buffer starting at 4 mod 8, the queue has to align it itself */
+    uint32_t *buff = ((uintptr_t)ptr_buff % 8U == 0U) ? &ptr_buff[1] : &ptr_buff[0];
+
+    TEST_ASSERT_TRUE(ezPriorityQueue_Init(&pq, buff,
+                                          EZ_PRIORITY_QUEUE_BUFFER_WORDS(sizeof(PtrJob), NUM_OF_PTR_JOBS) * sizeof(uint32_t),
+                                          sizeof(PtrJob), NUM_OF_PTR_JOBS));
+
+    for(uint32_t i = 0; i < NUM_OF_PTR_JOBS; i++)
+    {
+        job.context = &ptr_buff[i];
+        job.deadline = 0x100000000ULL + i;
+        job.tag = (uint8_t)i;
+        TEST_ASSERT_TRUE(ezPriorityQueue_Push(&pq, &job, NUM_OF_PTR_JOBS - i, NULL));
+
+        /* the element is read in place through a pointer of its type */
+        peeked = (PtrJob *)ezPriorityQueue_Peek(&pq, &priority);
+        TEST_ASSERT_NOT_NULL(peeked);
+        TEST_ASSERT_EQUAL(0U, (uintptr_t)peeked % CONFIG_EZ_PRIORITY_QUEUE_ALIGNMENT);
+        TEST_ASSERT_EQUAL(0U, (uintptr_t)peeked % _Alignof(PtrJob));
+        TEST_ASSERT_EQUAL_PTR(&ptr_buff[i], peeked->context);
+        TEST_ASSERT_TRUE(peeked->deadline == 0x100000000ULL + i);
+        TEST_ASSERT_EQUAL_UINT8(i, peeked->tag);
+        TEST_ASSERT_EQUAL(NUM_OF_PTR_JOBS - i, priority);
+    }
+
+    for(uint32_t i = NUM_OF_PTR_JOBS; i > 0U; i--)
+    {
+        peeked = (PtrJob *)ezPriorityQueue_Peek(&pq, NULL);
+        TEST_ASSERT_EQUAL(0U, (uintptr_t)peeked % CONFIG_EZ_PRIORITY_QUEUE_ALIGNMENT);
+        TEST_ASSERT_TRUE(ezPriorityQueue_Pop(&pq, &job, &priority));
+        TEST_ASSERT_EQUAL_PTR(&ptr_buff[i - 1U], job.context);
+        TEST_ASSERT_EQUAL_UINT8(i - 1U, job.tag);
+    }
+    TEST_ASSERT_EQUAL(0U, ezPriorityQueue_GetNumOfElement(&pq));
+}
+
+
+/******************************************************************************
+* Internal functions
+*******************************************************************************/
+static void RunAllTests(void)
+{
+    RUN_TEST_GROUP(ez_priority_queue);
+}
+
+
+static void PushJob(uint32_t id, uint32_t priority, ezPriorityQueueHandle *handle)
+{
+    Job job;
+
+    job.id = id;
+    memset(job.payload, (int)(id & 0xFFU), sizeof(job.payload));
+    TEST_ASSERT_TRUE(ezPriorityQueue_Push(&pq, &job, priority, handle));
+}
+
+
+/* End of file */
@@ -37,6 +37,7 @@ TEST_GROUP(ez_queue);
 * Module Preprocessor Macros
 *******************************************************************************/
 #define BUFF_SIZE     256   /**< Test buffer size */
+#define NUM_OF_BLOCKS 16U   /**< Block descriptors of a queue owning them */
 
 /******************************************************************************
 * Module Typedefs
@@ -59,6 +60,8 @@ static uint8_t item_4[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
 * Function Definitions
 *******************************************************************************/
 static void RunAllTests(void);
+static bool SumUntilZero(void *data, uint32_t data_size, void *context);
+static bool PushCopy(void *data, uint32_t data_size, void *context);
 
 
 /******************************************************************************
@@ -92,6 +95,15 @@ TEST_GROUP_RUNNER(ez_queue)
     RUN_TEST_CASE(ez_queue, GetBackPop);
     RUN_TEST_CASE(ez_queue, OverflowQueue);
     RUN_TEST_CASE(ez_queue, ezQueue_ReserveElement);
+    RUN_TEST_CASE(ez_queue, LargeBuffer);
+    RUN_TEST_CASE(ez_queue, ReserveElementAligned);
+    RUN_TEST_CASE(ez_queue, SingleBlockElement);
+    RUN_TEST_CASE(ez_queue, EmptyElement);
+    RUN_TEST_CASE(ez_queue, PushBatch);
+    RUN_TEST_CASE(ez_queue, Drain);
+    RUN_TEST_CASE(ez_queue, MoveFrontShared);
+    RUN_TEST_CASE(ez_queue, MoveFrontCopy);
+    RUN_TEST_CASE(ez_queue, OwnBlocks);
 }
 
 
@@ -106,6 +118,13 @@ TEST(ez_queue, CreateQueueFail)
 
     status = ezQueue_CreateQueue(&queue, queue_buff, 0);
     TEST_ASSERT_EQUAL(ezFAIL, status);
+
+    /* no descriptor, or no room left behind the carved descriptors */
+    status = ezQueue_CreateQueueWithBlocks(&queue, queue_buff, BUFF_SIZE, NULL, 0U);
+    TEST_ASSERT_EQUAL(ezFAIL, status);
+
+    status = ezQueue_CreateQueueWithBlocks(&queue, queue_buff, sizeof(struct MemBlock) * 2U, NULL, 2U);
+    TEST_ASSERT_EQUAL(ezFAIL, status);
 }
 
 
@@ -414,6 +433,316 @@ TEST(ez_queue, ezQueue_ReserveElement)
     TEST_ASSERT_EQUAL(0, ezQueue_GetNumOfElement(&queue));
 }
 
+TEST(ez_queue, LargeBuffer)
+{
+    static uint8_t large_buff[128U * 1024U];
+    uint8_t *data = NULL;
+    uint32_t data_size = 0U;
+    ezReservedElement elem = NULL;
+
+#if (CONFIG_EZ_STATIC_ALLOC_16BIT_SIZE == 0U)
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_CreateQueue(&queue, large_buff, sizeof(large_buff)));
+
+    /* more than 64 KiB in one element */
+    elem = ezQueue_ReserveElement(&queue, (void **)&data, 100000U);
+    TEST_ASSERT_NOT_NULL(elem);
+    memset(data, 0x5A, 100000U);
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_PushReservedElement(&queue, elem));
+    TEST_ASSERT_EQUAL(ezFAIL, ezQueue_Push(&queue, item_1, sizeof(large_buff)));
+
+    data = NULL;
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_GetFront(&queue, (void **)&data, &data_size));
+    TEST_ASSERT_EQUAL_UINT32(100000U, data_size);
+    TEST_ASSERT_EQUAL_UINT8(0x5A, data[99999]);
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_PopFront(&queue));
+    TEST_ASSERT_EQUAL(0, ezQueue_GetNumOfElement(&queue));
+#else
+    /* buffers and elements above 65535 bytes are rejected */
+    TEST_ASSERT_EQUAL(ezFAIL, ezQueue_CreateQueue(&queue, large_buff, sizeof(large_buff)));
+    TEST_ASSERT_EQUAL(ezFAIL, ezQueue_CreateQueue(&queue, large_buff, 0x10000U));
+
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_CreateQueue(&queue, large_buff, 0xFFFFU));
+    TEST_ASSERT_NULL(ezQueue_ReserveElement(&queue, (void **)&data, 100000U));
+    TEST_ASSERT_NULL(ezQueue_ReserveElement(&queue, (void **)&data, 0x10000U));
+    TEST_ASSERT_EQUAL(ezFAIL, ezQueue_Push(&queue, item_1, 0x10000U));
+
+    elem = ezQueue_ReserveElement(&queue, (void **)&data, 60000U);
+    TEST_ASSERT_NOT_NULL(elem);
+    memset(data, 0x5A, 60000U);
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_PushReservedElement(&queue, elem));
+    data = NULL;
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_GetFront(&queue, (void **)&data, &data_size));
+    TEST_ASSERT_EQUAL_UINT32(60000U, data_size);
+    TEST_ASSERT_EQUAL_UINT8(0x5A, data[59999]);
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_PopFront(&queue));
+    TEST_ASSERT_EQUAL(0, ezQueue_GetNumOfElement(&queue));
+#endif /* CONFIG_EZ_STATIC_ALLOC_16BIT_SIZE == 0U */
+}
+
+TEST(ez_queue, ReserveElementAligned)
+{
+    uint8_t *data = NULL;
+    uint32_t data_size = 0U;
+    ezReservedElement elem = NULL;
+
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_CreateQueue(&queue, queue_buff, BUFF_SIZE));
+    TEST_ASSERT_NULL(ezQueue_ReserveElementAligned(&queue, (void **)&data, 8, 3));
+
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_Push(&queue, item_1, sizeof(item_1)));
+    elem = ezQueue_ReserveElementAligned(&queue, (void **)&data, sizeof(item_2), 32);
+    TEST_ASSERT_NOT_NULL(elem);
+    TEST_ASSERT_EQUAL_UINT32(0U, (uint32_t)((uintptr_t)data % 32U));
+    memcpy(data, item_2, sizeof(item_2));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_PushReservedElement(&queue, elem));
+
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_PopFront(&queue));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_GetFront(&queue, (void **)&data, &data_size));
+    TEST_ASSERT_EQUAL_UINT32(sizeof(item_2), data_size);
+    TEST_ASSERT_EQUAL_MEMORY(item_2, data, sizeof(item_2));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_PopFront(&queue));
+    TEST_ASSERT_EQUAL(0, ezQueue_GetNumOfElement(&queue));
+}
+
+TEST(ez_queue, SingleBlockElement)
+{
+    uint8_t *data = NULL;
+    ezReservedElement elem = NULL;
+
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_CreateQueue(&queue, queue_buff, BUFF_SIZE));
+
+    /* header and data share one block, which keeps the header aligned */
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_Push(&queue, item_1, sizeof(item_1)));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_Push(&queue, item_3, sizeof(item_3)));
+    TEST_ASSERT_EQUAL(2U, ezStaticAlloc_GetNumOfAllocBlock(&queue.mem_list));
+    TEST_ASSERT_EQUAL(2U, ezQueue_GetNumOfElement(&queue));
+
+    elem = ezQueue_ReserveElement(&queue, (void **)&data, sizeof(item_2));
+    TEST_ASSERT_NOT_NULL(elem);
+    TEST_ASSERT_EQUAL_UINT32(0U, (uint32_t)((uintptr_t)elem % sizeof(void *)));
+    TEST_ASSERT_EQUAL(3U, ezStaticAlloc_GetNumOfAllocBlock(&queue.mem_list));
+    TEST_ASSERT_EQUAL(2U, ezQueue_GetNumOfElement(&queue));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_ReleaseReservedElement(&queue, elem));
+
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_PopBack(&queue));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_PopFront(&queue));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_PopFront(&queue));
+    TEST_ASSERT_EQUAL(0U, ezQueue_GetNumOfElement(&queue));
+    TEST_ASSERT_EQUAL(0U, ezStaticAlloc_GetNumOfAllocBlock(&queue.mem_list));
+    TEST_ASSERT_EQUAL(1U, ezStaticAlloc_GetNumOfFreeBlock(&queue.mem_list));
+}
+
+TEST(ez_queue, EmptyElement)
+{
+    uint8_t *data = NULL;
+    uint32_t data_size = 1U;
+    ezReservedElement elem = NULL;
+
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_CreateQueue(&queue, queue_buff, BUFF_SIZE));
+
+    /* an element without data still occupies a place in the queue */
+    elem = ezQueue_ReserveElement(&queue, (void **)&data, 0U);
+    TEST_ASSERT_NOT_NULL(elem);
+    TEST_ASSERT_NOT_NULL(data);
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_PushReservedElement(&queue, elem));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_Push(&queue, item_1, sizeof(item_1)));
+    TEST_ASSERT_EQUAL(2U, ezQueue_GetNumOfElement(&queue));
+
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_GetFront(&queue, (void **)&data, &data_size));
+    TEST_ASSERT_EQUAL_UINT32(0U, data_size);
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_PopFront(&queue));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_GetFront(&queue, (void **)&data, &data_size));
+    TEST_ASSERT_EQUAL_UINT32(sizeof(item_1), data_size);
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_PopFront(&queue));
+    TEST_ASSERT_EQUAL(0U, ezStaticAlloc_GetNumOfAllocBlock(&queue.mem_list));
+}
+
+TEST(ez_queue, PushBatch)
+{
+    uint8_t *data = NULL;
+    uint32_t data_size = 0U;
+    static uint8_t too_large[BUFF_SIZE];
+    ezQueueBatchElement elements[] = {
+        { item_1, sizeof(item_1) },
+        { item_2, sizeof(item_2) },
+        { item_3, sizeof(item_3) },
+    };
+    ezQueueBatchElement failing[] = {
+        { item_4, sizeof(item_4) },
+        { too_large, sizeof(too_large) },
+    };
+
+    TEST_ASSERT_EQUAL(ezFAIL, ezQueue_PushBatch(NULL, elements, 3));
+    TEST_ASSERT_EQUAL(ezFAIL, ezQueue_PushBatch(&queue, NULL, 3));
+    TEST_ASSERT_EQUAL(ezFAIL, ezQueue_PushBatch(&queue, elements, 0));
+
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_Push(&queue, item_4, sizeof(item_4)));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_PushBatch(&queue, elements, 3));
+    TEST_ASSERT_EQUAL(4U, ezQueue_GetNumOfElement(&queue));
+
+    /* all or nothing */
+    TEST_ASSERT_EQUAL(ezFAIL, ezQueue_PushBatch(&queue, failing, 2));
+    TEST_ASSERT_EQUAL(4U, ezQueue_GetNumOfElement(&queue));
+    TEST_ASSERT_EQUAL(4U, ezStaticAlloc_GetNumOfAllocBlock(&queue.mem_list));
+
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_GetBack(&queue, (void **)&data, &data_size));
+    TEST_ASSERT_EQUAL_UINT32(sizeof(item_3), data_size);
+    TEST_ASSERT_EQUAL_MEMORY(item_3, data, sizeof(item_3));
+
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_PopFront(&queue));
+    for (uint32_t i = 0; i < 3U; i++)
+    {
+        TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_GetFront(&queue, (void **)&data, &data_size));
+        TEST_ASSERT_EQUAL_UINT32(elements[i].data_size, data_size);
+        TEST_ASSERT_EQUAL_MEMORY(elements[i].data, data, data_size);
+        TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_PopFront(&queue));
+    }
+    TEST_ASSERT_EQUAL(0U, ezQueue_GetNumOfElement(&queue));
+    TEST_ASSERT_EQUAL(1U, ezStaticAlloc_GetNumOfFreeBlock(&queue.mem_list));
+}
+
+TEST(ez_queue, Drain)
+{
+    static uint8_t drain_buff[2048];
+    uint32_t sum = 0U;
+    uint32_t value = 0U;
+
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_CreateQueue(&queue, drain_buff, sizeof(drain_buff)));
+    TEST_ASSERT_EQUAL(0U, ezQueue_Drain(NULL, EZ_QUEUE_DRAIN_ALL, SumUntilZero, &sum));
+    TEST_ASSERT_EQUAL(0U, ezQueue_Drain(&queue, EZ_QUEUE_DRAIN_ALL, NULL, &sum));
+    TEST_ASSERT_EQUAL(0U, ezQueue_Drain(&queue, EZ_QUEUE_DRAIN_ALL, SumUntilZero, &sum));
+
+    /* more elements than CONFIG_EZ_QUEUE_DRAIN_BATCH */
+    for (value = 1U; value <= 20U; value++)
+    {
+        TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_Push(&queue, &value, sizeof(value)));
+    }
+    value = 0U;
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_Push(&queue, &value, sizeof(value)));
+    value = 100U;
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_Push(&queue, &value, sizeof(value)));
+
+    TEST_ASSERT_EQUAL(2U, ezQueue_Drain(&queue, 2U, SumUntilZero, &sum));
+    TEST_ASSERT_EQUAL_UINT32(3U, sum);
+    TEST_ASSERT_EQUAL(20U, ezQueue_GetNumOfElement(&queue));
+
+    /* the callback keeps the element holding 0 */
+    TEST_ASSERT_EQUAL(18U, ezQueue_Drain(&queue, EZ_QUEUE_DRAIN_ALL, SumUntilZero, &sum));
+    TEST_ASSERT_EQUAL_UINT32(210U, sum);
+    TEST_ASSERT_EQUAL(2U, ezQueue_GetNumOfElement(&queue));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_PopFront(&queue));
+
+    /* elements pushed by the callback are not drained in the same call */
+    TEST_ASSERT_EQUAL(1U, ezQueue_Drain(&queue, EZ_QUEUE_DRAIN_ALL, PushCopy, &queue));
+    TEST_ASSERT_EQUAL(1U, ezQueue_GetNumOfElement(&queue));
+    TEST_ASSERT_EQUAL(1U, ezQueue_Drain(&queue, EZ_QUEUE_DRAIN_ALL, SumUntilZero, &sum));
+    TEST_ASSERT_EQUAL_UINT32(310U, sum);
+
+    TEST_ASSERT_EQUAL(0U, ezQueue_GetNumOfElement(&queue));
+    TEST_ASSERT_EQUAL(0U, ezStaticAlloc_GetNumOfAllocBlock(&queue.mem_list));
+    TEST_ASSERT_EQUAL(1U, ezStaticAlloc_GetNumOfFreeBlock(&queue.mem_list));
+}
+
+TEST(ez_queue, MoveFrontShared)
+{
+    ezmMemList domain;
+    ezQueue rx_queue;
+    ezQueue work_queue;
+    uint8_t *data = NULL;
+    uint8_t *moved = NULL;
+    uint32_t data_size = 0U;
+
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitMemList(&domain, queue_buff, BUFF_SIZE));
+    TEST_ASSERT_EQUAL(ezFAIL, ezQueue_CreateQueueShared(NULL, &domain));
+    TEST_ASSERT_EQUAL(ezFAIL, ezQueue_CreateQueueShared(&rx_queue, NULL));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_CreateQueueShared(&rx_queue, &domain));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_CreateQueueShared(&work_queue, &domain));
+    TEST_ASSERT_TRUE(ezQueue_IsQueueReady(&work_queue));
+
+    TEST_ASSERT_EQUAL(ezFAIL, ezQueue_MoveFront(&work_queue, &rx_queue));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_Push(&rx_queue, item_3, sizeof(item_3)));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_Push(&rx_queue, item_1, sizeof(item_1)));
+    TEST_ASSERT_EQUAL(ezFAIL, ezQueue_MoveFront(&rx_queue, &rx_queue));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_GetFront(&rx_queue, (void **)&data, &data_size));
+
+    /* the data stays where it is */
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_MoveFront(&work_queue, &rx_queue));
+    TEST_ASSERT_EQUAL(1U, ezQueue_GetNumOfElement(&rx_queue));
+    TEST_ASSERT_EQUAL(1U, ezQueue_GetNumOfElement(&work_queue));
+    TEST_ASSERT_EQUAL(2U, ezStaticAlloc_GetNumOfAllocBlock(&domain));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_GetFront(&work_queue, (void **)&moved, &data_size));
+    TEST_ASSERT_EQUAL_PTR(data, moved);
+    TEST_ASSERT_EQUAL_UINT32(sizeof(item_3), data_size);
+    TEST_ASSERT_EQUAL_MEMORY(item_3, moved, sizeof(item_3));
+
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_MoveFront(&work_queue, &rx_queue));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_GetBack(&work_queue, (void **)&moved, &data_size));
+    TEST_ASSERT_EQUAL_MEMORY(item_1, moved, sizeof(item_1));
+
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_PopFront(&work_queue));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_PopFront(&work_queue));
+    TEST_ASSERT_EQUAL(0U, ezStaticAlloc_GetNumOfAllocBlock(&domain));
+}
+
+TEST(ez_queue, MoveFrontCopy)
+{
+    static uint8_t other_buff[64];
+    ezQueue other_queue;
+    uint8_t *data = NULL;
+    uint32_t data_size = 0U;
+
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_CreateQueue(&other_queue, other_buff, sizeof(other_buff)));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_Push(&queue, item_2, sizeof(item_2)));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_Push(&queue, item_3, sizeof(item_3)));
+
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_MoveFront(&other_queue, &queue));
+    TEST_ASSERT_EQUAL(1U, ezQueue_GetNumOfElement(&queue));
+    TEST_ASSERT_EQUAL(1U, ezStaticAlloc_GetNumOfAllocBlock(&queue.mem_list));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_GetFront(&other_queue, (void **)&data, &data_size));
+    TEST_ASSERT_EQUAL_UINT32(sizeof(item_2), data_size);
+    TEST_ASSERT_EQUAL_MEMORY(item_2, data, sizeof(item_2));
+
+    /* the destination is full, the source keeps the element */
+    TEST_ASSERT_EQUAL(ezFAIL, ezQueue_MoveFront(&other_queue, &queue));
+    TEST_ASSERT_EQUAL(1U, ezQueue_GetNumOfElement(&queue));
+    TEST_ASSERT_EQUAL(1U, ezQueue_GetNumOfElement(&other_queue));
+
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_PopFront(&queue));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_PopFront(&other_queue));
+}
+
+TEST(ez_queue, OwnBlocks)
+{
+    static uint8_t pool_buff[4096];
+    static void *allocs[256];
+    static struct MemBlock own_blocks[NUM_OF_BLOCKS];
+    ezmMemList pool_list;
+    uint32_t num_of_allocs = 0U;
+    uint8_t *data = NULL;
+    uint32_t data_size = 0U;
+
+    /* take every descriptor of the pool shared by the memory lists */
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitMemList(&pool_list, pool_buff, sizeof(pool_buff)));
+    while (num_of_allocs < 256U)
+    {
+        allocs[num_of_allocs] = ezStaticAlloc_Malloc(&pool_list, 1U);
+        if (allocs[num_of_allocs] == NULL)
+        {
+            break;
+        }
+        num_of_allocs++;
+    }
+    TEST_ASSERT_TRUE(num_of_allocs < 256U);
+
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_CreateQueueWithBlocks(&queue, queue_buff, BUFF_SIZE, own_blocks, NUM_OF_BLOCKS));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_Push(&queue, item_1, sizeof(item_1)));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_Push(&queue, item_2, sizeof(item_2)));
+    TEST_ASSERT_EQUAL(2U, ezQueue_GetNumOfElement(&queue));
+    TEST_ASSERT_EQUAL(ezSUCCESS, ezQueue_GetFront(&queue, (void **)&data, &data_size));
+    TEST_ASSERT_EQUAL_MEMORY(item_1, data, sizeof(item_1));
+
+    TEST_ASSERT_EQUAL(num_of_allocs, ezStaticAlloc_FreeBatch(&pool_list, allocs, num_of_allocs));
+}
+
 /******************************************************************************
 * Internal functions
 *******************************************************************************/
@@ -423,5 +752,23 @@ static void RunAllTests(void)
 }
 
 
+static bool SumUntilZero(void *data, uint32_t data_size, void *context)
+{
+    uint32_t value = 0U;
+
+    TEST_ASSERT_EQUAL_UINT32(sizeof(value), data_size);
+    memcpy(&value, data, sizeof(value));
+    *(uint32_t *)context += value;
+
+    return value != 0U;
+}
+
+
+static bool PushCopy(void *data, uint32_t data_size, void *context)
+{
+    return ezQueue_Push((ezQueue *)context, data, data_size) == ezSUCCESS;
+}
+
+
 
 /* End of file */
@@ -0,0 +1,207 @@
+/*****************************************************************************
+* Filename:         unittest_ez_static_queue.c
+* Author:           Hai Nguyen
+* Original Date:    16.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   unittest_ez_static_queue.c
+ *  @author Hai Nguyen
+ *  @date   16.10.2026
+ *  @brief  Unit test for the queue generated by EZ_QUEUE_DEFINE
+ *
+ *  @details
+ */
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "unity.h"
+#include "unity_fixture.h"
+#include "ez_static_queue.h"
+
+TEST_GROUP(ez_static_queue);
+
+/******************************************************************************
+* Module Preprocessor Macros
+*******************************************************************************/
+#define CAPACITY        5U  /* not a power of two on purpose */
+
+
+/******************************************************************************
+* Module Typedefs
+*******************************************************************************/
+typedef struct
+{
+    uint32_t id;
+    uint8_t payload[3];
+}Job;
+
+EZ_QUEUE_DEFINE(JobQueue, Job, CAPACITY)
+
+
+/******************************************************************************
+* Module Variable Definitions
+*******************************************************************************/
+static JobQueue jobs;
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+static void RunAllTests(void);
+static Job MakeJob(uint32_t id);
+
+
+/******************************************************************************
+* External functions
+*******************************************************************************/
+int main(int argc, const char *argv[])
+{
+    return UnityMain(argc, argv, RunAllTests);
+}
+
+
+TEST_SETUP(ez_static_queue)
+{
+    JobQueue_Init(&jobs);
+}
+
+
+TEST_TEAR_DOWN(ez_static_queue)
+{
+}
+
+
+TEST_GROUP_RUNNER(ez_static_queue)
+{
+    RUN_TEST_CASE(ez_static_queue, Init);
+    RUN_TEST_CASE(ez_static_queue, PushPop);
+    RUN_TEST_CASE(ez_static_queue, Full);
+    RUN_TEST_CASE(ez_static_queue, WrapAround);
+}
+
+
+TEST(ez_static_queue, Init)
+{
+    Job job;
+
+    TEST_ASSERT_EQUAL(CAPACITY * sizeof(Job), sizeof(jobs.elems));
+    TEST_ASSERT_EQUAL(0U, JobQueue_GetNumOfElement(&jobs));
+    TEST_ASSERT_TRUE(JobQueue_IsEmpty(&jobs));
+    TEST_ASSERT_FALSE(JobQueue_IsFull(&jobs));
+    TEST_ASSERT_NULL(JobQueue_Front(&jobs));
+    TEST_ASSERT_FALSE(JobQueue_Pop(&jobs, &job));
+}
+
+
+TEST(ez_static_queue, PushPop)
+{
+    Job job = MakeJob(1U);
+    Job *front = NULL;
+
+    TEST_ASSERT_TRUE(JobQueue_Push(&jobs, &job));
+    job = MakeJob(2U);
+    TEST_ASSERT_TRUE(JobQueue_Push(&jobs, &job));
+    TEST_ASSERT_EQUAL(2U, JobQueue_GetNumOfElement(&jobs));
+
+    /* front is the element in the queue, changes are visible to the pop */
+    front = JobQueue_Front(&jobs);
+    TEST_ASSERT_NOT_NULL(front);
+    TEST_ASSERT_EQUAL_UINT32(1U, front->id);
+    front->payload[0] = 0xAAU;
+
+    TEST_ASSERT_TRUE(JobQueue_Pop(&jobs, &job));
+    TEST_ASSERT_EQUAL_UINT32(1U, job.id);
+    TEST_ASSERT_EQUAL_UINT8(0xAAU, job.payload[0]);
+    TEST_ASSERT_TRUE(JobQueue_Pop(&jobs, &job));
+    TEST_ASSERT_EQUAL_UINT32(2U, job.id);
+    TEST_ASSERT_EQUAL_UINT8(2U, job.payload[2]);
+    TEST_ASSERT_TRUE(JobQueue_IsEmpty(&jobs));
+}
+
+
+TEST(ez_static_queue, Full)
+{
+    Job job;
+
+    for(uint32_t i = 0; i < CAPACITY; i++)
+    {
+        job = MakeJob(i);
+        TEST_ASSERT_TRUE(JobQueue_Push(&jobs, &job));
+    }
+    TEST_ASSERT_TRUE(JobQueue_IsFull(&jobs));
+
+    job = MakeJob(100U);
+    TEST_ASSERT_FALSE(JobQueue_Push(&jobs, &job));
+    TEST_ASSERT_EQUAL(CAPACITY, JobQueue_GetNumOfElement(&jobs));
+
+    for(uint32_t i = 0; i < CAPACITY; i++)
+    {
+        TEST_ASSERT_TRUE(JobQueue_Pop(&jobs, &job));
+        TEST_ASSERT_EQUAL_UINT32(i, job.id);
+    }
+}
+
+
+TEST(ez_static_queue, WrapAround)
+{
+    uint32_t next_push = 0U;
+    uint32_t next_pop = 0U;
+    Job job;
+
+    /* keep between 1 and 3 elements so head and tail pass the end many
+     * times at different offsets */
+    for(uint32_t round = 0; round < 4U * CAPACITY; round++)
+    {
+        while(JobQueue_GetNumOfElement(&jobs) < 3U)
+        {
+            job = MakeJob(next_push);
+            TEST_ASSERT_TRUE(JobQueue_Push(&jobs, &job));
+            next_push++;
+        }
+
+        for(uint32_t i = 0; i < (round % 3U) + 1U; i++)
+        {
+            TEST_ASSERT_TRUE(JobQueue_Pop(&jobs, &job));
+            TEST_ASSERT_EQUAL_UINT32(next_pop, job.id);
+            next_pop++;
+        }
+    }
+    TEST_ASSERT_EQUAL(next_push - next_pop, JobQueue_GetNumOfElement(&jobs));
+}
+
+
+/******************************************************************************
+* Internal functions
+*******************************************************************************/
+static void RunAllTests(void)
+{
+    RUN_TEST_GROUP(ez_static_queue);
+}
+
+
+static Job MakeJob(uint32_t id)
+{
+    Job job;
+
+    job.id = id;
+    for(uint32_t i = 0; i < sizeof(job.payload); i++)
+    {
+        job.payload[i] = (uint8_t)id;
+    }
+
+    return job;
+}
+
+
+/* End of file */
@@ -0,0 +1,187 @@
+/*****************************************************************************
+* Filename:         unittest_ez_static_queue_cpp.cpp
+* Author:           Hai Nguyen
+* Original Date:    16.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   unittest_ez_static_queue_cpp.cpp
+ *  @author Hai Nguyen
+ *  @date   16.10.2026
+ *  @brief  Unit test for ez::StaticQueue
+ *
+ *  @details
+ */
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include "unity.h"
+#include "unity_fixture.h"
+#include "ez_static_queue.hpp"
+
+TEST_GROUP(ez_static_queue_cpp);
+
+/******************************************************************************
+* Module Preprocessor Macros
+*******************************************************************************/
+#define CAPACITY        3U
+
+
+/******************************************************************************
+* Module Typedefs
+*******************************************************************************/
+/* No default constructor, counts the live objects */
+class Tracked
+{
+public:
+    explicit Tracked(std::uint32_t id) noexcept : id_(id) { live++; }
+    Tracked(const Tracked &other) noexcept : id_(other.id_) { live++; }
+    Tracked &operator=(const Tracked &other) noexcept = default;
+    ~Tracked() { live--; }
+
+    std::uint32_t id() const noexcept { return id_; }
+
+    static std::int32_t live;
+
+private:
+    std::uint32_t id_;
+};
+
+std::int32_t Tracked::live = 0;
+
+
+/******************************************************************************
+* Module Variable Definitions
+*******************************************************************************/
+/* None */
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+static void RunAllTests(void);
+
+
+/******************************************************************************
+* External functions
+*******************************************************************************/
+int main(int argc, const char *argv[])
+{
+    return UnityMain(argc, argv, RunAllTests);
+}
+
+
+TEST_SETUP(ez_static_queue_cpp)
+{
+    Tracked::live = 0;
+}
+
+
+TEST_TEAR_DOWN(ez_static_queue_cpp)
+{
+}
+
+
+TEST_GROUP_RUNNER(ez_static_queue_cpp)
+{
+    RUN_TEST_CASE(ez_static_queue_cpp, PushPop);
+    RUN_TEST_CASE(ez_static_queue_cpp, Lifetime);
+    RUN_TEST_CASE(ez_static_queue_cpp, MoveOnly);
+}
+
+
+TEST(ez_static_queue_cpp, PushPop)
+{
+    ez::StaticQueue<std::uint32_t, CAPACITY> queue;
+    std::uint32_t value = 0U;
+
+    static_assert(ez::StaticQueue<std::uint32_t, CAPACITY>::capacity() == CAPACITY);
+    TEST_ASSERT_TRUE(queue.empty());
+    TEST_ASSERT_FALSE(queue.pop(value));
+
+    for(std::uint32_t round = 0; round < 10U; round++)
+    {
+        TEST_ASSERT_TRUE(queue.push(round));
+        TEST_ASSERT_TRUE(queue.push(round + 100U));
+        TEST_ASSERT_EQUAL_UINT32(round + 100U, queue.back());
+        TEST_ASSERT_EQUAL_UINT32(round, queue.front());
+        TEST_ASSERT_TRUE(queue.pop(value));
+        TEST_ASSERT_EQUAL_UINT32(round, value);
+        TEST_ASSERT_TRUE(queue.pop());
+    }
+
+    TEST_ASSERT_TRUE(queue.push(1U));
+    TEST_ASSERT_TRUE(queue.push(2U));
+    TEST_ASSERT_TRUE(queue.push(3U));
+    TEST_ASSERT_TRUE(queue.full());
+    TEST_ASSERT_FALSE(queue.push(4U));
+    TEST_ASSERT_EQUAL(CAPACITY, queue.size());
+}
+
+
+TEST(ez_static_queue_cpp, Lifetime)
+{
+    {
+        ez::StaticQueue<Tracked, CAPACITY> queue;
+        Tracked out(0U);
+
+        /* storage holds no object until a push */
+        TEST_ASSERT_EQUAL(1, Tracked::live);
+
+        TEST_ASSERT_TRUE(queue.emplace(1U));
+        TEST_ASSERT_TRUE(queue.push(Tracked(2U)));
+        TEST_ASSERT_TRUE(queue.emplace(3U));
+        TEST_ASSERT_FALSE(queue.emplace(4U));
+        TEST_ASSERT_EQUAL(4, Tracked::live);
+
+        TEST_ASSERT_TRUE(queue.pop(out));
+        TEST_ASSERT_EQUAL_UINT32(1U, out.id());
+        TEST_ASSERT_EQUAL(3, Tracked::live);
+
+        queue.clear();
+        TEST_ASSERT_EQUAL(1, Tracked::live);
+
+        /* the destructor releases what is left in the queue */
+        TEST_ASSERT_TRUE(queue.emplace(5U));
+        TEST_ASSERT_TRUE(queue.emplace(6U));
+    }
+    TEST_ASSERT_EQUAL(0, Tracked::live);
+}
+
+
+TEST(ez_static_queue_cpp, MoveOnly)
+{
+    ez::StaticQueue<std::unique_ptr<std::uint32_t>, CAPACITY> queue;
+    std::unique_ptr<std::uint32_t> out;
+
+    TEST_ASSERT_TRUE(queue.push(std::make_unique<std::uint32_t>(7U)));
+    TEST_ASSERT_TRUE(queue.emplace(new std::uint32_t(8U)));
+
+    TEST_ASSERT_TRUE(queue.pop(out));
+    TEST_ASSERT_NOT_NULL(out.get());
+    TEST_ASSERT_EQUAL_UINT32(7U, *out);
+    TEST_ASSERT_EQUAL_UINT32(8U, *queue.front());
+}
+
+
+/******************************************************************************
+* Internal functions
+*******************************************************************************/
+static void RunAllTests(void)
+{
+    RUN_TEST_GROUP(ez_static_queue_cpp);
+}
+
+
+/* End of file */
@@ -0,0 +1,286 @@
+/*****************************************************************************
+* Filename:         benchmark_ez_ring_buffer.c
+* Author:           Hai Nguyen
+* Original Date:    16.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   benchmark_ez_ring_buffer.c
+ *  @author Hai Nguyen
+ *  @date   16.10.2026
+ *  @brief  Throughput benchmark of the ring buffer variants
+ *
+ *  @details Prints the throughput in MB/s of
+ *  - the power of two fast path, the generic path and (if enabled) the
+ *    mirrored storage of RingBuffer, pushing and popping in a single thread
+ *  - a mutex-protected RingBuffer against ezSpscRingBuffer, moving data from
+ *    a producer thread to a consumer thread
+ *  Not part of the unit test run, execute ez_ring_buffer_benchmark manually.
+ */
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+#include "ez_ring_buffer.h"
+#include "ez_spsc_ring_buffer.h"
+
+
+/******************************************************************************
+* Module Preprocessor Macros
+*******************************************************************************/
+#define BENCH_BUFF_SIZE     4096U
+#define BENCH_NUM_OF_BYTES  (16U * 1024U * 1024U)
+#define BENCH_MAX_CHUNK     1024U
+#if (EZ_RING_BUFFER_32BIT == 1U)
+#define BENCH_LARGE_SIZE    (1024U * 1024U)
+#else
+#define BENCH_LARGE_SIZE    32768U
+#endif
+
+
+/******************************************************************************
+* Module Typedefs
+*******************************************************************************/
+
+/** @brief Push/pop operations of the ring buffer under test
+ */
+typedef struct
+{
+    const char *name;
+    uint32_t (*push)(const uint8_t *data, uint32_t size);
+    uint32_t (*pop)(uint8_t *data, uint32_t size);
+} BenchTarget;
+
+
+/******************************************************************************
+* Module Variable Definitions
+*******************************************************************************/
+static uint8_t storage[BENCH_LARGE_SIZE];
+static RingBuffer locked_ring;
+static pthread_mutex_t locked_ring_mutex = PTHREAD_MUTEX_INITIALIZER;
+static ezSpscRingBuffer spsc_ring;
+static const BenchTarget *active_target = NULL;
+static uint32_t active_chunk = 0U;
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+static uint32_t LockedPush(const uint8_t *data, uint32_t size);
+static uint32_t LockedPop(uint8_t *data, uint32_t size);
+static uint32_t SpscPush(const uint8_t *data, uint32_t size);
+static uint32_t SpscPop(uint8_t *data, uint32_t size);
+static void *Producer(void *arg);
+static void *Consumer(void *arg);
+static double RunBenchmark(const BenchTarget *target, uint32_t chunk);
+static double RunSingleThreadBenchmark(RingBuffer *ring, uint32_t chunk);
+static double ElapsedSeconds(const struct timespec *start, const struct timespec *stop);
+
+
+/******************************************************************************
+* External functions
+*******************************************************************************/
+int main(void)
+{
+    static const BenchTarget targets[] = {
+        { "RingBuffer + mutex", LockedPush, LockedPop },
+        { "ezSpscRingBuffer",   SpscPush,   SpscPop },
+    };
+    static const uint32_t chunks[] = { 1U, 16U, 64U, 256U, 1024U };
+    static const ezRingBufferSize_t capacities[] = {
+        BENCH_BUFF_SIZE, BENCH_BUFF_SIZE - 1U, BENCH_LARGE_SIZE, BENCH_LARGE_SIZE - 1U
+    };
+
+    printf("Single thread push/pop\n");
+    printf("%-22s %8s %12s\n", "capacity", "chunk", "MB/s");
+    for (uint32_t c = 0; c < sizeof(chunks) / sizeof(chunks[0]); c++)
+    {
+        for (uint32_t i = 0; i < sizeof(capacities) / sizeof(capacities[0]); i++)
+        {
+            RingBuffer ring;
+            (void)ezRingBuffer_Init(&ring, storage, capacities[i]);
+            printf("%-10lu %-11s %8u %12.1f\n",
+                   (unsigned long)capacities[i],
+                   (ring.index_mask != 0U) ? "(pow2)" : "(generic)",
+                   chunks[c],
+                   RunSingleThreadBenchmark(&ring, chunks[c]));
+        }
+#if (EZ_RING_BUFFER_MIRROR == 1U)
+        for (uint32_t i = 0; i < sizeof(capacities) / sizeof(capacities[0]); i += 2U)
+        {
+            RingBuffer ring;
+            if (ezRingBuffer_InitMirrored(&ring, capacities[i]))
+            {
+                printf("%-10lu %-11s %8u %12.1f\n",
+                       (unsigned long)ring.capacity,
+                       "(mirror)",
+                       chunks[c],
+                       RunSingleThreadBenchmark(&ring, chunks[c]));
+                ezRingBuffer_DeinitMirrored(&ring);
+            }
+        }
+#endif
+    }
+
+    printf("\nProducer/consumer threads\n");
+    printf("%-22s %8s %12s\n", "implementation", "chunk", "MB/s");
+    for (uint32_t c = 0; c < sizeof(chunks) / sizeof(chunks[0]); c++)
+    {
+        for (uint32_t t = 0; t < sizeof(targets) / sizeof(targets[0]); t++)
+        {
+            double mb_per_s = RunBenchmark(&targets[t], chunks[c]);
+            printf("%-22s %8u %12.1f\n", targets[t].name, chunks[c], mb_per_s);
+        }
+    }
+
+    return 0;
+}
+
+
+/******************************************************************************
+* Internal functions
+*******************************************************************************/
+static uint32_t LockedPush(const uint8_t *data, uint32_t size)
+{
+    ezRingBufferSize_t pushed;
+    pthread_mutex_lock(&locked_ring_mutex);
+    pushed = ezRingBuffer_Push(&locked_ring, (uint8_t *)data, (ezRingBufferSize_t)size);
+    pthread_mutex_unlock(&locked_ring_mutex);
+    return pushed;
+}
+
+
+static uint32_t LockedPop(uint8_t *data, uint32_t size)
+{
+    ezRingBufferSize_t popped;
+    pthread_mutex_lock(&locked_ring_mutex);
+    popped = ezRingBuffer_Pop(&locked_ring, data, (ezRingBufferSize_t)size);
+    pthread_mutex_unlock(&locked_ring_mutex);
+    return popped;
+}
+
+
+static uint32_t SpscPush(const uint8_t *data, uint32_t size)
+{
+    return ezSpscRingBuffer_Push(&spsc_ring, data, size);
+}
+
+
+static uint32_t SpscPop(uint8_t *data, uint32_t size)
+{
+    return ezSpscRingBuffer_Pop(&spsc_ring, data, size);
+}
+
+
+static void *Producer(void *arg)
+{
+    uint8_t chunk[BENCH_MAX_CHUNK] = { 0 };
+    uint32_t sent = 0U;
+    (void)arg;
+
+    while (sent < BENCH_NUM_OF_BYTES)
+    {
+        uint32_t pushed = active_target->push(chunk, active_chunk);
+        if (pushed == 0U)
+        {
+            (void)sched_yield();
+        }
+        sent += pushed;
+    }
+
+    return NULL;
+}
+
+
+static void *Consumer(void *arg)
+{
+    uint8_t chunk[BENCH_MAX_CHUNK];
+    uint32_t received = 0U;
+    (void)arg;
+
+    while (received < BENCH_NUM_OF_BYTES)
+    {
+        uint32_t popped = active_target->pop(chunk, active_chunk);
+        if (popped == 0U)
+        {
+            (void)sched_yield();
+        }
+        received += popped;
+    }
+
+    return NULL;
+}
+
+
+static double RunBenchmark(const BenchTarget *target, uint32_t chunk)
+{
+    pthread_t producer;
+    pthread_t consumer;
+    struct timespec start;
+    struct timespec stop;
+    double elapsed_s;
+
+    (void)ezRingBuffer_Init(&locked_ring, storage, BENCH_BUFF_SIZE);
+    (void)ezSpscRingBuffer_Init(&spsc_ring, storage, BENCH_BUFF_SIZE);
+    active_target = target;
+    active_chunk = chunk;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    pthread_create(&consumer, NULL, Consumer, NULL);
+    pthread_create(&producer, NULL, Producer, NULL);
+    pthread_join(producer, NULL);
+    pthread_join(consumer, NULL);
+    clock_gettime(CLOCK_MONOTONIC, &stop);
+
+    elapsed_s = ElapsedSeconds(&start, &stop);
+
+    return ((double)BENCH_NUM_OF_BYTES / (1024.0 * 1024.0)) / elapsed_s;
+}
+
+
+static double RunSingleThreadBenchmark(RingBuffer *ring, uint32_t chunk)
+{
+    uint8_t data[BENCH_MAX_CHUNK] = { 0 };
+    struct timespec start;
+    struct timespec stop;
+    uint32_t moved = 0U;
+
+    /* Keep the buffer half full so that every chunk size hits the wrap point */
+    while (ezRingBuffer_GetAvailableMemory(ring) > ring->capacity / 2U)
+    {
+        (void)ezRingBuffer_Push(ring, data, (ezRingBufferSize_t)chunk);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    while (moved < BENCH_NUM_OF_BYTES)
+    {
+        (void)ezRingBuffer_Push(ring, data, (ezRingBufferSize_t)chunk);
+        moved += ezRingBuffer_Pop(ring, data, (ezRingBufferSize_t)chunk);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &stop);
+
+    return ((double)moved / (1024.0 * 1024.0)) / ElapsedSeconds(&start, &stop);
+}
+
+
+static double ElapsedSeconds(const struct timespec *start, const struct timespec *stop)
+{
+    return (double)(stop->tv_sec - start->tv_sec)
+        + (double)(stop->tv_nsec - start->tv_nsec) / 1e9;
+}
+
+
+/* End of file */
@@ -0,0 +1,297 @@
+/*****************************************************************************
+* Filename:         unittest_ez_record_ring.c
+* Author:           Hai Nguyen
+* Original Date:    16.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   unittest_ez_record_ring.c
+ *  @author Hai Nguyen
+ *  @date   16.10.2026
+ *  @brief  Unit test for the record ring
+ *
+ *  @details
+ */
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "unity.h"
+#include "unity_fixture.h"
+#include "ez_record_ring.h"
+
+TEST_GROUP(ez_record_ring);
+
+/******************************************************************************
+* Module Preprocessor Macros
+*******************************************************************************/
+#define BUFF_SIZE   32
+
+
+/******************************************************************************
+* Module Typedefs
+*******************************************************************************/
+/* None */
+
+
+/******************************************************************************
+* Module Variable Definitions
+*******************************************************************************/
+static uint32_t test_buffer[BUFF_SIZE / 4];
+static ezRecordRing records;
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+static void RunAllTests(void);
+
+/******************************************************************************
+* External functions
+*******************************************************************************/
+int main(int argc, const char *argv[])
+{
+    return UnityMain(argc, argv, RunAllTests);
+}
+
+
+TEST_SETUP(ez_record_ring)
+{
+    (void)ezRecordRing_Init(&records, (uint8_t *)test_buffer, BUFF_SIZE);
+}
+
+
+TEST_TEAR_DOWN(ez_record_ring)
+{
+}
+
+
+TEST_GROUP_RUNNER(ez_record_ring)
+{
+    RUN_TEST_CASE(ez_record_ring, Init);
+    RUN_TEST_CASE(ez_record_ring, PushPop);
+    RUN_TEST_CASE(ez_record_ring, ZeroLength);
+    RUN_TEST_CASE(ez_record_ring, PopBufferTooSmall);
+    RUN_TEST_CASE(ez_record_ring, ReserveCommit);
+    RUN_TEST_CASE(ez_record_ring, PaddingAtWrapPoint);
+    RUN_TEST_CASE(ez_record_ring, Full);
+    RUN_TEST_CASE(ez_record_ring, OversizedRecord);
+    RUN_TEST_CASE(ez_record_ring, OverwriteDropsWholeRecords);
+}
+
+
+TEST(ez_record_ring, Init)
+{
+    TEST_ASSERT_FALSE(ezRecordRing_Init(NULL, (uint8_t *)test_buffer, BUFF_SIZE));
+    TEST_ASSERT_FALSE(ezRecordRing_Init(&records, (uint8_t *)test_buffer, 4));
+    TEST_ASSERT_TRUE(ezRecordRing_Init(&records, (uint8_t *)test_buffer, BUFF_SIZE + 3));
+    TEST_ASSERT_EQUAL(BUFF_SIZE, records.ring.capacity);
+    TEST_ASSERT_EQUAL(0, ezRecordRing_GetNumOfRecords(&records));
+}
+
+
+TEST(ez_record_ring, PushPop)
+{
+    uint8_t msg_a[3] = { 1, 2, 3 };
+    uint8_t msg_b[6] = { 4, 5, 6, 7, 8, 9 };
+    uint8_t out[BUFF_SIZE];
+    ezRingBufferSize_t size = sizeof(out);
+
+    TEST_ASSERT_TRUE(ezRecordRing_Push(&records, msg_a, sizeof(msg_a)));
+    TEST_ASSERT_TRUE(ezRecordRing_Push(&records, msg_b, sizeof(msg_b)));
+    TEST_ASSERT_EQUAL(2, ezRecordRing_GetNumOfRecords(&records));
+    TEST_ASSERT_EQUAL(EZ_RECORD_RING_RECORD_SIZE(3U) + EZ_RECORD_RING_RECORD_SIZE(6U),
+                      records.ring.written_byte_count);
+
+    TEST_ASSERT_TRUE(ezRecordRing_Pop(&records, out, &size));
+    TEST_ASSERT_EQUAL(sizeof(msg_a), size);
+    TEST_ASSERT_EQUAL_MEMORY(msg_a, out, sizeof(msg_a));
+
+    size = sizeof(out);
+    TEST_ASSERT_TRUE(ezRecordRing_Pop(&records, out, &size));
+    TEST_ASSERT_EQUAL(sizeof(msg_b), size);
+    TEST_ASSERT_EQUAL_MEMORY(msg_b, out, sizeof(msg_b));
+
+    size = sizeof(out);
+    TEST_ASSERT_FALSE(ezRecordRing_Pop(&records, out, &size));
+    TEST_ASSERT_EQUAL(0, ezRecordRing_GetNumOfRecords(&records));
+}
+
+
+TEST(ez_record_ring, ZeroLength)
+{
+    uint8_t *payload = NULL;
+    ezRingBufferSize_t size = 1;
+
+    TEST_ASSERT_TRUE(ezRecordRing_Push(&records, NULL, 0));
+    TEST_ASSERT_EQUAL(1, ezRecordRing_GetNumOfRecords(&records));
+    TEST_ASSERT_TRUE(ezRecordRing_Peek(&records, &payload, &size));
+    TEST_ASSERT_EQUAL(0, size);
+    TEST_ASSERT_TRUE(ezRecordRing_Consume(&records));
+    TEST_ASSERT_FALSE(ezRecordRing_Consume(&records));
+}
+
+
+TEST(ez_record_ring, PopBufferTooSmall)
+{
+    uint8_t msg[8] = { 0 };
+    uint8_t out[4];
+    ezRingBufferSize_t size = sizeof(out);
+
+    TEST_ASSERT_TRUE(ezRecordRing_Push(&records, msg, sizeof(msg)));
+    TEST_ASSERT_FALSE(ezRecordRing_Pop(&records, out, &size));
+    TEST_ASSERT_EQUAL(sizeof(msg), size);
+    TEST_ASSERT_EQUAL(1, ezRecordRing_GetNumOfRecords(&records));
+}
+
+
+TEST(ez_record_ring, ReserveCommit)
+{
+    uint8_t *payload = NULL;
+    uint8_t *peeked = NULL;
+    ezRingBufferSize_t size = 0;
+
+    TEST_ASSERT_FALSE(ezRecordRing_Commit(&records, 1));
+
+    payload = ezRecordRing_Reserve(&records, 12);
+    TEST_ASSERT_NOT_NULL(payload);
+    TEST_ASSERT_EQUAL_PTR((uint8_t *)test_buffer + EZ_RECORD_RING_HEADER_SIZE, payload);
+    payload[0] = 0xAB;
+    payload[1] = 0xCD;
+
+    /* Nothing is visible before commit */
+    TEST_ASSERT_FALSE(ezRecordRing_Peek(&records, &peeked, &size));
+    TEST_ASSERT_FALSE(ezRecordRing_Commit(&records, 13));
+    TEST_ASSERT_TRUE(ezRecordRing_Commit(&records, 2));
+
+    TEST_ASSERT_TRUE(ezRecordRing_Peek(&records, &peeked, &size));
+    TEST_ASSERT_EQUAL_PTR(payload, peeked);
+    TEST_ASSERT_EQUAL(2, size);
+    TEST_ASSERT_EQUAL(0xAB, peeked[0]);
+
+    /* The reservation is used up */
+    TEST_ASSERT_FALSE(ezRecordRing_Commit(&records, 2));
+
+    /* Too large records are rejected */
+    TEST_ASSERT_NULL(ezRecordRing_Reserve(&records, BUFF_SIZE));
+}
+
+
+TEST(ez_record_ring, PaddingAtWrapPoint)
+{
+    uint8_t msg[12] = { 0,1,2,3,4,5,6,7,8,9,10,11 };
+    uint8_t out[BUFF_SIZE];
+    uint8_t *payload = NULL;
+    ezRingBufferSize_t size = sizeof(out);
+
+    /* 16 + 8 bytes used, tail moves to 16 after the first pop */
+    TEST_ASSERT_TRUE(ezRecordRing_Push(&records, msg, 12));
+    TEST_ASSERT_TRUE(ezRecordRing_Push(&records, msg, 4));
+    TEST_ASSERT_TRUE(ezRecordRing_Pop(&records, out, &size));
+
+    /* 8 bytes left before the end, the 16-byte record goes to offset 0 */
+    payload = ezRecordRing_Reserve(&records, 12);
+    TEST_ASSERT_EQUAL_PTR((uint8_t *)test_buffer + EZ_RECORD_RING_HEADER_SIZE, payload);
+    TEST_ASSERT_TRUE(ezRecordRing_Commit(&records, 0));
+    TEST_ASSERT_TRUE(ezRecordRing_Push(&records, msg, 8));
+    TEST_ASSERT_EQUAL(3, ezRecordRing_GetNumOfRecords(&records));
+
+    size = sizeof(out);
+    TEST_ASSERT_TRUE(ezRecordRing_Pop(&records, out, &size));
+    TEST_ASSERT_EQUAL(4, size);
+
+    /* The padding is skipped transparently */
+    size = sizeof(out);
+    TEST_ASSERT_TRUE(ezRecordRing_Pop(&records, out, &size));
+    TEST_ASSERT_EQUAL(0, size);
+
+    size = sizeof(out);
+    TEST_ASSERT_TRUE(ezRecordRing_Pop(&records, out, &size));
+    TEST_ASSERT_EQUAL(8, size);
+    TEST_ASSERT_EQUAL_MEMORY(msg, out, 8);
+    TEST_ASSERT_TRUE(ezRingBuffer_IsEmpty(&records.ring));
+}
+
+
+TEST(ez_record_ring, OversizedRecord)
+{
+    const ezRingBufferSize_t max_size = (ezRingBufferSize_t)~(ezRingBufferSize_t)0U;
+    uint8_t msg[4] = { 0 };
+
+    /* sizes whose footprint wraps around must not pass the capacity check */
+    for (ezRingBufferSize_t delta = 0; delta < 4U; delta++)
+    {
+        TEST_ASSERT_NULL(ezRecordRing_Reserve(&records, (ezRingBufferSize_t)(max_size - delta)));
+    }
+    TEST_ASSERT_NULL(ezRecordRing_Reserve(&records, (ezRingBufferSize_t)(BUFF_SIZE - EZ_RECORD_RING_HEADER_SIZE + 1U)));
+    TEST_ASSERT_FALSE(ezRecordRing_Push(&records, msg, (ezRingBufferSize_t)(max_size - 2U)));
+    TEST_ASSERT_EQUAL(0, ezRecordRing_GetNumOfRecords(&records));
+
+    /* the largest record still fits */
+    TEST_ASSERT_NOT_NULL(ezRecordRing_Reserve(&records, (ezRingBufferSize_t)(BUFF_SIZE - EZ_RECORD_RING_HEADER_SIZE)));
+    TEST_ASSERT_TRUE(ezRecordRing_Commit(&records, 0U));
+    TEST_ASSERT_EQUAL(1, ezRecordRing_GetNumOfRecords(&records));
+}
+
+
+TEST(ez_record_ring, Full)
+{
+    uint8_t msg[4] = { 0 };
+
+    for (uint8_t i = 0; i < BUFF_SIZE / 8; i++)
+    {
+        TEST_ASSERT_TRUE(ezRecordRing_Push(&records, msg, sizeof(msg)));
+    }
+    TEST_ASSERT_FALSE(ezRecordRing_Push(&records, msg, sizeof(msg)));
+    TEST_ASSERT_FALSE(ezRecordRing_Push(&records, NULL, 0));
+    TEST_ASSERT_EQUAL(0, ezRecordRing_GetDroppedRecords(&records));
+}
+
+
+TEST(ez_record_ring, OverwriteDropsWholeRecords)
+{
+    uint8_t out[BUFF_SIZE];
+    ezRingBufferSize_t size = sizeof(out);
+
+    ezRecordRing_SetOverwrite(&records, true);
+
+    for (uint8_t i = 0; i < BUFF_SIZE / 8; i++)
+    {
+        uint8_t msg[4] = { i, i, i, i };
+        TEST_ASSERT_TRUE(ezRecordRing_Push(&records, msg, sizeof(msg)));
+    }
+
+    /* A 12-byte record needs 16 bytes: the two oldest records are dropped */
+    uint8_t big[12] = { 9 };
+    TEST_ASSERT_TRUE(ezRecordRing_Push(&records, big, sizeof(big)));
+    TEST_ASSERT_EQUAL(2, ezRecordRing_GetDroppedRecords(&records));
+    TEST_ASSERT_EQUAL(3, ezRecordRing_GetNumOfRecords(&records));
+
+    TEST_ASSERT_TRUE(ezRecordRing_Pop(&records, out, &size));
+    TEST_ASSERT_EQUAL(4, size);
+    TEST_ASSERT_EQUAL(2, out[0]);
+
+    ezRecordRing_ResetDroppedRecords(&records);
+    TEST_ASSERT_EQUAL(0, ezRecordRing_GetDroppedRecords(&records));
+}
+
+
+/******************************************************************************
+* Internal functions
+*******************************************************************************/
+static void RunAllTests(void)
+{
+    RUN_TEST_GROUP(ez_record_ring);
+}
+
+
+/* End of file */
@@ -36,6 +36,8 @@ TEST_GROUP(ez_ring_buffer);
 * Module Preprocessor Macros
 *******************************************************************************/
 #define BUFF_SIZE 10
+#define POW2_BUFF_SIZE 8
+#define LARGE_BUFF_SIZE (128UL * 1024UL)
 
 
 /******************************************************************************
@@ -49,6 +51,10 @@ TEST_GROUP(ez_ring_buffer);
 *******************************************************************************/
 static uint8_t au8TestBuffer[BUFF_SIZE] = { 0 };
 static RingBuffer r_buff;
+static uint8_t pow2_buffer[POW2_BUFF_SIZE] = { 0 };
+#if (EZ_RING_BUFFER_32BIT == 1U)
+static uint8_t large_buffer[LARGE_BUFF_SIZE] = { 0 };
+#endif
 
 
 /******************************************************************************
@@ -82,6 +88,19 @@ TEST_GROUP_RUNNER(ez_ring_buffer)
     RUN_TEST_CASE(ez_ring_buffer, Pop);
     RUN_TEST_CASE(ez_ring_buffer, wrapping_point_push);
     RUN_TEST_CASE(ez_ring_buffer, wrapping_point_pop);
+    RUN_TEST_CASE(ez_ring_buffer, reserve_commit);
+    RUN_TEST_CASE(ez_ring_buffer, peek_consume);
+    RUN_TEST_CASE(ez_ring_buffer, zero_copy_wrapping);
+    RUN_TEST_CASE(ez_ring_buffer, power_of_two);
+    RUN_TEST_CASE(ez_ring_buffer, power_of_two_index_overflow);
+    RUN_TEST_CASE(ez_ring_buffer, overwrite_oldest);
+    RUN_TEST_CASE(ez_ring_buffer, overwrite_larger_than_capacity);
+#if (EZ_RING_BUFFER_32BIT == 1U)
+    RUN_TEST_CASE(ez_ring_buffer, large_capacity);
+#endif
+#if (EZ_RING_BUFFER_MIRROR == 1U)
+    RUN_TEST_CASE(ez_ring_buffer, mirrored);
+#endif
 }
 
 
@@ -247,6 +266,293 @@ TEST(ez_ring_buffer, wrapping_point_pop)
 }
 
 
+TEST(ez_ring_buffer, reserve_commit)
+{
+    ezRingBufferRegion regions[EZ_RING_BUFFER_NUM_OF_REGIONS];
+    uint8_t pop_10[BUFF_SIZE];
+    uint16_t u16Bytes;
+
+    ezRingBuffer_Init(&r_buff, au8TestBuffer, BUFF_SIZE);
+
+    u16Bytes = ezRingBuffer_Reserve(&r_buff, regions);
+    TEST_ASSERT_EQUAL(BUFF_SIZE, u16Bytes);
+    TEST_ASSERT_EQUAL_PTR(au8TestBuffer, regions[0].data);
+    TEST_ASSERT_EQUAL(BUFF_SIZE, regions[0].size);
+    TEST_ASSERT_EQUAL(0, regions[1].size);
+
+    /* Write directly into the storage, then publish 4 bytes */
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        regions[0].data[i] = (uint8_t)(i + 10);
+    }
+    TEST_ASSERT_TRUE(ezRingBuffer_Commit(&r_buff, 4));
+    TEST_ASSERT_EQUAL(BUFF_SIZE - 4, ezRingBuffer_GetAvailableMemory(&r_buff));
+
+    /* Committing more than the free space is rejected */
+    TEST_ASSERT_FALSE(ezRingBuffer_Commit(&r_buff, BUFF_SIZE));
+
+    u16Bytes = ezRingBuffer_Pop(&r_buff, pop_10, BUFF_SIZE);
+    TEST_ASSERT_EQUAL(4, u16Bytes);
+    TEST_ASSERT_EQUAL(10, pop_10[0]);
+    TEST_ASSERT_EQUAL(13, pop_10[3]);
+}
+
+
+TEST(ez_ring_buffer, peek_consume)
+{
+    ezRingBufferRegion regions[EZ_RING_BUFFER_NUM_OF_REGIONS];
+    uint8_t push_10[BUFF_SIZE] = { 0,1,2,3,4,5,6,7,8,9 };
+    uint16_t u16Bytes;
+
+    ezRingBuffer_Init(&r_buff, au8TestBuffer, BUFF_SIZE);
+
+    u16Bytes = ezRingBuffer_Peek(&r_buff, regions);
+    TEST_ASSERT_EQUAL(0, u16Bytes);
+    TEST_ASSERT_EQUAL(0, regions[0].size);
+    TEST_ASSERT_EQUAL(0, regions[1].size);
+
+    ezRingBuffer_Push(&r_buff, push_10, 6);
+    u16Bytes = ezRingBuffer_Peek(&r_buff, regions);
+    TEST_ASSERT_EQUAL(6, u16Bytes);
+    TEST_ASSERT_EQUAL_MEMORY(push_10, regions[0].data, 6);
+
+    /* Peek does not remove data */
+    TEST_ASSERT_EQUAL(6, ezRingBuffer_Peek(&r_buff, regions));
+
+    TEST_ASSERT_TRUE(ezRingBuffer_Consume(&r_buff, 4));
+    u16Bytes = ezRingBuffer_Peek(&r_buff, regions);
+    TEST_ASSERT_EQUAL(2, u16Bytes);
+    TEST_ASSERT_EQUAL(4, regions[0].data[0]);
+
+    TEST_ASSERT_FALSE(ezRingBuffer_Consume(&r_buff, 3));
+    TEST_ASSERT_TRUE(ezRingBuffer_Consume(&r_buff, 2));
+    TEST_ASSERT_TRUE(ezRingBuffer_IsEmpty(&r_buff));
+}
+
+
+TEST(ez_ring_buffer, zero_copy_wrapping)
+{
+    ezRingBufferRegion regions[EZ_RING_BUFFER_NUM_OF_REGIONS];
+    uint8_t push_10[BUFF_SIZE] = { 0,1,2,3,4,5,6,7,8,9 };
+    uint8_t pop_10[BUFF_SIZE];
+    uint16_t u16Bytes;
+
+    ezRingBuffer_Init(&r_buff, au8TestBuffer, BUFF_SIZE);
+    ezRingBuffer_Push(&r_buff, push_10, 7);
+    ezRingBuffer_Pop(&r_buff, pop_10, 5);
+
+    /* Free space: indices 7..9 and 0..4 */
+    u16Bytes = ezRingBuffer_Reserve(&r_buff, regions);
+    TEST_ASSERT_EQUAL(8, u16Bytes);
+    TEST_ASSERT_EQUAL_PTR(&au8TestBuffer[7], regions[0].data);
+    TEST_ASSERT_EQUAL(3, regions[0].size);
+    TEST_ASSERT_EQUAL_PTR(au8TestBuffer, regions[1].data);
+    TEST_ASSERT_EQUAL(5, regions[1].size);
+
+    for (uint8_t i = 0; i < regions[0].size; i++)
+    {
+        regions[0].data[i] = (uint8_t)(20 + i);
+    }
+    for (uint8_t i = 0; i < regions[1].size; i++)
+    {
+        regions[1].data[i] = (uint8_t)(23 + i);
+    }
+    TEST_ASSERT_TRUE(ezRingBuffer_Commit(&r_buff, 8));
+    TEST_ASSERT_TRUE(ezRingBuffer_IsFull(&r_buff));
+
+    /* Stored data: indices 5..9 and 0..4 */
+    u16Bytes = ezRingBuffer_Peek(&r_buff, regions);
+    TEST_ASSERT_EQUAL(BUFF_SIZE, u16Bytes);
+    TEST_ASSERT_EQUAL_PTR(&au8TestBuffer[5], regions[0].data);
+    TEST_ASSERT_EQUAL(5, regions[0].size);
+    TEST_ASSERT_EQUAL(5, regions[1].size);
+
+    TEST_ASSERT_TRUE(ezRingBuffer_Consume(&r_buff, 2));
+    u16Bytes = ezRingBuffer_Pop(&r_buff, pop_10, BUFF_SIZE);
+    TEST_ASSERT_EQUAL(8, u16Bytes);
+    for (uint8_t i = 0; i < 8; i++)
+    {
+        TEST_ASSERT_EQUAL(20 + i, pop_10[i]);
+    }
+    TEST_ASSERT_TRUE(ezRingBuffer_IsEmpty(&r_buff));
+}
+
+
+TEST(ez_ring_buffer, power_of_two)
+{
+    uint8_t push_10[BUFF_SIZE] = { 0,1,2,3,4,5,6,7,8,9 };
+    uint8_t pop_10[BUFF_SIZE] = { 0 };
+    uint8_t expected[POW2_BUFF_SIZE] = { 3,4,5,0,1,2,3,4 };
+
+    TEST_ASSERT_TRUE(ezRingBuffer_Init(&r_buff, pow2_buffer, POW2_BUFF_SIZE));
+    TEST_ASSERT_EQUAL(POW2_BUFF_SIZE - 1, r_buff.index_mask);
+
+    TEST_ASSERT_EQUAL(6, ezRingBuffer_Push(&r_buff, push_10, 6));
+    TEST_ASSERT_EQUAL(3, ezRingBuffer_Pop(&r_buff, pop_10, 3));
+    TEST_ASSERT_EQUAL(5, ezRingBuffer_Push(&r_buff, push_10, 10));
+    TEST_ASSERT_TRUE(ezRingBuffer_IsFull(&r_buff));
+
+    /* Free-running indices, head has passed capacity */
+    TEST_ASSERT_EQUAL(11, r_buff.head_index);
+    TEST_ASSERT_EQUAL(0, pow2_buffer[6]);
+    TEST_ASSERT_EQUAL(2, pow2_buffer[0]);
+
+    TEST_ASSERT_EQUAL(POW2_BUFF_SIZE, ezRingBuffer_Pop(&r_buff, pop_10, BUFF_SIZE));
+    TEST_ASSERT_EQUAL_MEMORY(expected, pop_10, POW2_BUFF_SIZE);
+    TEST_ASSERT_TRUE(ezRingBuffer_IsEmpty(&r_buff));
+
+    /* Non power of two sizes keep the wrapping indices */
+    TEST_ASSERT_TRUE(ezRingBuffer_Init(&r_buff, au8TestBuffer, BUFF_SIZE));
+    TEST_ASSERT_EQUAL(0, r_buff.index_mask);
+}
+
+
+TEST(ez_ring_buffer, power_of_two_index_overflow)
+{
+    ezRingBufferRegion regions[EZ_RING_BUFFER_NUM_OF_REGIONS];
+    uint8_t push_10[BUFF_SIZE] = { 0,1,2,3,4,5,6,7,8,9 };
+    uint8_t pop_10[BUFF_SIZE] = { 0 };
+
+    TEST_ASSERT_TRUE(ezRingBuffer_Init(&r_buff, pow2_buffer, POW2_BUFF_SIZE));
+
+    /* Start close to the maximum index value so the indices overflow */
+    r_buff.head_index = (ezRingBufferSize_t)(0U - 3U);
+    r_buff.tail_index = r_buff.head_index;
+
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        TEST_ASSERT_EQUAL(5, ezRingBuffer_Push(&r_buff, push_10, 5));
+        TEST_ASSERT_EQUAL(5, ezRingBuffer_Pop(&r_buff, pop_10, 5));
+        TEST_ASSERT_EQUAL_MEMORY(push_10, pop_10, 5);
+    }
+
+    TEST_ASSERT_TRUE(ezRingBuffer_Commit(&r_buff, 7));
+    TEST_ASSERT_EQUAL(7, ezRingBuffer_Peek(&r_buff, regions));
+    TEST_ASSERT_EQUAL(7, regions[0].size + regions[1].size);
+    TEST_ASSERT_TRUE(ezRingBuffer_Consume(&r_buff, 7));
+    TEST_ASSERT_TRUE(ezRingBuffer_IsEmpty(&r_buff));
+}
+
+
+TEST(ez_ring_buffer, overwrite_oldest)
+{
+    uint8_t push_10[BUFF_SIZE] = { 0,1,2,3,4,5,6,7,8,9 };
+    uint8_t pop_10[BUFF_SIZE] = { 0 };
+    uint8_t expected[BUFF_SIZE] = { 4,5,6,7,8,9,0,1,2,3 };
+
+    ezRingBuffer_Init(&r_buff, au8TestBuffer, BUFF_SIZE);
+
+    /* Default mode truncates */
+    TEST_ASSERT_EQUAL(BUFF_SIZE, ezRingBuffer_Push(&r_buff, push_10, BUFF_SIZE));
+    TEST_ASSERT_EQUAL(0, ezRingBuffer_Push(&r_buff, push_10, 4));
+    TEST_ASSERT_EQUAL(0, ezRingBuffer_GetDroppedBytes(&r_buff));
+
+    ezRingBuffer_SetOverwrite(&r_buff, true);
+    TEST_ASSERT_EQUAL(4, ezRingBuffer_Push(&r_buff, push_10, 4));
+    TEST_ASSERT_EQUAL(4, ezRingBuffer_GetDroppedBytes(&r_buff));
+    TEST_ASSERT_TRUE(ezRingBuffer_IsFull(&r_buff));
+
+    TEST_ASSERT_EQUAL(BUFF_SIZE, ezRingBuffer_Pop(&r_buff, pop_10, BUFF_SIZE));
+    TEST_ASSERT_EQUAL_MEMORY(expected, pop_10, BUFF_SIZE);
+
+    /* No drop while there is room */
+    TEST_ASSERT_EQUAL(6, ezRingBuffer_Push(&r_buff, push_10, 6));
+    TEST_ASSERT_EQUAL(4, ezRingBuffer_GetDroppedBytes(&r_buff));
+
+    ezRingBuffer_ResetDroppedBytes(&r_buff);
+    TEST_ASSERT_EQUAL(0, ezRingBuffer_GetDroppedBytes(&r_buff));
+}
+
+
+TEST(ez_ring_buffer, overwrite_larger_than_capacity)
+{
+    uint8_t push_15[15] = { 0,1,2,3,4,5,6,7,8,9,10,11,12,13,14 };
+    uint8_t pop_10[BUFF_SIZE] = { 0 };
+
+    ezRingBuffer_Init(&r_buff, au8TestBuffer, BUFF_SIZE);
+    ezRingBuffer_SetOverwrite(&r_buff, true);
+
+    TEST_ASSERT_EQUAL(3, ezRingBuffer_Push(&r_buff, push_15, 3));
+    TEST_ASSERT_EQUAL(BUFF_SIZE, ezRingBuffer_Push(&r_buff, push_15, 15));
+
+    /* 5 bytes of the input and the 3 stored bytes are lost */
+    TEST_ASSERT_EQUAL(8, ezRingBuffer_GetDroppedBytes(&r_buff));
+    TEST_ASSERT_EQUAL(BUFF_SIZE, ezRingBuffer_Pop(&r_buff, pop_10, BUFF_SIZE));
+    TEST_ASSERT_EQUAL_MEMORY(&push_15[5], pop_10, BUFF_SIZE);
+}
+
+
+#if (EZ_RING_BUFFER_32BIT == 1U)
+TEST(ez_ring_buffer, large_capacity)
+{
+    static uint8_t chunk[LARGE_BUFF_SIZE / 4];
+
+    TEST_ASSERT_TRUE(ezRingBuffer_Init(&r_buff, large_buffer, LARGE_BUFF_SIZE));
+    TEST_ASSERT_EQUAL(LARGE_BUFF_SIZE, ezRingBuffer_GetAvailableMemory(&r_buff));
+
+    for (uint32_t i = 0; i < sizeof(chunk); i++)
+    {
+        chunk[i] = (uint8_t)i;
+    }
+
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        TEST_ASSERT_EQUAL(sizeof(chunk), ezRingBuffer_Push(&r_buff, chunk, sizeof(chunk)));
+    }
+    TEST_ASSERT_TRUE(ezRingBuffer_IsFull(&r_buff));
+
+    TEST_ASSERT_EQUAL(sizeof(chunk), ezRingBuffer_Pop(&r_buff, chunk, sizeof(chunk)));
+    TEST_ASSERT_EQUAL(0xFF, chunk[0xFF]);
+    TEST_ASSERT_EQUAL(LARGE_BUFF_SIZE / 4, ezRingBuffer_GetAvailableMemory(&r_buff));
+}
+#endif
+
+
+#if (EZ_RING_BUFFER_MIRROR == 1U)
+TEST(ez_ring_buffer, mirrored)
+{
+    ezRingBufferRegion regions[EZ_RING_BUFFER_NUM_OF_REGIONS];
+    uint8_t push_10[BUFF_SIZE] = { 0,1,2,3,4,5,6,7,8,9 };
+    uint8_t pop_10[BUFF_SIZE] = { 0 };
+    ezRingBufferSize_t capacity;
+
+    TEST_ASSERT_FALSE(ezRingBuffer_InitMirrored(&r_buff, 0));
+    TEST_ASSERT_TRUE(ezRingBuffer_InitMirrored(&r_buff, 100));
+    TEST_ASSERT_TRUE(r_buff.is_mirrored);
+    capacity = r_buff.capacity;
+    TEST_ASSERT_GREATER_OR_EQUAL(100, capacity);
+
+    /* Both halves alias the same memory */
+    r_buff.buff[0] = 0xA5;
+    TEST_ASSERT_EQUAL(0xA5, r_buff.buff[capacity]);
+
+    /* Move head and tail close to the end of the storage */
+    TEST_ASSERT_TRUE(ezRingBuffer_Commit(&r_buff, (ezRingBufferSize_t)(capacity - 4)));
+    TEST_ASSERT_TRUE(ezRingBuffer_Consume(&r_buff, (ezRingBufferSize_t)(capacity - 4)));
+
+    /* Free space is one contiguous region across the wrap point */
+    TEST_ASSERT_EQUAL(capacity, ezRingBuffer_Reserve(&r_buff, regions));
+    TEST_ASSERT_EQUAL(capacity, regions[0].size);
+    TEST_ASSERT_EQUAL(0, regions[1].size);
+
+    TEST_ASSERT_EQUAL(BUFF_SIZE, ezRingBuffer_Push(&r_buff, push_10, BUFF_SIZE));
+    TEST_ASSERT_EQUAL(4, r_buff.buff[0]);
+
+    TEST_ASSERT_EQUAL(BUFF_SIZE, ezRingBuffer_Peek(&r_buff, regions));
+    TEST_ASSERT_EQUAL(BUFF_SIZE, regions[0].size);
+    TEST_ASSERT_EQUAL(0, regions[1].size);
+    TEST_ASSERT_EQUAL_MEMORY(push_10, regions[0].data, BUFF_SIZE);
+
+    TEST_ASSERT_EQUAL(BUFF_SIZE, ezRingBuffer_Pop(&r_buff, pop_10, BUFF_SIZE));
+    TEST_ASSERT_EQUAL_MEMORY(push_10, pop_10, BUFF_SIZE);
+    TEST_ASSERT_TRUE(ezRingBuffer_IsEmpty(&r_buff));
+
+    ezRingBuffer_DeinitMirrored(&r_buff);
+    TEST_ASSERT_NULL(r_buff.buff);
+}
+#endif
+
+
 /******************************************************************************
 * Internal functions
 *******************************************************************************/
@@ -0,0 +1,269 @@
+/*****************************************************************************
+* Filename:         unittest_ez_spsc_ring_buffer.c
+* Author:           Hai Nguyen
+* Original Date:    16.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   unittest_ez_spsc_ring_buffer.c
+ *  @author Hai Nguyen
+ *  @date   16.10.2026
+ *  @brief  Unit test for the single-producer/single-consumer ring buffer
+ *
+ *  @details The stress test runs a producer and a consumer thread
+ *  concurrently and checks that the byte stream arrives complete and in
+ *  order.
+ */
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <sched.h>
+#include "unity.h"
+#include "unity_fixture.h"
+#include "ez_spsc_ring_buffer.h"
+
+TEST_GROUP(ez_spsc_ring_buffer);
+
+/******************************************************************************
+* Module Preprocessor Macros
+*******************************************************************************/
+#define BUFF_SIZE           10
+#define STRESS_BUFF_SIZE    97          /**< odd size to exercise wrapping */
+#define STRESS_NUM_OF_BYTES 1000000U
+#define STRESS_MAX_CHUNK    37U
+
+
+/******************************************************************************
+* Module Typedefs
+*******************************************************************************/
+/* None */
+
+
+/******************************************************************************
+* Module Variable Definitions
+*******************************************************************************/
+static uint8_t test_buffer[BUFF_SIZE] = { 0 };
+static uint8_t stress_buffer[STRESS_BUFF_SIZE] = { 0 };
+static ezSpscRingBuffer r_buff;
+static ezSpscRingBuffer stress_r_buff;
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+static void RunAllTests(void);
+static void *Producer(void *arg);
+static void *Consumer(void *arg);
+
+/******************************************************************************
+* External functions
+*******************************************************************************/
+int main(int argc, const char *argv[])
+{
+    return UnityMain(argc, argv, RunAllTests);
+}
+
+
+TEST_SETUP(ez_spsc_ring_buffer)
+{
+    (void)ezSpscRingBuffer_Init(&r_buff, test_buffer, BUFF_SIZE);
+}
+
+
+TEST_TEAR_DOWN(ez_spsc_ring_buffer)
+{
+}
+
+
+TEST_GROUP_RUNNER(ez_spsc_ring_buffer)
+{
+    RUN_TEST_CASE(ez_spsc_ring_buffer, Init);
+    RUN_TEST_CASE(ez_spsc_ring_buffer, PushPop);
+    RUN_TEST_CASE(ez_spsc_ring_buffer, Overflow);
+    RUN_TEST_CASE(ez_spsc_ring_buffer, Wrapping);
+    RUN_TEST_CASE(ez_spsc_ring_buffer, StressTwoThreads);
+}
+
+
+TEST(ez_spsc_ring_buffer, Init)
+{
+    TEST_ASSERT_FALSE(ezSpscRingBuffer_Init(NULL, test_buffer, BUFF_SIZE));
+    TEST_ASSERT_FALSE(ezSpscRingBuffer_Init(&r_buff, NULL, BUFF_SIZE));
+    TEST_ASSERT_FALSE(ezSpscRingBuffer_Init(&r_buff, test_buffer, 0));
+
+    TEST_ASSERT_TRUE(ezSpscRingBuffer_Init(&r_buff, test_buffer, BUFF_SIZE));
+    TEST_ASSERT_EQUAL(BUFF_SIZE, r_buff.capacity);
+    TEST_ASSERT_TRUE(ezSpscRingBuffer_IsEmpty(&r_buff));
+    TEST_ASSERT_FALSE(ezSpscRingBuffer_IsFull(&r_buff));
+    TEST_ASSERT_EQUAL(BUFF_SIZE, ezSpscRingBuffer_GetAvailableMemory(&r_buff));
+}
+
+
+TEST(ez_spsc_ring_buffer, PushPop)
+{
+    uint8_t push_data[BUFF_SIZE] = { 0,1,2,3,4,5,6,7,8,9 };
+    uint8_t pop_data[BUFF_SIZE] = { 0 };
+
+    TEST_ASSERT_EQUAL(4, ezSpscRingBuffer_Push(&r_buff, push_data, 4));
+    TEST_ASSERT_EQUAL(4, ezSpscRingBuffer_GetUsedMemory(&r_buff));
+
+    TEST_ASSERT_EQUAL(4, ezSpscRingBuffer_Pop(&r_buff, pop_data, BUFF_SIZE));
+    TEST_ASSERT_EQUAL_MEMORY(push_data, pop_data, 4);
+    TEST_ASSERT_TRUE(ezSpscRingBuffer_IsEmpty(&r_buff));
+
+    TEST_ASSERT_EQUAL(0, ezSpscRingBuffer_Pop(&r_buff, pop_data, BUFF_SIZE));
+}
+
+
+TEST(ez_spsc_ring_buffer, Overflow)
+{
+    uint8_t push_data[BUFF_SIZE] = { 0,1,2,3,4,5,6,7,8,9 };
+
+    TEST_ASSERT_EQUAL(BUFF_SIZE, ezSpscRingBuffer_Push(&r_buff, push_data, BUFF_SIZE));
+    TEST_ASSERT_TRUE(ezSpscRingBuffer_IsFull(&r_buff));
+    TEST_ASSERT_EQUAL(0, ezSpscRingBuffer_GetAvailableMemory(&r_buff));
+
+    TEST_ASSERT_EQUAL(0, ezSpscRingBuffer_Push(&r_buff, push_data, BUFF_SIZE));
+
+    ezSpscRingBuffer_Reset(&r_buff);
+    TEST_ASSERT_TRUE(ezSpscRingBuffer_IsEmpty(&r_buff));
+}
+
+
+TEST(ez_spsc_ring_buffer, Wrapping)
+{
+    uint8_t push_data[BUFF_SIZE] = { 0,1,2,3,4,5,6,7,8,9 };
+    uint8_t pop_data[BUFF_SIZE] = { 0 };
+    uint8_t expected[BUFF_SIZE] = { 2,3,4,5,6,0,1,2,3,4 };
+
+    TEST_ASSERT_EQUAL(7, ezSpscRingBuffer_Push(&r_buff, push_data, 7));
+    TEST_ASSERT_EQUAL(2, ezSpscRingBuffer_Pop(&r_buff, pop_data, 2));
+    TEST_ASSERT_EQUAL(5, ezSpscRingBuffer_Push(&r_buff, push_data, 5));
+    TEST_ASSERT_TRUE(ezSpscRingBuffer_IsFull(&r_buff));
+
+    TEST_ASSERT_EQUAL(3, test_buffer[0]);
+    TEST_ASSERT_EQUAL(4, test_buffer[1]);
+    TEST_ASSERT_EQUAL(0, test_buffer[7]);
+
+    TEST_ASSERT_EQUAL(BUFF_SIZE, ezSpscRingBuffer_Pop(&r_buff, pop_data, BUFF_SIZE));
+    TEST_ASSERT_EQUAL_MEMORY(expected, pop_data, BUFF_SIZE);
+
+    /* Run several laps so the indices pass 2 * capacity */
+    for (uint32_t i = 0; i < 5 * BUFF_SIZE; i++)
+    {
+        TEST_ASSERT_EQUAL(3, ezSpscRingBuffer_Push(&r_buff, push_data, 3));
+        TEST_ASSERT_EQUAL(3, ezSpscRingBuffer_Pop(&r_buff, pop_data, 3));
+        TEST_ASSERT_EQUAL_MEMORY(push_data, pop_data, 3);
+    }
+    TEST_ASSERT_TRUE(ezSpscRingBuffer_IsEmpty(&r_buff));
+}
+
+
+TEST(ez_spsc_ring_buffer, StressTwoThreads)
+{
+    pthread_t producer;
+    pthread_t consumer;
+    uint32_t mismatch = 0U;
+
+    TEST_ASSERT_TRUE(ezSpscRingBuffer_Init(&stress_r_buff, stress_buffer, STRESS_BUFF_SIZE));
+
+    TEST_ASSERT_EQUAL(0, pthread_create(&consumer, NULL, Consumer, &mismatch));
+    TEST_ASSERT_EQUAL(0, pthread_create(&producer, NULL, Producer, NULL));
+    TEST_ASSERT_EQUAL(0, pthread_join(producer, NULL));
+    TEST_ASSERT_EQUAL(0, pthread_join(consumer, NULL));
+
+    TEST_ASSERT_EQUAL(0, mismatch);
+    TEST_ASSERT_TRUE(ezSpscRingBuffer_IsEmpty(&stress_r_buff));
+}
+
+
+/******************************************************************************
+* Internal functions
+*******************************************************************************/
+static void RunAllTests(void)
+{
+    RUN_TEST_GROUP(ez_spsc_ring_buffer);
+}
+
+
+static void *Producer(void *arg)
+{
+    uint8_t chunk[STRESS_MAX_CHUNK];
+    uint32_t sent = 0U;
+    uint32_t chunk_size = 1U;
+    (void)arg;
+
+    while (sent < STRESS_NUM_OF_BYTES)
+    {
+        uint32_t count = chunk_size;
+        if (count > STRESS_NUM_OF_BYTES - sent)
+        {
+            count = STRESS_NUM_OF_BYTES - sent;
+        }
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            chunk[i] = (uint8_t)((sent + i) % 251U);
+        }
+
+        uint32_t pushed = 0U;
+        while (pushed < count)
+        {
+            uint32_t n = ezSpscRingBuffer_Push(&stress_r_buff, &chunk[pushed], count - pushed);
+            if (n == 0U)
+            {
+                (void)sched_yield();
+            }
+            pushed += n;
+        }
+
+        sent += count;
+        chunk_size = (chunk_size % STRESS_MAX_CHUNK) + 1U;
+    }
+
+    return NULL;
+}
+
+
+static void *Consumer(void *arg)
+{
+    uint32_t *mismatch = (uint32_t *)arg;
+    uint8_t chunk[STRESS_MAX_CHUNK];
+    uint32_t received = 0U;
+    uint32_t chunk_size = STRESS_MAX_CHUNK;
+
+    while (received < STRESS_NUM_OF_BYTES)
+    {
+        uint32_t popped = ezSpscRingBuffer_Pop(&stress_r_buff, chunk, chunk_size);
+        if (popped == 0U)
+        {
+            (void)sched_yield();
+        }
+        for (uint32_t i = 0; i < popped; i++)
+        {
+            if (chunk[i] != (uint8_t)((received + i) % 251U))
+            {
+                (*mismatch)++;
+            }
+        }
+
+        received += popped;
+        chunk_size = (chunk_size > 1U) ? (chunk_size - 1U) : STRESS_MAX_CHUNK;
+    }
+
+    return NULL;
+}
+
+
+/* End of file */
@@ -0,0 +1,187 @@
+/*****************************************************************************
+* Filename:         benchmark_ez_static_alloc.c
+* Author:           Hai Nguyen
+* Original Date:    16.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   benchmark_ez_static_alloc.c
+ *  @author Hai Nguyen
+ *  @date   16.10.2026
+ *  @brief  Latency benchmark of the static allocation backends
+ *
+ *  @details Keeps up to BENCH_NUM_OF_SLOTS blocks of random size alive and
+ *  randomly frees or allocates one of them, like a queue holding hundreds of
+ *  messages. Prints the latency percentiles of malloc and free for the first
+ *  fit and the TLSF backend.
+ *  Not part of the unit test run, execute ez_static_alloc_benchmark manually.
+ */
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "ez_static_alloc.h"
+
+
+/******************************************************************************
+* Module Preprocessor Macros
+*******************************************************************************/
+#define BENCH_HEAP_SIZE         60000U
+#define BENCH_NUM_OF_SLOTS      400U
+#define BENCH_NUM_OF_DESC       1024U
+#define BENCH_NUM_OF_OPS        200000U
+#define BENCH_MIN_SIZE          16U
+#define BENCH_MAX_SIZE          256U
+
+
+/******************************************************************************
+* Module Typedefs
+*******************************************************************************/
+/* None */
+
+
+/******************************************************************************
+* Module Variable Definitions
+*******************************************************************************/
+static uint8_t heap[BENCH_HEAP_SIZE];
+static struct MemBlock blocks[BENCH_NUM_OF_DESC];
+static void *slots[BENCH_NUM_OF_SLOTS];
+static uint32_t malloc_ns[BENCH_NUM_OF_OPS];
+static uint32_t free_ns[BENCH_NUM_OF_OPS];
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+static uint64_t NowNs(void);
+static int CompareU32(const void *a, const void *b);
+static void PrintPercentiles(const char *name, const char *op, uint32_t *samples, uint32_t count);
+static void RunBenchmark(const char *name, ezmMemList *mem_list);
+
+
+/******************************************************************************
+* External functions
+*******************************************************************************/
+int main(void)
+{
+    ezmMemList mem_list;
+
+    printf("%-10s %-6s %8s %8s %8s %8s %8s %8s\n",
+           "backend", "op", "count", "p50", "p90", "p99", "p99.9", "max");
+
+    if (ezStaticAlloc_InitMemListWithBlocks(&mem_list, heap, sizeof(heap), blocks, BENCH_NUM_OF_DESC))
+    {
+        RunBenchmark("first fit", &mem_list);
+    }
+
+    if (ezStaticAlloc_InitMemListTlsf(&mem_list, heap, sizeof(heap)))
+    {
+        RunBenchmark("tlsf", &mem_list);
+    }
+
+    printf("latency in ns\n");
+    return 0;
+}
+
+
+/******************************************************************************
+* Internal functions
+*******************************************************************************/
+static uint64_t NowNs(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * 1000000000U) + (uint64_t)now.tv_nsec;
+}
+
+
+static int CompareU32(const void *a, const void *b)
+{
+    uint32_t lhs = *(const uint32_t *)a;
+    uint32_t rhs = *(const uint32_t *)b;
+    return (lhs > rhs) - (lhs < rhs);
+}
+
+
+static void PrintPercentiles(const char *name, const char *op, uint32_t *samples, uint32_t count)
+{
+    if (count == 0U)
+    {
+        return;
+    }
+
+    qsort(samples, count, sizeof(uint32_t), CompareU32);
+    printf("%-10s %-6s %8u %8u %8u %8u %8u %8u\n",
+           name, op, count,
+           samples[count / 2U],
+           samples[(count * 90U) / 100U],
+           samples[(count * 99U) / 100U],
+           samples[(count * 999U) / 1000U],
+           samples[count - 1U]);
+}
+
+
+static void RunBenchmark(const char *name, ezmMemList *mem_list)
+{
+    uint32_t seed = 1U;
+    uint32_t num_of_malloc = 0U;
+    uint32_t num_of_free = 0U;
+    uint32_t num_of_failed = 0U;
+
+    for (uint32_t i = 0; i < BENCH_NUM_OF_SLOTS; i++)
+    {
+        slots[i] = NULL;
+    }
+
+    for (uint32_t op = 0; op < BENCH_NUM_OF_OPS; op++)
+    {
+        seed = seed * 1103515245U + 12345U;
+        uint32_t slot = (seed >> 8) % BENCH_NUM_OF_SLOTS;
+        uint64_t start = 0U;
+
+        if (slots[slot] != NULL)
+        {
+            start = NowNs();
+            (void)ezStaticAlloc_Free(mem_list, slots[slot]);
+            free_ns[num_of_free++] = (uint32_t)(NowNs() - start);
+            slots[slot] = NULL;
+        }
+        else
+        {
+            seed = seed * 1103515245U + 12345U;
+            uint16_t size = (uint16_t)(BENCH_MIN_SIZE + ((seed >> 8) % (BENCH_MAX_SIZE - BENCH_MIN_SIZE)));
+
+            start = NowNs();
+            slots[slot] = ezStaticAlloc_Malloc(mem_list, size);
+            malloc_ns[num_of_malloc++] = (uint32_t)(NowNs() - start);
+            num_of_failed += (slots[slot] == NULL) ? 1U : 0U;
+        }
+    }
+
+    for (uint32_t i = 0; i < BENCH_NUM_OF_SLOTS; i++)
+    {
+        if (slots[i] != NULL)
+        {
+            (void)ezStaticAlloc_Free(mem_list, slots[i]);
+        }
+    }
+
+    PrintPercentiles(name, "malloc", malloc_ns, num_of_malloc);
+    PrintPercentiles(name, "free", free_ns, num_of_free);
+    printf("%-10s failed allocations: %u\n", name, num_of_failed);
+}
+
+
+/* End of file */
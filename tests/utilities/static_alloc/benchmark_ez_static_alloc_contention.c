@@ -0,0 +1,221 @@
+/*****************************************************************************
+* Filename:         benchmark_ez_static_alloc_contention.c
+* Author:           Hai Nguyen
+* Original Date:    16.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   benchmark_ez_static_alloc_contention.c
+ *  @author Hai Nguyen
+ *  @date   16.10.2026
+ *  @brief  Contention benchmark of a memory list shared by several threads
+ *
+ *  @details 1, 2, 4 and 8 threads allocate and free blocks of random size
+ *  from one memory list protected by a mutex, once directly and once through
+ *  a per-thread cache. Prints the throughput and how often the lock was
+ *  taken and found busy.
+ *  Not part of the unit test run, execute ez_static_alloc_contention_benchmark
+ *  manually.
+ */
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include "ez_static_alloc.h"
+
+
+/******************************************************************************
+* Module Preprocessor Macros
+*******************************************************************************/
+#define BENCH_HEAP_SIZE         (256U * 1024U)
+#define BENCH_MAX_THREADS       8U
+#define BENCH_NUM_OF_OPS        200000U     /* malloc/free pairs per thread */
+#define BENCH_HOLD              4U          /* blocks held by a thread */
+#define BENCH_MIN_SIZE          16U
+#define BENCH_MAX_SIZE          256U
+
+
+/******************************************************************************
+* Module Typedefs
+*******************************************************************************/
+typedef struct
+{
+    pthread_mutex_t mutex;
+    uint32_t num_of_locks;
+    uint32_t num_of_busy;
+}BenchLock;
+
+typedef struct
+{
+    uint32_t id;
+    bool use_cache;
+}BenchWorker;
+
+
+/******************************************************************************
+* Module Variable Definitions
+*******************************************************************************/
+static uint8_t heap[BENCH_HEAP_SIZE];
+static ezmMemList mem_list;
+static BenchLock bench_lock = { PTHREAD_MUTEX_INITIALIZER, 0U, 0U };
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+static uint64_t NowNs(void);
+static void BenchLock_Lock(void *context);
+static void BenchLock_Unlock(void *context);
+static void *Worker(void *arg);
+static void RunBenchmark(uint32_t num_of_threads, bool use_cache);
+
+
+/******************************************************************************
+* External functions
+*******************************************************************************/
+int main(void)
+{
+    printf("%-8s %-8s %12s %10s %12s %10s\n",
+           "threads", "mode", "ops/s", "ns/op", "locks", "busy");
+
+    for (uint32_t num_of_threads = 1U; num_of_threads <= BENCH_MAX_THREADS; num_of_threads *= 2U)
+    {
+        RunBenchmark(num_of_threads, false);
+        RunBenchmark(num_of_threads, true);
+    }
+
+    printf("ops: malloc + free pairs of all threads, busy: lock already taken\n");
+    return 0;
+}
+
+
+/******************************************************************************
+* Internal functions
+*******************************************************************************/
+static uint64_t NowNs(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * 1000000000U) + (uint64_t)now.tv_nsec;
+}
+
+
+static void BenchLock_Lock(void *context)
+{
+    BenchLock *lock = (BenchLock *)context;
+
+    if (pthread_mutex_trylock(&lock->mutex) != 0)
+    {
+        pthread_mutex_lock(&lock->mutex);
+        lock->num_of_busy++;
+    }
+    lock->num_of_locks++;
+}
+
+
+static void BenchLock_Unlock(void *context)
+{
+    pthread_mutex_unlock(&((BenchLock *)context)->mutex);
+}
+
+
+static void *Worker(void *arg)
+{
+    BenchWorker *worker = (BenchWorker *)arg;
+    ezStaticAllocCache cache;
+    void *held[BENCH_HOLD] = { NULL };
+    uint32_t sizes[BENCH_HOLD] = { 0U };
+    uint32_t seed = worker->id + 1U;
+
+    (void)ezStaticAlloc_InitCache(&cache, &mem_list);
+
+    for (uint32_t op = 0; op < BENCH_NUM_OF_OPS; op++)
+    {
+        uint32_t slot = op % BENCH_HOLD;
+
+        if (held[slot] != NULL)
+        {
+            if (worker->use_cache)
+            {
+                (void)ezStaticAlloc_CacheFree(&cache, held[slot], sizes[slot]);
+            }
+            else
+            {
+                (void)ezStaticAlloc_Free(&mem_list, held[slot]);
+            }
+        }
+
+        seed = seed * 1103515245U + 12345U;
+        sizes[slot] = BENCH_MIN_SIZE + ((seed >> 8) % (BENCH_MAX_SIZE - BENCH_MIN_SIZE));
+        held[slot] = worker->use_cache ? ezStaticAlloc_CacheMalloc(&cache, sizes[slot])
+                                       : ezStaticAlloc_Malloc(&mem_list, sizes[slot]);
+    }
+
+    for (uint32_t i = 0; i < BENCH_HOLD; i++)
+    {
+        if (held[i] != NULL)
+        {
+            (void)ezStaticAlloc_CacheFree(&cache, held[i], sizes[i]);
+        }
+    }
+    ezStaticAlloc_CacheFlush(&cache);
+
+    return NULL;
+}
+
+
+static void RunBenchmark(uint32_t num_of_threads, bool use_cache)
+{
+    static const ezStaticAllocLock lock = { BenchLock_Lock, BenchLock_Unlock, &bench_lock };
+    pthread_t threads[BENCH_MAX_THREADS];
+    BenchWorker workers[BENCH_MAX_THREADS];
+    uint64_t start = 0U;
+    uint64_t elapsed = 0U;
+    uint64_t num_of_ops = (uint64_t)num_of_threads * BENCH_NUM_OF_OPS;
+
+    if (!ezStaticAlloc_InitMemListTlsf(&mem_list, heap, sizeof(heap)))
+    {
+        return;
+    }
+    ezStaticAlloc_SetLock(&mem_list, &lock);
+    bench_lock.num_of_locks = 0U;
+    bench_lock.num_of_busy = 0U;
+
+    start = NowNs();
+    for (uint32_t i = 0; i < num_of_threads; i++)
+    {
+        workers[i].id = i;
+        workers[i].use_cache = use_cache;
+        (void)pthread_create(&threads[i], NULL, Worker, &workers[i]);
+    }
+
+    for (uint32_t i = 0; i < num_of_threads; i++)
+    {
+        (void)pthread_join(threads[i], NULL);
+    }
+    elapsed = NowNs() - start;
+
+    printf("%-8u %-8s %12llu %10llu %12u %10u\n",
+           num_of_threads,
+           use_cache ? "cache" : "lock",
+           (unsigned long long)((num_of_ops * 1000000000U) / elapsed),
+           (unsigned long long)(elapsed / num_of_ops),
+           bench_lock.num_of_locks,
+           bench_lock.num_of_busy);
+}
+
+
+/* End of file */
@@ -0,0 +1,188 @@
+/*****************************************************************************
+* Filename:         benchmark_ez_static_alloc_fragmentation.c
+* Author:           Hai Nguyen
+* Original Date:    16.10.2026
+*
+* ----------------------------------------------------------------------------
+* Contact:          Hai Nguyen
+*                   hainguyen.eeit@gmail.com
+*
+* ----------------------------------------------------------------------------
+* License: This file is published under the license described in LICENSE.md
+*
+*****************************************************************************/
+
+/** @file   benchmark_ez_static_alloc_fragmentation.c
+ *  @author Hai Nguyen
+ *  @date   16.10.2026
+ *  @brief  Long-running fragmentation benchmark of the static allocator
+ *
+ *  @details Runs millions of random allocations and frees: mostly small
+ *  short-lived messages and a few large ones, like a queue under varying
+ *  load. Periodically prints the failed allocations, the largest free block
+ *  and the fragmentation for the first fit backend with pinned blocks, with
+ *  movable blocks compacted when an allocation fails, and for the TLSF
+ *  backend.
+ *  Not part of the unit test run, execute ez_static_alloc_frag_benchmark
+ *  manually.
+ */
+
+/******************************************************************************
+* Includes
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include "ez_static_alloc.h"
+
+
+/******************************************************************************
+* Module Preprocessor Macros
+*******************************************************************************/
+#define BENCH_HEAP_SIZE         16384U
+#define BENCH_NUM_OF_SLOTS      128U
+#define BENCH_NUM_OF_DESC       512U
+#define BENCH_NUM_OF_OPS        4000000U
+#define BENCH_NUM_OF_REPORTS    8U
+#define BENCH_SMALL_MAX_SIZE    96U
+#define BENCH_LARGE_MIN_SIZE    256U
+#define BENCH_LARGE_MAX_SIZE    1024U
+
+
+/******************************************************************************
+* Module Typedefs
+*******************************************************************************/
+typedef enum
+{
+    BENCH_PINNED,       /**< first fit, ezStaticAlloc_Malloc */
+    BENCH_MOVABLE,      /**< first fit, movable blocks and compaction */
+    BENCH_TLSF,         /**< TLSF backend */
+}BenchMode;
+
+
+/******************************************************************************
+* Module Variable Definitions
+*******************************************************************************/
+static uint8_t heap[BENCH_HEAP_SIZE];
+static struct MemBlock blocks[BENCH_NUM_OF_DESC];
+static void *slots[BENCH_NUM_OF_SLOTS];
+
+
+/******************************************************************************
+* Function Definitions
+*******************************************************************************/
+static uint32_t NextRandom(uint32_t *seed);
+static void *Allocate(ezmMemList *mem_list, BenchMode mode, uint32_t slot, uint16_t size, uint32_t *num_of_compactions);
+static void RunBenchmark(const char *name, ezmMemList *mem_list, BenchMode mode);
+
+
+/******************************************************************************
+* External functions
+*******************************************************************************/
+int main(void)
+{
+    ezmMemList mem_list;
+
+    printf("%-10s %10s %10s %10s %8s %8s\n",
+           "mode", "ops", "failed", "compacts", "largest", "frag%");
+
+    if (ezStaticAlloc_InitMemListWithBlocks(&mem_list, heap, sizeof(heap), blocks, BENCH_NUM_OF_DESC))
+    {
+        RunBenchmark("first fit", &mem_list, BENCH_PINNED);
+    }
+
+    if (ezStaticAlloc_InitMemListWithBlocks(&mem_list, heap, sizeof(heap), blocks, BENCH_NUM_OF_DESC))
+    {
+        RunBenchmark("compact", &mem_list, BENCH_MOVABLE);
+    }
+
+    if (ezStaticAlloc_InitMemListTlsf(&mem_list, heap, sizeof(heap)))
+    {
+        RunBenchmark("tlsf", &mem_list, BENCH_TLSF);
+    }
+
+    printf("failed and compacts are cumulative, largest free block in bytes\n");
+    return 0;
+}
+
+
+/******************************************************************************
+* Internal functions
+*******************************************************************************/
+static uint32_t NextRandom(uint32_t *seed)
+{
+    *seed = *seed * 1103515245U + 12345U;
+    return *seed >> 8;
+}
+
+
+static void *Allocate(ezmMemList *mem_list, BenchMode mode, uint32_t slot, uint16_t size, uint32_t *num_of_compactions)
+{
+    if (mode != BENCH_MOVABLE)
+    {
+        return ezStaticAlloc_Malloc(mem_list, size);
+    }
+
+    /* the slot itself is the handle updated by the compaction */
+    if (ezStaticAlloc_MallocMovable(mem_list, &slots[slot], size) == false)
+    {
+        (*num_of_compactions)++;
+        if (ezStaticAlloc_Compact(mem_list) > 0U)
+        {
+            (void)ezStaticAlloc_MallocMovable(mem_list, &slots[slot], size);
+        }
+    }
+    return slots[slot];
+}
+
+
+static void RunBenchmark(const char *name, ezmMemList *mem_list, BenchMode mode)
+{
+    ezStaticAllocStats stats;
+    uint32_t seed = 1U;
+    uint32_t num_of_compactions = 0U;
+
+    for (uint32_t i = 0; i < BENCH_NUM_OF_SLOTS; i++)
+    {
+        slots[i] = NULL;
+    }
+
+    for (uint32_t op = 1; op <= BENCH_NUM_OF_OPS; op++)
+    {
+        uint32_t slot = NextRandom(&seed) % BENCH_NUM_OF_SLOTS;
+
+        if (slots[slot] != NULL)
+        {
+            (void)ezStaticAlloc_Free(mem_list, slots[slot]);
+            slots[slot] = NULL;
+        }
+        else
+        {
+            /* one of 16 messages is large */
+            uint16_t size = ((NextRandom(&seed) % 16U) == 0U)
+                ? (uint16_t)(BENCH_LARGE_MIN_SIZE + (NextRandom(&seed) % (BENCH_LARGE_MAX_SIZE - BENCH_LARGE_MIN_SIZE)))
+                : (uint16_t)(1U + (NextRandom(&seed) % BENCH_SMALL_MAX_SIZE));
+
+            slots[slot] = Allocate(mem_list, mode, slot, size, &num_of_compactions);
+        }
+
+        if ((op % (BENCH_NUM_OF_OPS / BENCH_NUM_OF_REPORTS)) == 0U
+            && ezStaticAlloc_GetStats(mem_list, &stats))
+        {
+            printf("%-10s %10u %10u %10u %8u %8u\n",
+                   name, op, stats.counters.num_of_failed, num_of_compactions,
+                   stats.largest_free_block, stats.fragmentation);
+        }
+    }
+
+    for (uint32_t i = 0; i < BENCH_NUM_OF_SLOTS; i++)
+    {
+        if (slots[i] != NULL)
+        {
+            (void)ezStaticAlloc_Free(mem_list, slots[i]);
+        }
+    }
+}
+
+
+/* End of file */
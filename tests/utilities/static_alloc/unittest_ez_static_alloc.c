@@ -27,6 +27,8 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <string.h>
+#include <pthread.h>
+#include <sched.h>
 #include "unity.h"
 #include "unity_fixture.h"
 #include "ez_static_alloc.h"
@@ -36,25 +38,48 @@ TEST_GROUP(ez_static_alloc);
 /******************************************************************************
 * Module Preprocessor Macros
 *******************************************************************************/
-/* None */
+#define STRESS_NUM_OF_THREADS   4U
+#define STRESS_NUM_OF_ROUNDS    5000U
+#define STRESS_HOLD             3U
 
 
 /******************************************************************************
 * Module Typedefs
 *******************************************************************************/
-/* None */
+typedef struct
+{
+    pthread_mutex_t mutex;
+    uint32_t num_of_locks;
+}TestLock;
+
+typedef struct
+{
+    ezmMemList *mem_list;
+    uint32_t id;
+    bool use_cache;
+    uint32_t errors;
+}TestWorker;
 
 
 /******************************************************************************
 * Module Variable Definitions
 *******************************************************************************/
 static uint8_t au8Buffer[512] = {0};
+static uint8_t au8TlsfBuffer[2048] = {0};
+static uint8_t au8StressBuffer[16384] = {0};
+static uint64_t au64AlignedBuffer[64] = {0};
+static TestLock stTestLock = { PTHREAD_MUTEX_INITIALIZER, 0U };
+static TestLock stTestLock2 = { PTHREAD_MUTEX_INITIALIZER, 0U };
+static TestLock stSharedPoolLock = { PTHREAD_MUTEX_INITIALIZER, 0U };
 
 
 /******************************************************************************
 * Function Definitions
 *******************************************************************************/
 static void RunAllTests(void);
+static void TestLock_Lock(void *context);
+static void TestLock_Unlock(void *context);
+static void *StressWorker(void *arg);
 
 /******************************************************************************
 * External functions
@@ -82,6 +107,28 @@ TEST_GROUP_RUNNER(ez_static_alloc)
     RUN_TEST_CASE(ez_static_alloc, u32_var);
     RUN_TEST_CASE(ez_static_alloc, array_1);
     RUN_TEST_CASE(ez_static_alloc, array_2);
+    RUN_TEST_CASE(ez_static_alloc, own_blocks);
+    RUN_TEST_CASE(ez_static_alloc, carved_blocks);
+    RUN_TEST_CASE(ez_static_alloc, tlsf_malloc_free);
+    RUN_TEST_CASE(ez_static_alloc, tlsf_coalesce);
+    RUN_TEST_CASE(ez_static_alloc, tlsf_random);
+    RUN_TEST_CASE(ez_static_alloc, stats_first_fit);
+    RUN_TEST_CASE(ez_static_alloc, stats_tlsf);
+    RUN_TEST_CASE(ez_static_alloc, coalesce_neighbours);
+    RUN_TEST_CASE(ez_static_alloc, compact);
+    RUN_TEST_CASE(ez_static_alloc, large_buffer);
+    RUN_TEST_CASE(ez_static_alloc, aligned_first_fit);
+    RUN_TEST_CASE(ez_static_alloc, aligned_short_of_blocks);
+    RUN_TEST_CASE(ez_static_alloc, aligned_tlsf);
+    RUN_TEST_CASE(ez_static_alloc, aligned_tlsf_small);
+    RUN_TEST_CASE(ez_static_alloc, realloc_first_fit);
+    RUN_TEST_CASE(ez_static_alloc, realloc_tlsf);
+    RUN_TEST_CASE(ez_static_alloc, heap_regions);
+    RUN_TEST_CASE(ez_static_alloc, heap_placement);
+    RUN_TEST_CASE(ez_static_alloc, cache);
+    RUN_TEST_CASE(ez_static_alloc, thread_safe);
+    RUN_TEST_CASE(ez_static_alloc, shared_pool_lock);
+    RUN_TEST_CASE(ez_static_alloc, free_batch);
 }
 
 
@@ -389,6 +436,978 @@ TEST(ez_static_alloc, array_2)
 
 }
 
+TEST(ez_static_alloc, own_blocks)
+{
+    ezmMemList stMemList;
+    ezmMemList stSharedList;
+    struct MemBlock astBlocks[2];
+    uint8_t au8SharedBuffer[32];
+
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitMemListWithBlocks(&stMemList, au8Buffer, 512, astBlocks, 2));
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitMemList(&stSharedList, au8SharedBuffer, sizeof(au8SharedBuffer)));
+
+    /* first allocation splits the buffer and uses both descriptors */
+    uint8_t* pu8Var1 = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, 16);
+    TEST_ASSERT_EQUAL_PTR(&au8Buffer[0], pu8Var1);
+    TEST_ASSERT_EQUAL(1U, ezStaticAlloc_GetNumOfFreeBlock(&stMemList));
+    TEST_ASSERT_EQUAL(1U, ezStaticAlloc_GetNumOfAllocBlock(&stMemList));
+
+    /* no descriptor left for the remainder, the whole block is handed out */
+    uint8_t* pu8Var2 = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, 16);
+    TEST_ASSERT_EQUAL_PTR(&au8Buffer[16], pu8Var2);
+    TEST_ASSERT_EQUAL(0U, ezStaticAlloc_GetNumOfFreeBlock(&stMemList));
+    TEST_ASSERT_NULL(ezStaticAlloc_Malloc(&stMemList, 1));
+
+    /* lists using the shared pool are not affected */
+    TEST_ASSERT_NOT_NULL(ezStaticAlloc_Malloc(&stSharedList, 8));
+    TEST_ASSERT_NOT_NULL(ezStaticAlloc_Malloc(&stSharedList, 8));
+
+    /* descriptors are returned on free and merge */
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, pu8Var2));
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, pu8Var1));
+    TEST_ASSERT_EQUAL(1U, ezStaticAlloc_GetNumOfFreeBlock(&stMemList));
+    TEST_ASSERT_EQUAL(0U, ezStaticAlloc_GetNumOfAllocBlock(&stMemList));
+    TEST_ASSERT_EQUAL_PTR(&au8Buffer[0], ezStaticAlloc_Malloc(&stMemList, 512));
+}
+
+TEST(ez_static_alloc, carved_blocks)
+{
+    ezmMemList stMemList;
+    static uint8_t au8CarvedBuffer[128 + EZ_STATIC_ALLOC_BLOCKS_SIZE(4)];
+
+    TEST_ASSERT_FALSE(ezStaticAlloc_InitMemListWithBlocks(&stMemList, au8CarvedBuffer, sizeof(struct MemBlock), NULL, 4));
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitMemListWithBlocks(&stMemList, au8CarvedBuffer, sizeof(au8CarvedBuffer), NULL, 4));
+
+    /* descriptors sit in front of the managed memory */
+    uint8_t* pu8Array = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, 128);
+    TEST_ASSERT_NOT_NULL(pu8Array);
+    TEST_ASSERT_TRUE(pu8Array >= &au8CarvedBuffer[4 * sizeof(struct MemBlock)]);
+    TEST_ASSERT_TRUE(pu8Array + 128 <= &au8CarvedBuffer[sizeof(au8CarvedBuffer)]);
+    memset(pu8Array, 0xAA, 128);
+
+    /* four descriptors allow at most four blocks */
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, pu8Array));
+    TEST_ASSERT_NOT_NULL(ezStaticAlloc_Malloc(&stMemList, 1));
+    TEST_ASSERT_NOT_NULL(ezStaticAlloc_Malloc(&stMemList, 1));
+    TEST_ASSERT_NOT_NULL(ezStaticAlloc_Malloc(&stMemList, 1));
+    TEST_ASSERT_NOT_NULL(ezStaticAlloc_Malloc(&stMemList, 1));
+    TEST_ASSERT_NULL(ezStaticAlloc_Malloc(&stMemList, 1));
+    TEST_ASSERT_EQUAL(4U, ezStaticAlloc_GetNumOfAllocBlock(&stMemList));
+}
+
+TEST(ez_static_alloc, tlsf_malloc_free)
+{
+    ezmMemList stMemList;
+    uint8_t au8Small[16];
+
+    TEST_ASSERT_FALSE(ezStaticAlloc_InitMemListTlsf(&stMemList, au8Small, sizeof(au8Small)));
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitMemListTlsf(&stMemList, au8TlsfBuffer, sizeof(au8TlsfBuffer)));
+    TEST_ASSERT_TRUE(ezStaticAlloc_IsMemListReady(&stMemList));
+    TEST_ASSERT_EQUAL(0U, ezStaticAlloc_GetNumOfAllocBlock(&stMemList));
+    TEST_ASSERT_EQUAL(1U, ezStaticAlloc_GetNumOfFreeBlock(&stMemList));
+
+    uint32_t* pu32Var = (uint32_t*)ezStaticAlloc_Malloc(&stMemList, sizeof(uint32_t));
+    uint8_t* pu8Array = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, 100);
+    TEST_ASSERT_NOT_NULL(pu32Var);
+    TEST_ASSERT_NOT_NULL(pu8Array);
+    TEST_ASSERT_EQUAL(0U, (uintptr_t)pu32Var % sizeof(void*));
+    TEST_ASSERT_EQUAL(0U, (uintptr_t)pu8Array % sizeof(void*));
+    TEST_ASSERT_TRUE(pu8Array >= (uint8_t*)(pu32Var + 1));
+    TEST_ASSERT_TRUE(pu8Array + 100 <= &au8TlsfBuffer[sizeof(au8TlsfBuffer)]);
+    TEST_ASSERT_EQUAL(2U, ezStaticAlloc_GetNumOfAllocBlock(&stMemList));
+    TEST_ASSERT_EQUAL(1U, ezStaticAlloc_GetNumOfFreeBlock(&stMemList));
+
+    *pu32Var = 0xDEADBEEF;
+    memset(pu8Array, 0x55, 100);
+    TEST_ASSERT_EQUAL_UINT32(0xDEADBEEF, *pu32Var);
+
+    /* too large, unknown address, double free */
+    TEST_ASSERT_NULL(ezStaticAlloc_Malloc(&stMemList, sizeof(au8TlsfBuffer)));
+    TEST_ASSERT_NULL(ezStaticAlloc_Malloc(&stMemList, 0));
+    TEST_ASSERT_FALSE(ezStaticAlloc_Free(&stMemList, &au8Small[0]));
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, pu32Var));
+    TEST_ASSERT_FALSE(ezStaticAlloc_Free(&stMemList, pu32Var));
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, pu8Array));
+    TEST_ASSERT_EQUAL(0U, ezStaticAlloc_GetNumOfAllocBlock(&stMemList));
+    TEST_ASSERT_EQUAL(1U, ezStaticAlloc_GetNumOfFreeBlock(&stMemList));
+}
+
+TEST(ez_static_alloc, tlsf_coalesce)
+{
+    ezmMemList stMemList;
+    void* apvBlocks[4];
+    uint16_t u16Largest = 0;
+
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitMemListTlsf(&stMemList, au8TlsfBuffer, sizeof(au8TlsfBuffer)));
+
+    /* find the largest possible allocation of the empty heap */
+    for (uint16_t size = sizeof(au8TlsfBuffer); size > 0 && u16Largest == 0; size--)
+    {
+        void* pvBlock = ezStaticAlloc_Malloc(&stMemList, size);
+        if (pvBlock != NULL)
+        {
+            u16Largest = size;
+            TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, pvBlock));
+        }
+    }
+    TEST_ASSERT_TRUE(u16Largest > 1024);
+
+    for (uint16_t i = 0; i < 4; i++)
+    {
+        apvBlocks[i] = ezStaticAlloc_Malloc(&stMemList, 48);
+        TEST_ASSERT_NOT_NULL(apvBlocks[i]);
+    }
+
+    /* free the middle blocks first, they merge with each other */
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, apvBlocks[1]));
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, apvBlocks[2]));
+    TEST_ASSERT_EQUAL(2U, ezStaticAlloc_GetNumOfFreeBlock(&stMemList));
+
+    /* then the outer ones, merging backward and forward */
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, apvBlocks[0]));
+    TEST_ASSERT_EQUAL(2U, ezStaticAlloc_GetNumOfFreeBlock(&stMemList));
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, apvBlocks[3]));
+    TEST_ASSERT_EQUAL(1U, ezStaticAlloc_GetNumOfFreeBlock(&stMemList));
+
+    /* the whole heap is available again */
+    TEST_ASSERT_NOT_NULL(ezStaticAlloc_Malloc(&stMemList, u16Largest));
+}
+
+TEST(ez_static_alloc, tlsf_random)
+{
+    ezmMemList stMemList;
+    static uint8_t au8Heap[8192];
+    uint8_t* apu8Blocks[64] = {0};
+    uint16_t au16Sizes[64] = {0};
+    uint32_t u32Seed = 12345;
+
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitMemListTlsf(&stMemList, au8Heap, sizeof(au8Heap)));
+
+    for (uint32_t round = 0; round < 20000; round++)
+    {
+        u32Seed = u32Seed * 1103515245U + 12345U;
+        uint32_t u32Slot = (u32Seed >> 16) % 64;
+
+        if (apu8Blocks[u32Slot] != NULL)
+        {
+            /* the content must survive other allocations */
+            for (uint16_t i = 0; i < au16Sizes[u32Slot]; i++)
+            {
+                TEST_ASSERT_EQUAL_UINT8((uint8_t)u32Slot, apu8Blocks[u32Slot][i]);
+            }
+            TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, apu8Blocks[u32Slot]));
+            apu8Blocks[u32Slot] = NULL;
+        }
+        else
+        {
+            au16Sizes[u32Slot] = (uint16_t)(1U + ((u32Seed >> 8) % 300U));
+            apu8Blocks[u32Slot] = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, au16Sizes[u32Slot]);
+            if (apu8Blocks[u32Slot] != NULL)
+            {
+                memset(apu8Blocks[u32Slot], (int)u32Slot, au16Sizes[u32Slot]);
+            }
+        }
+    }
+
+    for (uint32_t i = 0; i < 64; i++)
+    {
+        if (apu8Blocks[i] != NULL)
+        {
+            TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, apu8Blocks[i]));
+        }
+    }
+    TEST_ASSERT_EQUAL(0U, ezStaticAlloc_GetNumOfAllocBlock(&stMemList));
+    TEST_ASSERT_EQUAL(1U, ezStaticAlloc_GetNumOfFreeBlock(&stMemList));
+}
+
+TEST(ez_static_alloc, stats_first_fit)
+{
+    ezmMemList stMemList;
+    ezStaticAllocStats stStats;
+    ezStaticAllocFailure astTrace[2];
+    ezStaticAllocFailure astFailures[4];
+    void* pvBlock1 = NULL;
+    void* pvBlock2 = NULL;
+    void* pvBlock3 = NULL;
+
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitMemList(&stMemList, au8Buffer, 512));
+    ezStaticAlloc_SetFailureTrace(&stMemList, astTrace, 2);
+
+    pvBlock1 = ezStaticAlloc_Malloc(&stMemList, 100);
+    pvBlock2 = ezStaticAlloc_Malloc(&stMemList, 200);
+    pvBlock3 = ezStaticAlloc_Malloc(&stMemList, 100);
+    TEST_ASSERT_NOT_NULL(pvBlock3);
+
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, pvBlock2));
+    TEST_ASSERT_TRUE(ezStaticAlloc_GetStats(&stMemList, &stStats));
+    TEST_ASSERT_EQUAL_UINT32(200U, stStats.counters.used_bytes);
+    TEST_ASSERT_EQUAL_UINT32(400U, stStats.counters.peak_used_bytes);
+    TEST_ASSERT_EQUAL_UINT32(3U, stStats.counters.num_of_malloc);
+    TEST_ASSERT_EQUAL_UINT32(1U, stStats.counters.num_of_free);
+    TEST_ASSERT_EQUAL_UINT32(312U, stStats.free_bytes);
+    TEST_ASSERT_EQUAL_UINT32(200U, stStats.largest_free_block);
+    TEST_ASSERT_EQUAL(2U, stStats.num_of_free_blocks);
+    TEST_ASSERT_EQUAL(2U, stStats.num_of_alloc_blocks);
+    TEST_ASSERT_EQUAL_UINT8(36U, stStats.fragmentation);
+
+    /* enough free bytes but no block large enough */
+    TEST_ASSERT_NULL(ezStaticAlloc_Malloc(&stMemList, 300));
+    TEST_ASSERT_NULL(ezStaticAlloc_Malloc(&stMemList, 250));
+    TEST_ASSERT_NULL(ezStaticAlloc_Malloc(&stMemList, 4000));
+    TEST_ASSERT_NULL(ezStaticAlloc_Malloc(&stMemList, 210));
+    TEST_ASSERT_TRUE(ezStaticAlloc_GetStats(&stMemList, &stStats));
+    TEST_ASSERT_EQUAL_UINT32(4U, stStats.counters.num_of_failed);
+    TEST_ASSERT_EQUAL_UINT32(1U, stStats.counters.failed_by_class[5]);
+    TEST_ASSERT_EQUAL_UINT32(2U, stStats.counters.failed_by_class[4]);
+    TEST_ASSERT_EQUAL_UINT32(1U, stStats.counters.failed_by_class[EZ_STATIC_ALLOC_NUM_OF_SIZE_CLASSES - 1U]);
+    TEST_ASSERT_NOT_NULL(pvBlock1);
+
+    /* the trace keeps the two most recent failures, oldest first */
+    TEST_ASSERT_EQUAL_UINT32(2U, ezStaticAlloc_GetFailures(&stMemList, astFailures, 4));
+    TEST_ASSERT_EQUAL(4000U, astFailures[0].size);
+    TEST_ASSERT_EQUAL(210U, astFailures[1].size);
+    TEST_ASSERT_EQUAL_UINT32(312U, astFailures[1].free_bytes);
+    TEST_ASSERT_EQUAL_UINT32(200U, astFailures[1].largest_free_block);
+    TEST_ASSERT_EQUAL_UINT32(1U, ezStaticAlloc_GetFailures(&stMemList, astFailures, 1));
+    TEST_ASSERT_EQUAL(210U, astFailures[0].size);
+
+    ezStaticAlloc_ResetStats(&stMemList);
+    TEST_ASSERT_TRUE(ezStaticAlloc_GetStats(&stMemList, &stStats));
+    TEST_ASSERT_EQUAL_UINT32(200U, stStats.counters.used_bytes);
+    TEST_ASSERT_EQUAL_UINT32(200U, stStats.counters.peak_used_bytes);
+    TEST_ASSERT_EQUAL_UINT32(0U, stStats.counters.num_of_failed);
+    TEST_ASSERT_EQUAL_UINT32(0U, ezStaticAlloc_GetFailures(&stMemList, astFailures, 4));
+
+    /* a new initialization detaches the trace */
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitMemList(&stMemList, au8Buffer, 512));
+    TEST_ASSERT_NULL(ezStaticAlloc_Malloc(&stMemList, 1000));
+    TEST_ASSERT_EQUAL_UINT32(0U, ezStaticAlloc_GetFailures(&stMemList, astFailures, 4));
+    TEST_ASSERT_TRUE(ezStaticAlloc_GetStats(&stMemList, &stStats));
+    TEST_ASSERT_EQUAL_UINT32(1U, stStats.counters.num_of_failed);
+    TEST_ASSERT_EQUAL_UINT32(512U, stStats.free_bytes);
+    TEST_ASSERT_EQUAL_UINT8(0U, stStats.fragmentation);
+}
+
+TEST(ez_static_alloc, stats_tlsf)
+{
+    ezmMemList stMemList;
+    ezStaticAllocStats stStats;
+    uint32_t u32EmptyFree = 0;
+    void* apvBlocks[4];
+
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitMemListTlsf(&stMemList, au8TlsfBuffer, sizeof(au8TlsfBuffer)));
+    TEST_ASSERT_TRUE(ezStaticAlloc_GetStats(&stMemList, &stStats));
+    u32EmptyFree = stStats.free_bytes;
+    TEST_ASSERT_EQUAL_UINT32(u32EmptyFree, stStats.largest_free_block);
+    TEST_ASSERT_EQUAL_UINT8(0U, stStats.fragmentation);
+
+    for (uint16_t i = 0; i < 4; i++)
+    {
+        apvBlocks[i] = ezStaticAlloc_Malloc(&stMemList, 100);
+        TEST_ASSERT_NOT_NULL(apvBlocks[i]);
+    }
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, apvBlocks[1]));
+
+    TEST_ASSERT_TRUE(ezStaticAlloc_GetStats(&stMemList, &stStats));
+    TEST_ASSERT_EQUAL_UINT32(4U, stStats.counters.num_of_malloc);
+    TEST_ASSERT_EQUAL_UINT32(1U, stStats.counters.num_of_free);
+    TEST_ASSERT_TRUE(stStats.counters.used_bytes >= 300U);
+    TEST_ASSERT_TRUE(stStats.counters.peak_used_bytes > stStats.counters.used_bytes);
+    TEST_ASSERT_EQUAL(3U, stStats.num_of_alloc_blocks);
+    TEST_ASSERT_EQUAL(2U, stStats.num_of_free_blocks);
+    TEST_ASSERT_TRUE(stStats.largest_free_block < stStats.free_bytes);
+    TEST_ASSERT_TRUE(stStats.fragmentation > 0U);
+
+    TEST_ASSERT_NULL(ezStaticAlloc_Malloc(&stMemList, (uint16_t)u32EmptyFree));
+    TEST_ASSERT_TRUE(ezStaticAlloc_GetStats(&stMemList, &stStats));
+    TEST_ASSERT_EQUAL_UINT32(1U, stStats.counters.num_of_failed);
+
+    /* everything back in one block */
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, apvBlocks[0]));
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, apvBlocks[2]));
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, apvBlocks[3]));
+    TEST_ASSERT_TRUE(ezStaticAlloc_GetStats(&stMemList, &stStats));
+    TEST_ASSERT_EQUAL_UINT32(0U, stStats.counters.used_bytes);
+    TEST_ASSERT_EQUAL_UINT32(u32EmptyFree, stStats.free_bytes);
+    TEST_ASSERT_EQUAL_UINT8(0U, stStats.fragmentation);
+}
+
+TEST(ez_static_alloc, coalesce_neighbours)
+{
+    ezmMemList stMemList;
+    void* apvBlocks[3];
+
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitMemList(&stMemList, au8Buffer, 512));
+    for (uint16_t i = 0; i < 3; i++)
+    {
+        apvBlocks[i] = ezStaticAlloc_Malloc(&stMemList, 100);
+        TEST_ASSERT_EQUAL_PTR(&au8Buffer[i * 100], apvBlocks[i]);
+    }
+
+    /* the last block merges forward with the rest of the buffer */
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, apvBlocks[0]));
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, apvBlocks[2]));
+    TEST_ASSERT_EQUAL(2U, ezStaticAlloc_GetNumOfFreeBlock(&stMemList));
+    TEST_ASSERT_EQUAL_PTR(&au8Buffer[200], ezStaticAlloc_Malloc(&stMemList, 312));
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, &au8Buffer[200]));
+
+    /* the middle block merges backward and forward */
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, apvBlocks[1]));
+    TEST_ASSERT_EQUAL(1U, ezStaticAlloc_GetNumOfFreeBlock(&stMemList));
+    TEST_ASSERT_EQUAL(0U, ezStaticAlloc_GetNumOfAllocBlock(&stMemList));
+    TEST_ASSERT_EQUAL_PTR(&au8Buffer[0], ezStaticAlloc_Malloc(&stMemList, 512));
+}
+
+TEST(ez_static_alloc, compact)
+{
+    ezmMemList stMemList;
+    uint8_t* apu8Movable[4] = {0};
+    uint8_t* pu8Pinned = NULL;
+
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitMemList(&stMemList, au8Buffer, 512));
+
+    /* | m0 64 | m1 64 | m2 64 | pinned 64 | m3 64 | free 192 | */
+    for (uint16_t i = 0; i < 3; i++)
+    {
+        TEST_ASSERT_TRUE(ezStaticAlloc_MallocMovable(&stMemList, (void**)&apu8Movable[i], 64));
+        memset(apu8Movable[i], 0xA0 + i, 64);
+    }
+    pu8Pinned = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, 64);
+    TEST_ASSERT_EQUAL_PTR(&au8Buffer[192], pu8Pinned);
+    memset(pu8Pinned, 0x55, 64);
+    TEST_ASSERT_TRUE(ezStaticAlloc_MallocMovable(&stMemList, (void**)&apu8Movable[3], 64));
+    memset(apu8Movable[3], 0xA3, 64);
+    TEST_ASSERT_FALSE(ezStaticAlloc_MallocMovable(&stMemList, NULL, 64));
+
+    /* punch holes before and after the pinned block */
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, apu8Movable[0]));
+    TEST_ASSERT_NULL(apu8Movable[0]);
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, apu8Movable[2]));
+    TEST_ASSERT_EQUAL(3U, ezStaticAlloc_GetNumOfFreeBlock(&stMemList));
+    TEST_ASSERT_NULL(ezStaticAlloc_Malloc(&stMemList, 256));
+
+    /* m1 slides to the start, m3 stays behind the pinned block */
+    TEST_ASSERT_EQUAL_UINT32(1U, ezStaticAlloc_Compact(&stMemList));
+    TEST_ASSERT_EQUAL_PTR(&au8Buffer[0], apu8Movable[1]);
+    TEST_ASSERT_EQUAL_PTR(&au8Buffer[256], apu8Movable[3]);
+    TEST_ASSERT_EQUAL(2U, ezStaticAlloc_GetNumOfFreeBlock(&stMemList));
+    for (uint16_t i = 0; i < 64; i++)
+    {
+        TEST_ASSERT_EQUAL_UINT8(0xA1, apu8Movable[1][i]);
+        TEST_ASSERT_EQUAL_UINT8(0x55, pu8Pinned[i]);
+        TEST_ASSERT_EQUAL_UINT8(0xA3, apu8Movable[3][i]);
+    }
+    TEST_ASSERT_EQUAL_PTR(&au8Buffer[64], ezStaticAlloc_Malloc(&stMemList, 128));
+
+    /* nothing left to move */
+    TEST_ASSERT_EQUAL_UINT32(0U, ezStaticAlloc_Compact(&stMemList));
+
+    /* freed pinned block: m3 slides down over it */
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, pu8Pinned));
+    TEST_ASSERT_EQUAL_UINT32(1U, ezStaticAlloc_Compact(&stMemList));
+    TEST_ASSERT_EQUAL_PTR(&au8Buffer[192], apu8Movable[3]);
+    TEST_ASSERT_EQUAL_UINT8(0xA3, apu8Movable[3][63]);
+    TEST_ASSERT_EQUAL(1U, ezStaticAlloc_GetNumOfFreeBlock(&stMemList));
+    TEST_ASSERT_EQUAL_PTR(&au8Buffer[256], ezStaticAlloc_Malloc(&stMemList, 256));
+
+    /* TLSF blocks can not move */
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitMemListTlsf(&stMemList, au8TlsfBuffer, sizeof(au8TlsfBuffer)));
+    TEST_ASSERT_FALSE(ezStaticAlloc_MallocMovable(&stMemList, (void**)&apu8Movable[0], 64));
+    TEST_ASSERT_EQUAL_UINT32(0U, ezStaticAlloc_Compact(&stMemList));
+}
+
+TEST(ez_static_alloc, large_buffer)
+{
+    ezmMemList stMemList;
+    static uint8_t au8Large[256U * 1024U];
+    uint8_t* pu8Block1 = NULL;
+    uint8_t* pu8Block2 = NULL;
+
+#if (CONFIG_EZ_STATIC_ALLOC_16BIT_SIZE == 0U)
+    TEST_ASSERT_EQUAL_UINT32(0xFFFFFFFFU, EZ_STATIC_ALLOC_MAX_SIZE);
+
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitMemList(&stMemList, au8Large, sizeof(au8Large)));
+    pu8Block1 = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, 70000U);
+    pu8Block2 = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, 150000U);
+    TEST_ASSERT_EQUAL_PTR(&au8Large[0], pu8Block1);
+    TEST_ASSERT_EQUAL_PTR(&au8Large[70000], pu8Block2);
+    TEST_ASSERT_NULL(ezStaticAlloc_Malloc(&stMemList, 70000U));
+    TEST_ASSERT_NULL(ezStaticAlloc_Malloc(&stMemList, 0xFFFFFFFFU));
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, pu8Block1));
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, pu8Block2));
+    TEST_ASSERT_NOT_NULL(ezStaticAlloc_Malloc(&stMemList, sizeof(au8Large)));
+
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitMemListTlsf(&stMemList, au8Large, sizeof(au8Large)));
+    pu8Block1 = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, 70000U);
+    pu8Block2 = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, 150000U);
+    TEST_ASSERT_NOT_NULL(pu8Block1);
+    TEST_ASSERT_NOT_NULL(pu8Block2);
+    memset(pu8Block1, 1, 70000U);
+    memset(pu8Block2, 2, 150000U);
+    TEST_ASSERT_EQUAL_UINT8(1, pu8Block1[69999]);
+    TEST_ASSERT_NULL(ezStaticAlloc_Malloc(&stMemList, 0xFFFFFFFFU));
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, pu8Block1));
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, pu8Block2));
+    TEST_ASSERT_EQUAL(1U, ezStaticAlloc_GetNumOfFreeBlock(&stMemList));
+#else
+    TEST_ASSERT_EQUAL_UINT32(0xFFFFU, EZ_STATIC_ALLOC_MAX_SIZE);
+
+    /* buffers and allocations above 65535 bytes are rejected */
+    TEST_ASSERT_FALSE(ezStaticAlloc_InitMemList(&stMemList, au8Large, sizeof(au8Large)));
+    TEST_ASSERT_FALSE(ezStaticAlloc_InitMemList(&stMemList, au8Large, 0x10000U));
+    TEST_ASSERT_FALSE(ezStaticAlloc_InitMemListTlsf(&stMemList, au8Large, 0x10000U));
+
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitMemList(&stMemList, au8Large, 0xFFFFU));
+    TEST_ASSERT_NULL(ezStaticAlloc_Malloc(&stMemList, 70000U));
+    TEST_ASSERT_NULL(ezStaticAlloc_Malloc(&stMemList, 0x10000U));
+    TEST_ASSERT_NULL(ezStaticAlloc_Malloc(&stMemList, 0xFFFFFFFFU));
+    pu8Block1 = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, 60000U);
+    TEST_ASSERT_EQUAL_PTR(&au8Large[0], pu8Block1);
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, pu8Block1));
+
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitMemListTlsf(&stMemList, au8Large, 0xFFFFU));
+    TEST_ASSERT_NULL(ezStaticAlloc_Malloc(&stMemList, 70000U));
+    TEST_ASSERT_NULL(ezStaticAlloc_Malloc(&stMemList, 0x10000U));
+    TEST_ASSERT_NULL(ezStaticAlloc_Malloc(&stMemList, 0xFFFFFFFFU));
+    pu8Block2 = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, 30000U);
+    TEST_ASSERT_NOT_NULL(pu8Block2);
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, pu8Block2));
+    TEST_ASSERT_EQUAL(1U, ezStaticAlloc_GetNumOfFreeBlock(&stMemList));
+#endif /* CONFIG_EZ_STATIC_ALLOC_16BIT_SIZE == 0U */
+}
+
+TEST(ez_static_alloc, aligned_first_fit)
+{
+    ezmMemList stMemList;
+    uint8_t* pu8Small = NULL;
+    uint8_t* apu8Blocks[4] = {0};
+    uint32_t u32Alignment = 8;
+
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitMemList(&stMemList, au8Buffer, 512));
+    TEST_ASSERT_NULL(ezStaticAlloc_MallocAligned(&stMemList, 16, 0));
+    TEST_ASSERT_NULL(ezStaticAlloc_MallocAligned(&stMemList, 16, 48));
+    TEST_ASSERT_NULL(ezStaticAlloc_MallocAligned(&stMemList, 16, 1024));
+
+    pu8Small = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, 3);
+    TEST_ASSERT_NOT_NULL(pu8Small);
+
+    /* up to 64: the padding must fit into the 512 byte buffer wherever it
+     * is placed */
+    for (uint32_t i = 0; i < 4; i++, u32Alignment *= 2U)
+    {
+        apu8Blocks[i] = (uint8_t*)ezStaticAlloc_MallocAligned(&stMemList, 40, u32Alignment);
+        TEST_ASSERT_NOT_NULL(apu8Blocks[i]);
+        TEST_ASSERT_EQUAL_UINT32(0U, (uint32_t)((uintptr_t)apu8Blocks[i] % u32Alignment));
+        memset(apu8Blocks[i], (int)i + 1, 40);
+    }
+
+    /* the padding in front of the blocks stays available */
+    TEST_ASSERT_TRUE(ezStaticAlloc_GetNumOfFreeBlock(&stMemList) > 1U);
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        TEST_ASSERT_EQUAL_UINT8((uint8_t)(i + 1U), apu8Blocks[i][0]);
+        TEST_ASSERT_EQUAL_UINT8((uint8_t)(i + 1U), apu8Blocks[i][39]);
+        TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, apu8Blocks[i]));
+    }
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, pu8Small));
+
+    TEST_ASSERT_EQUAL(1U, ezStaticAlloc_GetNumOfFreeBlock(&stMemList));
+    TEST_ASSERT_EQUAL(0U, ezStaticAlloc_GetNumOfAllocBlock(&stMemList));
+    TEST_ASSERT_EQUAL_PTR(&au8Buffer[0], ezStaticAlloc_MallocAligned(&stMemList, 512, 1));
+}
+
+TEST(ez_static_alloc, aligned_short_of_blocks)
+{
+    ezmMemList stMemList;
+    struct MemBlock astBlocks[4];
+    uint8_t* pu8Base = (uint8_t*)au64AlignedBuffer;
+    uint8_t* apu8Blocks[3] = {0};
+
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitMemListWithBlocks(&stMemList, au64AlignedBuffer, sizeof(au64AlignedBuffer), astBlocks, 4));
+
+    /* all descriptors in use, free list: [1, 21) misaligned, [64, 512) aligned */
+    apu8Blocks[0] = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, 1);
+    apu8Blocks[1] = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, 20);
+    apu8Blocks[2] = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, 43);
+    TEST_ASSERT_EQUAL_PTR(pu8Base + 21, apu8Blocks[2]);
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, apu8Blocks[1]));
+    TEST_ASSERT_EQUAL(2U, ezStaticAlloc_GetNumOfFreeBlock(&stMemList));
+
+    /* the first block needs a descriptor for its padding, the second none */
+    TEST_ASSERT_EQUAL_PTR(pu8Base + 64, ezStaticAlloc_MallocAligned(&stMemList, 8, 8));
+}
+
+TEST(ez_static_alloc, aligned_tlsf_small)
+{
+    ezmMemList stMemList;
+    ezStaticAllocStats stStats;
+    uint8_t* pu8Pad = NULL;
+    uint8_t* pu8Hole = NULL;
+    uint8_t* pu8Next = NULL;
+    uint8_t* pu8After = NULL;
+    uint8_t* pu8Aligned = NULL;
+
+    /* A tiny aligned block placed in a hole in front of a used block. The
+     * tail split off behind it must still hold a free block, or freeing it
+     * overwrites the header of the used neighbour, which a realloc growing
+     * into the tail then reads. The padding moves the hole through every
+     * offset to the alignment */
+    for (uint32_t i = 0; i < 8; i++)
+    {
+        TEST_ASSERT_TRUE(ezStaticAlloc_InitMemListTlsf(&stMemList, au8TlsfBuffer, sizeof(au8TlsfBuffer)));
+        pu8Pad = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, 16U + (i * 8U));
+        pu8Hole = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, 80);
+        pu8Next = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, 40);
+        pu8After = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, 40);
+        TEST_ASSERT_NOT_NULL(pu8Pad);
+        TEST_ASSERT_NOT_NULL(pu8Hole);
+        TEST_ASSERT_NOT_NULL(pu8Next);
+        TEST_ASSERT_NOT_NULL(pu8After);
+        memset(pu8Next, (int)i + 1, 40);
+        TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, pu8Hole));
+
+        pu8Aligned = (uint8_t*)ezStaticAlloc_MallocAligned(&stMemList, 1, 32);
+        TEST_ASSERT_NOT_NULL(pu8Aligned);
+        TEST_ASSERT_EQUAL_UINT32(0U, (uint32_t)((uintptr_t)pu8Aligned % 32U));
+
+        pu8Next = (uint8_t*)ezStaticAlloc_Realloc(&stMemList, pu8Next, 56);
+        TEST_ASSERT_NOT_NULL(pu8Next);
+        TEST_ASSERT_EQUAL_UINT8((uint8_t)(i + 1U), pu8Next[39]);
+
+        TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, pu8Aligned));
+        TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, pu8Next));
+        TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, pu8After));
+        TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, pu8Pad));
+
+        TEST_ASSERT_TRUE(ezStaticAlloc_GetStats(&stMemList, &stStats));
+        TEST_ASSERT_EQUAL(1U, stStats.num_of_free_blocks);
+        TEST_ASSERT_EQUAL(0U, stStats.num_of_alloc_blocks);
+    }
+}
+
+TEST(ez_static_alloc, aligned_tlsf)
+{
+    ezmMemList stMemList;
+    ezStaticAllocStats stStats;
+    uint32_t u32EmptyFree = 0;
+    uint8_t* apu8Blocks[7] = {0};
+    uint32_t u32Alignment = 4;
+
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitMemListTlsf(&stMemList, au8TlsfBuffer, sizeof(au8TlsfBuffer)));
+    TEST_ASSERT_TRUE(ezStaticAlloc_GetStats(&stMemList, &stStats));
+    u32EmptyFree = stStats.free_bytes;
+
+    for (uint32_t i = 0; i < 7; i++, u32Alignment *= 2U)
+    {
+        apu8Blocks[i] = (uint8_t*)ezStaticAlloc_MallocAligned(&stMemList, 24, u32Alignment);
+        TEST_ASSERT_NOT_NULL(apu8Blocks[i]);
+        TEST_ASSERT_EQUAL_UINT32(0U, (uint32_t)((uintptr_t)apu8Blocks[i] % u32Alignment));
+        memset(apu8Blocks[i], (int)i + 1, 24);
+    }
+    TEST_ASSERT_EQUAL(7U, ezStaticAlloc_GetNumOfAllocBlock(&stMemList));
+
+    /* aligning wastes no more than the blocks themselves */
+    TEST_ASSERT_TRUE(ezStaticAlloc_GetStats(&stMemList, &stStats));
+    TEST_ASSERT_TRUE(stStats.counters.used_bytes <= 7U * 32U);
+
+    for (uint32_t i = 0; i < 7; i++)
+    {
+        TEST_ASSERT_EQUAL_UINT8((uint8_t)(i + 1U), apu8Blocks[i][23]);
+        TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, apu8Blocks[i]));
+    }
+
+    TEST_ASSERT_TRUE(ezStaticAlloc_GetStats(&stMemList, &stStats));
+    TEST_ASSERT_EQUAL_UINT32(u32EmptyFree, stStats.free_bytes);
+    TEST_ASSERT_EQUAL(1U, stStats.num_of_free_blocks);
+    TEST_ASSERT_EQUAL(0U, stStats.num_of_alloc_blocks);
+}
+
+TEST(ez_static_alloc, realloc_first_fit)
+{
+    ezmMemList stMemList;
+    ezStaticAllocStats stStats;
+    uint8_t* pu8Block1 = NULL;
+    uint8_t* pu8Block2 = NULL;
+    uint8_t* pu8Moved = NULL;
+    uint8_t* pu8Movable = NULL;
+
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitMemList(&stMemList, au8Buffer, 512));
+    pu8Block1 = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, 32);
+    pu8Block2 = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, 32);
+    TEST_ASSERT_EQUAL_PTR(&au8Buffer[32], pu8Block2);
+    memset(pu8Block1, 0x11, 32);
+    memset(pu8Block2, 0x22, 32);
+
+    /* shrink: the tail merges with the free block behind */
+    TEST_ASSERT_EQUAL_PTR(pu8Block2, ezStaticAlloc_Realloc(&stMemList, pu8Block2, 16));
+    TEST_ASSERT_EQUAL(1U, ezStaticAlloc_GetNumOfFreeBlock(&stMemList));
+    TEST_ASSERT_EQUAL_UINT8(0x00, au8Buffer[48]);
+
+    /* grow into the next free block, the data stays in place */
+    TEST_ASSERT_EQUAL_PTR(pu8Block2, ezStaticAlloc_Realloc(&stMemList, pu8Block2, 100));
+    TEST_ASSERT_EQUAL_UINT8(0x22, pu8Block2[15]);
+
+    /* no free neighbour: the block moves */
+    pu8Moved = (uint8_t*)ezStaticAlloc_Realloc(&stMemList, pu8Block1, 64);
+    TEST_ASSERT_EQUAL_PTR(&au8Buffer[132], pu8Moved);
+    TEST_ASSERT_EQUAL_UINT8(0x11, pu8Moved[0]);
+    TEST_ASSERT_EQUAL_UINT8(0x11, pu8Moved[31]);
+    TEST_ASSERT_EQUAL(2U, ezStaticAlloc_GetNumOfAllocBlock(&stMemList));
+
+    /* grow into the previous free block, the data moves down */
+    pu8Block2 = (uint8_t*)ezStaticAlloc_Realloc(&stMemList, pu8Block2, 120);
+    TEST_ASSERT_EQUAL_PTR(&au8Buffer[0], pu8Block2);
+    for (uint16_t i = 0; i < 16; i++)
+    {
+        TEST_ASSERT_EQUAL_UINT8(0x22, pu8Block2[i]);
+    }
+    TEST_ASSERT_EQUAL_UINT8(0x00, au8Buffer[120]);
+    TEST_ASSERT_EQUAL(2U, ezStaticAlloc_GetNumOfFreeBlock(&stMemList));
+
+    /* failures leave the block allocated and unchanged */
+    TEST_ASSERT_NULL(ezStaticAlloc_Realloc(&stMemList, pu8Block2, 1024));
+    TEST_ASSERT_NULL(ezStaticAlloc_Realloc(&stMemList, pu8Block2, 400));
+    TEST_ASSERT_NULL(ezStaticAlloc_Realloc(&stMemList, &au8Buffer[300], 8));
+    TEST_ASSERT_EQUAL_UINT8(0x22, pu8Block2[0]);
+    TEST_ASSERT_EQUAL(2U, ezStaticAlloc_GetNumOfAllocBlock(&stMemList));
+
+    TEST_ASSERT_TRUE(ezStaticAlloc_GetStats(&stMemList, &stStats));
+    TEST_ASSERT_EQUAL_UINT32(3U, stStats.counters.num_of_resized);
+    TEST_ASSERT_EQUAL_UINT32(184U, stStats.counters.used_bytes);
+
+    /* NULL allocates, 0 frees */
+    TEST_ASSERT_NULL(ezStaticAlloc_Realloc(&stMemList, pu8Moved, 0));
+    TEST_ASSERT_NULL(ezStaticAlloc_Realloc(&stMemList, pu8Block2, 0));
+    TEST_ASSERT_EQUAL(0U, ezStaticAlloc_GetNumOfAllocBlock(&stMemList));
+    TEST_ASSERT_EQUAL_PTR(&au8Buffer[0], ezStaticAlloc_Realloc(&stMemList, NULL, 8));
+
+    /* a moved movable block keeps its handle */
+    TEST_ASSERT_TRUE(ezStaticAlloc_MallocMovable(&stMemList, (void**)&pu8Movable, 8));
+    memset(pu8Movable, 0x33, 8);
+    TEST_ASSERT_NOT_NULL(ezStaticAlloc_Malloc(&stMemList, 8));
+    TEST_ASSERT_EQUAL_PTR(&au8Buffer[24], ezStaticAlloc_Realloc(&stMemList, pu8Movable, 32));
+    TEST_ASSERT_EQUAL_PTR(&au8Buffer[24], pu8Movable);
+    TEST_ASSERT_EQUAL_UINT8(0x33, pu8Movable[7]);
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, pu8Movable));
+    TEST_ASSERT_NULL(pu8Movable);
+}
+
+TEST(ez_static_alloc, realloc_tlsf)
+{
+    ezmMemList stMemList;
+    ezStaticAllocStats stStats;
+    uint32_t u32EmptyFree = 0;
+    uint8_t* pu8Block1 = NULL;
+    uint8_t* pu8Block2 = NULL;
+    uint8_t* pu8Block3 = NULL;
+    uint8_t* pu8Moved = NULL;
+
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitMemListTlsf(&stMemList, au8TlsfBuffer, sizeof(au8TlsfBuffer)));
+    TEST_ASSERT_TRUE(ezStaticAlloc_GetStats(&stMemList, &stStats));
+    u32EmptyFree = stStats.free_bytes;
+
+    pu8Block1 = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, 32);
+    pu8Block2 = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, 128);
+    pu8Block3 = (uint8_t*)ezStaticAlloc_Malloc(&stMemList, 32);
+    TEST_ASSERT_NOT_NULL(pu8Block3);
+    memset(pu8Block2, 0x22, 128);
+
+    /* shrink: the tail becomes a free block */
+    TEST_ASSERT_EQUAL_PTR(pu8Block2, ezStaticAlloc_Realloc(&stMemList, pu8Block2, 32));
+    TEST_ASSERT_EQUAL(2U, ezStaticAlloc_GetNumOfFreeBlock(&stMemList));
+
+    /* grow into the next free block */
+    TEST_ASSERT_EQUAL_PTR(pu8Block2, ezStaticAlloc_Realloc(&stMemList, pu8Block2, 128));
+    TEST_ASSERT_EQUAL(1U, ezStaticAlloc_GetNumOfFreeBlock(&stMemList));
+    TEST_ASSERT_EQUAL_UINT8(0x22, pu8Block2[31]);
+
+    /* grow into the previous free block, including its header */
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, pu8Block1));
+    pu8Block2 = (uint8_t*)ezStaticAlloc_Realloc(&stMemList, pu8Block2,
+                                                (uint32_t)(pu8Block2 - pu8Block1) + 128U);
+    TEST_ASSERT_EQUAL_PTR(pu8Block1, pu8Block2);
+    TEST_ASSERT_EQUAL_UINT8(0x22, pu8Block2[0]);
+    TEST_ASSERT_EQUAL_UINT8(0x22, pu8Block2[31]);
+
+    /* no free neighbour: the block moves behind block 3 */
+    pu8Moved = (uint8_t*)ezStaticAlloc_Realloc(&stMemList, pu8Block2, 1024);
+    TEST_ASSERT_TRUE(pu8Moved > pu8Block3);
+    TEST_ASSERT_EQUAL_UINT8(0x22, pu8Moved[31]);
+    TEST_ASSERT_NULL(ezStaticAlloc_Realloc(&stMemList, pu8Moved, 4096));
+    TEST_ASSERT_NULL(ezStaticAlloc_Realloc(&stMemList, pu8Block2, 8));
+
+    TEST_ASSERT_TRUE(ezStaticAlloc_GetStats(&stMemList, &stStats));
+    TEST_ASSERT_EQUAL_UINT32(3U, stStats.counters.num_of_resized);
+
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, pu8Moved));
+    TEST_ASSERT_TRUE(ezStaticAlloc_Free(&stMemList, pu8Block3));
+    TEST_ASSERT_TRUE(ezStaticAlloc_GetStats(&stMemList, &stStats));
+    TEST_ASSERT_EQUAL_UINT32(u32EmptyFree, stStats.free_bytes);
+    TEST_ASSERT_EQUAL(1U, stStats.num_of_free_blocks);
+    TEST_ASSERT_EQUAL_UINT32(0U, stStats.counters.used_bytes);
+}
+
+TEST(ez_static_alloc, heap_regions)
+{
+    ezStaticAllocHeap stHeap;
+    ezmMemList stFastList;
+    ezmMemList stSlowList;
+    ezmMemList stOtherList;
+    uint8_t* apu8Blocks[4] = {0};
+    uint8_t u8Local = 0;
+
+    TEST_ASSERT_FALSE(ezStaticAlloc_InitHeap(NULL, 0));
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitHeap(&stHeap, 256));
+    TEST_ASSERT_NULL(ezStaticAlloc_HeapMalloc(&stHeap, 8, EZ_STATIC_ALLOC_FAST_FIRST));
+
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitMemListTlsf(&stSlowList, au8TlsfBuffer, sizeof(au8TlsfBuffer)));
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitMemList(&stFastList, au8Buffer, 128));
+    memset(&stOtherList, 0, sizeof(stOtherList));
+
+    /* regions are sorted by speed, not by the order they are added */
+    TEST_ASSERT_TRUE(ezStaticAlloc_AddRegion(&stHeap, &stSlowList, 1));
+    TEST_ASSERT_TRUE(ezStaticAlloc_AddRegion(&stHeap, &stFastList, 10));
+    TEST_ASSERT_FALSE(ezStaticAlloc_AddRegion(&stHeap, &stFastList, 10));
+    TEST_ASSERT_FALSE(ezStaticAlloc_AddRegion(&stHeap, &stOtherList, 5));
+    TEST_ASSERT_EQUAL_PTR(&stFastList, stHeap.regions[0].mem_list);
+
+    /* fast memory first, spill to slow memory under pressure */
+    apu8Blocks[0] = (uint8_t*)ezStaticAlloc_HeapMalloc(&stHeap, 64, EZ_STATIC_ALLOC_FAST_FIRST);
+    apu8Blocks[1] = (uint8_t*)ezStaticAlloc_HeapMalloc(&stHeap, 64, EZ_STATIC_ALLOC_FAST_FIRST);
+    apu8Blocks[2] = (uint8_t*)ezStaticAlloc_HeapMalloc(&stHeap, 64, EZ_STATIC_ALLOC_FAST_FIRST);
+    TEST_ASSERT_EQUAL_PTR(&stFastList, ezStaticAlloc_HeapGetRegion(&stHeap, apu8Blocks[0]));
+    TEST_ASSERT_EQUAL_PTR(&stFastList, ezStaticAlloc_HeapGetRegion(&stHeap, apu8Blocks[1]));
+    TEST_ASSERT_EQUAL_PTR(&stSlowList, ezStaticAlloc_HeapGetRegion(&stHeap, apu8Blocks[2]));
+    TEST_ASSERT_NULL(ezStaticAlloc_HeapMalloc(&stHeap, sizeof(au8TlsfBuffer), EZ_STATIC_ALLOC_FAST_FIRST));
+
+    /* free is routed to the region owning the address */
+    TEST_ASSERT_FALSE(ezStaticAlloc_HeapFree(&stHeap, &u8Local));
+    TEST_ASSERT_FALSE(ezStaticAlloc_HeapFree(&stHeap, NULL));
+    TEST_ASSERT_TRUE(ezStaticAlloc_HeapFree(&stHeap, apu8Blocks[1]));
+    TEST_ASSERT_TRUE(ezStaticAlloc_HeapFree(&stHeap, apu8Blocks[2]));
+    TEST_ASSERT_FALSE(ezStaticAlloc_HeapFree(&stHeap, apu8Blocks[2]));
+    TEST_ASSERT_EQUAL(0U, ezStaticAlloc_GetNumOfAllocBlock(&stSlowList));
+
+    /* freed fast memory is used again */
+    apu8Blocks[3] = (uint8_t*)ezStaticAlloc_HeapMalloc(&stHeap, 64, EZ_STATIC_ALLOC_FAST_FIRST);
+    TEST_ASSERT_EQUAL_PTR(apu8Blocks[1], apu8Blocks[3]);
+    TEST_ASSERT_TRUE(ezStaticAlloc_HeapFree(&stHeap, apu8Blocks[0]));
+    TEST_ASSERT_TRUE(ezStaticAlloc_HeapFree(&stHeap, apu8Blocks[3]));
+    TEST_ASSERT_EQUAL(0U, ezStaticAlloc_GetNumOfAllocBlock(&stFastList));
+}
+
+TEST(ez_static_alloc, heap_placement)
+{
+    ezStaticAllocHeap stHeap;
+    ezmMemList stFastList;
+    ezmMemList stSlowList;
+    void* pvBlock = NULL;
+
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitHeap(&stHeap, 256));
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitMemList(&stFastList, au8Buffer, sizeof(au8Buffer)));
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitMemListTlsf(&stSlowList, au8TlsfBuffer, sizeof(au8TlsfBuffer)));
+    TEST_ASSERT_TRUE(ezStaticAlloc_AddRegion(&stHeap, &stFastList, 10));
+    TEST_ASSERT_TRUE(ezStaticAlloc_AddRegion(&stHeap, &stSlowList, 1));
+
+    pvBlock = ezStaticAlloc_HeapMalloc(&stHeap, 32, EZ_STATIC_ALLOC_SLOW_FIRST);
+    TEST_ASSERT_EQUAL_PTR(&stSlowList, ezStaticAlloc_HeapGetRegion(&stHeap, pvBlock));
+    TEST_ASSERT_TRUE(ezStaticAlloc_HeapFree(&stHeap, pvBlock));
+
+    /* large blocks go to slow memory, small ones to fast memory */
+    pvBlock = ezStaticAlloc_HeapMalloc(&stHeap, 256, EZ_STATIC_ALLOC_BY_SIZE);
+    TEST_ASSERT_EQUAL_PTR(&stSlowList, ezStaticAlloc_HeapGetRegion(&stHeap, pvBlock));
+    TEST_ASSERT_TRUE(ezStaticAlloc_HeapFree(&stHeap, pvBlock));
+
+    pvBlock = ezStaticAlloc_HeapMalloc(&stHeap, 255, EZ_STATIC_ALLOC_BY_SIZE);
+    TEST_ASSERT_EQUAL_PTR(&stFastList, ezStaticAlloc_HeapGetRegion(&stHeap, pvBlock));
+    TEST_ASSERT_TRUE(ezStaticAlloc_HeapFree(&stHeap, pvBlock));
+}
+
+TEST(ez_static_alloc, cache)
+{
+    ezmMemList stMemList;
+    ezStaticAllocCache stCache;
+    const ezStaticAllocLock stLock = { TestLock_Lock, TestLock_Unlock, &stTestLock };
+    void* apvBlocks[CONFIG_EZ_STATIC_ALLOC_MAGAZINE_SIZE + 1U] = {0};
+    void* pvBlock = NULL;
+    void* apvFill[128] = {0};
+    uint32_t u32NumOfFill = 0U;
+
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitMemListTlsf(&stMemList, au8TlsfBuffer, sizeof(au8TlsfBuffer)));
+    ezStaticAlloc_SetLock(&stMemList, &stLock);
+    TEST_ASSERT_FALSE(ezStaticAlloc_InitCache(&stCache, NULL));
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitCache(&stCache, &stMemList));
+    stTestLock.num_of_locks = 0U;
+
+    /* a freed block is handed out again without the lock, also for another
+     * size of the same class */
+    pvBlock = ezStaticAlloc_CacheMalloc(&stCache, 20);
+    TEST_ASSERT_NOT_NULL(pvBlock);
+    TEST_ASSERT_EQUAL(1U, stTestLock.num_of_locks);
+    TEST_ASSERT_TRUE(ezStaticAlloc_CacheFree(&stCache, pvBlock, 20));
+    TEST_ASSERT_EQUAL_PTR(pvBlock, ezStaticAlloc_CacheMalloc(&stCache, 32));
+    TEST_ASSERT_TRUE(ezStaticAlloc_CacheFree(&stCache, pvBlock, 32));
+    TEST_ASSERT_EQUAL(1U, stTestLock.num_of_locks);
+    TEST_ASSERT_EQUAL(1U, stCache.num_of_hits);
+    TEST_ASSERT_EQUAL(1U, stCache.num_of_misses);
+    TEST_ASSERT_EQUAL(1U, ezStaticAlloc_GetNumOfAllocBlock(&stMemList));
+
+    /* cached blocks are returned to the list by a flush */
+    ezStaticAlloc_CacheFlush(&stCache);
+    TEST_ASSERT_EQUAL(0U, ezStaticAlloc_GetNumOfAllocBlock(&stMemList));
+
+    /* an overflowing magazine returns half of its blocks at once */
+    for (uint32_t i = 0; i <= CONFIG_EZ_STATIC_ALLOC_MAGAZINE_SIZE; i++)
+    {
+        apvBlocks[i] = ezStaticAlloc_CacheMalloc(&stCache, 8);
+        TEST_ASSERT_NOT_NULL(apvBlocks[i]);
+    }
+    for (uint32_t i = 0; i <= CONFIG_EZ_STATIC_ALLOC_MAGAZINE_SIZE; i++)
+    {
+        TEST_ASSERT_TRUE(ezStaticAlloc_CacheFree(&stCache, apvBlocks[i], 8));
+    }
+    TEST_ASSERT_EQUAL(CONFIG_EZ_STATIC_ALLOC_MAGAZINE_SIZE - ((CONFIG_EZ_STATIC_ALLOC_MAGAZINE_SIZE + 1U) / 2U) + 1U,
+                      stCache.magazines[0].count);
+    TEST_ASSERT_EQUAL(stCache.magazines[0].count, ezStaticAlloc_GetNumOfAllocBlock(&stMemList));
+
+    /* large requests bypass the cache */
+    pvBlock = ezStaticAlloc_CacheMalloc(&stCache, 1000);
+    TEST_ASSERT_NOT_NULL(pvBlock);
+    TEST_ASSERT_TRUE(ezStaticAlloc_CacheFree(&stCache, pvBlock, 1000));
+    TEST_ASSERT_EQUAL(stCache.magazines[0].count, ezStaticAlloc_GetNumOfAllocBlock(&stMemList));
+
+    /* when the list runs out of memory the cache gives its blocks back */
+    while (u32NumOfFill < 128U
+           && (apvFill[u32NumOfFill] = ezStaticAlloc_Malloc(&stMemList, 16)) != NULL)
+    {
+        u32NumOfFill++;
+    }
+    TEST_ASSERT_TRUE(u32NumOfFill < 128U);
+    TEST_ASSERT_NULL(ezStaticAlloc_Malloc(&stMemList, 17));
+    TEST_ASSERT_NOT_NULL(ezStaticAlloc_CacheMalloc(&stCache, 17));
+    TEST_ASSERT_EQUAL(0U, stCache.magazines[0].count);
+
+    ezStaticAlloc_SetLock(&stMemList, NULL);
+}
+
+TEST(ez_static_alloc, thread_safe)
+{
+    ezmMemList stMemList;
+    const ezStaticAllocLock stLock = { TestLock_Lock, TestLock_Unlock, &stTestLock };
+    pthread_t astThreads[STRESS_NUM_OF_THREADS];
+    TestWorker astWorkers[STRESS_NUM_OF_THREADS];
+    uint32_t u32LocksWithoutCache = 0U;
+
+    for (uint32_t use_cache = 0; use_cache < 2U; use_cache++)
+    {
+        TEST_ASSERT_TRUE(ezStaticAlloc_InitMemListTlsf(&stMemList, au8StressBuffer, sizeof(au8StressBuffer)));
+        ezStaticAlloc_SetLock(&stMemList, &stLock);
+        stTestLock.num_of_locks = 0U;
+
+        for (uint32_t i = 0; i < STRESS_NUM_OF_THREADS; i++)
+        {
+            astWorkers[i].mem_list = &stMemList;
+            astWorkers[i].id = i;
+            astWorkers[i].use_cache = (use_cache == 1U);
+            astWorkers[i].errors = 0U;
+            TEST_ASSERT_EQUAL(0, pthread_create(&astThreads[i], NULL, StressWorker, &astWorkers[i]));
+        }
+
+        for (uint32_t i = 0; i < STRESS_NUM_OF_THREADS; i++)
+        {
+            TEST_ASSERT_EQUAL(0, pthread_join(astThreads[i], NULL));
+            TEST_ASSERT_EQUAL(0U, astWorkers[i].errors);
+        }
+
+        /* every block came back and merged */
+        TEST_ASSERT_EQUAL(0U, ezStaticAlloc_GetNumOfAllocBlock(&stMemList));
+        TEST_ASSERT_EQUAL(1U, ezStaticAlloc_GetNumOfFreeBlock(&stMemList));
+
+        if (use_cache == 0U)
+        {
+            u32LocksWithoutCache = stTestLock.num_of_locks;
+        }
+        ezStaticAlloc_SetLock(&stMemList, NULL);
+    }
+
+    /* most allocations did not take the lock */
+    TEST_ASSERT_TRUE(stTestLock.num_of_locks * 4U < u32LocksWithoutCache);
+}
+
+TEST(ez_static_alloc, shared_pool_lock)
+{
+    ezmMemList astMemLists[2];
+    const ezStaticAllocLock astLocks[2] = {
+        { TestLock_Lock, TestLock_Unlock, &stTestLock },
+        { TestLock_Lock, TestLock_Unlock, &stTestLock2 },
+    };
+    const ezStaticAllocLock stPoolLock = { TestLock_Lock, TestLock_Unlock, &stSharedPoolLock };
+    pthread_t astThreads[STRESS_NUM_OF_THREADS];
+    TestWorker astWorkers[STRESS_NUM_OF_THREADS];
+
+    /* two first fit lists with different locks share the descriptors */
+    ezStaticAlloc_SetSharedPoolLock(&stPoolLock);
+    for (uint32_t i = 0; i < 2U; i++)
+    {
+        TEST_ASSERT_TRUE(ezStaticAlloc_InitMemList(&astMemLists[i],
+                                                   &au8StressBuffer[i * (sizeof(au8StressBuffer) / 2U)],
+                                                   sizeof(au8StressBuffer) / 2U));
+        ezStaticAlloc_SetLock(&astMemLists[i], &astLocks[i]);
+    }
+    stSharedPoolLock.num_of_locks = 0U;
+
+    for (uint32_t i = 0; i < STRESS_NUM_OF_THREADS; i++)
+    {
+        astWorkers[i].mem_list = &astMemLists[i % 2U];
+        astWorkers[i].id = i;
+        astWorkers[i].use_cache = false;
+        astWorkers[i].errors = 0U;
+        TEST_ASSERT_EQUAL(0, pthread_create(&astThreads[i], NULL, StressWorker, &astWorkers[i]));
+    }
+
+    for (uint32_t i = 0; i < STRESS_NUM_OF_THREADS; i++)
+    {
+        TEST_ASSERT_EQUAL(0, pthread_join(astThreads[i], NULL));
+        TEST_ASSERT_EQUAL(0U, astWorkers[i].errors);
+    }
+
+    for (uint32_t i = 0; i < 2U; i++)
+    {
+        TEST_ASSERT_EQUAL(0U, ezStaticAlloc_GetNumOfAllocBlock(&astMemLists[i]));
+        TEST_ASSERT_EQUAL(1U, ezStaticAlloc_GetNumOfFreeBlock(&astMemLists[i]));
+        ezStaticAlloc_SetLock(&astMemLists[i], NULL);
+    }
+    TEST_ASSERT_TRUE(stSharedPoolLock.num_of_locks > 0U);
+    ezStaticAlloc_SetSharedPoolLock(NULL);
+}
+
+TEST(ez_static_alloc, free_batch)
+{
+    ezmMemList stMemList;
+    const ezStaticAllocLock stLock = { TestLock_Lock, TestLock_Unlock, &stTestLock };
+    void* apvBlocks[5] = { NULL };
+
+    TEST_ASSERT_TRUE(ezStaticAlloc_InitMemList(&stMemList, au8Buffer, 512));
+    for (uint32_t i = 0; i < 4U; i++)
+    {
+        apvBlocks[i] = ezStaticAlloc_Malloc(&stMemList, 16U * (i + 1U));
+        TEST_ASSERT_NOT_NULL(apvBlocks[i]);
+    }
+    apvBlocks[4] = &au8Buffer[511];
+
+    TEST_ASSERT_EQUAL(0U, ezStaticAlloc_FreeBatch(NULL, apvBlocks, 5U));
+    TEST_ASSERT_EQUAL(0U, ezStaticAlloc_FreeBatch(&stMemList, NULL, 5U));
+
+    /* one lock for the batch, unknown and NULL addresses are skipped */
+    ezStaticAlloc_SetLock(&stMemList, &stLock);
+    stTestLock.num_of_locks = 0U;
+    apvBlocks[1] = NULL;
+    TEST_ASSERT_EQUAL(3U, ezStaticAlloc_FreeBatch(&stMemList, apvBlocks, 5U));
+    TEST_ASSERT_EQUAL(1U, stTestLock.num_of_locks);
+    TEST_ASSERT_EQUAL(1U, ezStaticAlloc_GetNumOfAllocBlock(&stMemList));
+    ezStaticAlloc_SetLock(&stMemList, NULL);
+}
+
 /******************************************************************************
 * Internal functions
 *******************************************************************************/
@@ -398,4 +1417,67 @@ static void RunAllTests(void)
 }
 
 
+static void TestLock_Lock(void *context)
+{
+    TestLock *lock = (TestLock *)context;
+    pthread_mutex_lock(&lock->mutex);
+    lock->num_of_locks++;
+}
+
+
+static void TestLock_Unlock(void *context)
+{
+    pthread_mutex_unlock(&((TestLock *)context)->mutex);
+}
+
+
+static void *StressWorker(void *arg)
+{
+    TestWorker *worker = (TestWorker *)arg;
+    ezStaticAllocCache cache;
+    uint8_t *held[STRESS_HOLD];
+    uint32_t sizes[STRESS_HOLD];
+    uint32_t seed = worker->id + 1U;
+
+    (void)ezStaticAlloc_InitCache(&cache, worker->mem_list);
+
+    for (uint32_t round = 0; round < STRESS_NUM_OF_ROUNDS; round++)
+    {
+        for (uint32_t i = 0; i < STRESS_HOLD; i++)
+        {
+            seed = seed * 1103515245U + 12345U;
+            sizes[i] = 8U + ((seed >> 8) % 120U);
+            do
+            {
+                held[i] = worker->use_cache ? (uint8_t *)ezStaticAlloc_CacheMalloc(&cache, sizes[i])
+                                            : (uint8_t *)ezStaticAlloc_Malloc(worker->mem_list, sizes[i]);
+                if (held[i] == NULL)
+                {
+                    (void)sched_yield();
+                }
+            } while (held[i] == NULL);
+            memset(held[i], (int)worker->id, sizes[i]);
+        }
+
+        /* Nobody else may have got the same memory */
+        for (uint32_t i = 0; i < STRESS_HOLD; i++)
+        {
+            if (held[i][0] != (uint8_t)worker->id || held[i][sizes[i] - 1U] != (uint8_t)worker->id)
+            {
+                worker->errors++;
+            }
+
+            if (worker->use_cache ? !ezStaticAlloc_CacheFree(&cache, held[i], sizes[i])
+                                  : !ezStaticAlloc_Free(worker->mem_list, held[i]))
+            {
+                worker->errors++;
+            }
+        }
+    }
+
+    ezStaticAlloc_CacheFlush(&cache);
+    return NULL;
+}
+
+
 /* End of file */